@@ -0,0 +1,80 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_OP25_REPEATER_CODEC_FRAME_H
+#define INCLUDED_OP25_REPEATER_CODEC_FRAME_H
+
+#include <op25_repeater/api.h>
+#include <stdint.h>
+
+namespace gr {
+    namespace op25_repeater {
+
+        // Same codec_type values as the voice codec callback
+        enum codec_frame_type {
+            CODEC_P25_IMBE = 0,
+            CODEC_P25_AMBE = 1,
+            CODEC_DMR_AMBE = 2
+        };
+
+        static const int CODEC_FRAME_SAMPLES = 160;   // 20ms of 8 kHz audio per frame
+
+        // One vocoder frame held back for synthesis later. With a deferred
+        // vocoder the frame assemblers queue a silent frame in its place and tag
+        // it with this, so the audio can be filled in off the DSP path.
+        struct codec_frame {
+            uint8_t codec_type;
+            uint8_t param_count;
+            uint8_t e0;             // FEC errors in the first codeword (IMBE: E0)
+            uint8_t e1;             // FEC errors in the second codeword (IMBE: ET)
+            uint32_t params[8];     // u[] codewords as the decoder unpacked them
+        };
+
+        // The frames that go out in one call to a frame assembler's work are
+        // packed into a single "codec_frames" tag, on the sample the first of
+        // them starts at, as an array of these.
+        struct tagged_codec_frame {
+            uint32_t offset;        // samples from the tag to the start of the frame
+            codec_frame frame;
+        };
+
+        // Turns a stream of codec frames back into PCM. The vocoders carry state
+        // from one frame to the next, so frames have to be given in the order they
+        // were received, one codec_synth per stream.
+        class OP25_REPEATER_API codec_synth
+        {
+            public:
+                codec_synth(bool soft_vocoder, bool fast_vocoder = false);
+                ~codec_synth();
+
+                // Writes CODEC_FRAME_SAMPLES samples to out. Returns false, leaving
+                // silence, if the codec is not supported.
+                bool decode(const codec_frame &frame, int16_t *out);
+
+            private:
+                struct impl;
+                impl *d_impl;
+
+                codec_synth(const codec_synth &);
+                codec_synth &operator=(const codec_synth &);
+        };
+
+    } // namespace op25_repeater
+} // namespace gr
+
+#endif /* INCLUDED_OP25_REPEATER_CODEC_FRAME_H */
@@ -0,0 +1,128 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_OP25_REPEATER_CONTROL_FRAME_H
+#define INCLUDED_OP25_REPEATER_CONTROL_FRAME_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+namespace gr {
+    namespace op25_repeater {
+
+        static const int CONTROL_FRAME_MAX_LEN = 64; // largest MBT is 44 bytes
+
+        // A control channel message as the decoder produced it. The type is the
+        // same value the gr::message carried (the P25 DUID, or the protocol and
+        // message type for SmartNet), so the parsers handle both the same way.
+        struct control_frame {
+            long type;
+            uint32_t nac;
+            bool crc_ok;        // false for blocks that failed their CRC check
+            double timestamp;   // time the frame was decoded
+            uint16_t len;
+            uint8_t data[CONTROL_FRAME_MAX_LEN];
+        };
+
+        // Fixed size single producer, single consumer ring of control frames. The
+        // decoder thread pushes and the main loop pops, without locks or allocation.
+        class control_frame_ring
+        {
+            public:
+                control_frame_ring(size_t capacity = 256) :
+                    d_frames(round_up(capacity)),
+                    d_mask(round_up(capacity) - 1),
+                    d_head(0),
+                    d_tail(0),
+                    d_overflows(0),
+                    d_high_water(0)
+                {
+                }
+
+                // Producer side. Returns false and counts an overflow if the ring is full.
+                bool push(long type, uint32_t nac, bool crc_ok, double timestamp, const uint8_t *data, size_t len)
+                {
+                    size_t head = d_head.load(std::memory_order_relaxed);
+                    size_t tail = d_tail.load(std::memory_order_acquire);
+                    if (head - tail >= d_frames.size()) {
+                        d_overflows.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    }
+                    if (len > CONTROL_FRAME_MAX_LEN)
+                        len = CONTROL_FRAME_MAX_LEN;
+
+                    control_frame &frame = d_frames[head & d_mask];
+                    frame.type = type;
+                    frame.nac = nac;
+                    frame.crc_ok = crc_ok;
+                    frame.timestamp = timestamp;
+                    frame.len = len;
+                    if (len)
+                        memcpy(frame.data, data, len);
+                    d_head.store(head + 1, std::memory_order_release);
+
+                    size_t depth = head + 1 - tail;
+                    if (depth > d_high_water.load(std::memory_order_relaxed))
+                        d_high_water.store(depth, std::memory_order_relaxed);
+                    return true;
+                }
+
+                // Consumer side. Copies up to max frames into out and returns how many.
+                size_t pop(control_frame *out, size_t max)
+                {
+                    size_t tail = d_tail.load(std::memory_order_relaxed);
+                    size_t head = d_head.load(std::memory_order_acquire);
+                    size_t count = head - tail;
+                    if (count > max)
+                        count = max;
+                    for (size_t i = 0; i < count; i++) {
+                        out[i] = d_frames[(tail + i) & d_mask];
+                    }
+                    d_tail.store(tail + count, std::memory_order_release);
+                    return count;
+                }
+
+                size_t depth() const { return d_head.load(std::memory_order_acquire) - d_tail.load(std::memory_order_acquire); }
+                size_t capacity() const { return d_frames.size(); }
+                size_t high_water() const { return d_high_water.load(std::memory_order_relaxed); }
+                long overflows() const { return d_overflows.load(std::memory_order_relaxed); }
+
+            private:
+                static size_t round_up(size_t n)
+                {
+                    size_t size = 1;
+                    while (size < n)
+                        size <<= 1;
+                    return size;
+                }
+
+                std::vector<control_frame> d_frames;
+                const size_t d_mask;
+                alignas(64) std::atomic<size_t> d_head;   // written by the producer
+                alignas(64) std::atomic<size_t> d_tail;   // written by the consumer
+                std::atomic<long> d_overflows;
+                std::atomic<size_t> d_high_water;
+        };
+
+    } // namespace op25_repeater
+} // namespace gr
+
+#endif /* INCLUDED_OP25_REPEATER_CONTROL_FRAME_H */
@@ -0,0 +1,63 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_OP25_REPEATER_CQPSK_DEMOD_CF_H
+#define INCLUDED_OP25_REPEATER_CQPSK_DEMOD_CF_H
+
+#include <op25_repeater/api.h>
+#include <gnuradio/block.h>
+
+namespace gr {
+    namespace op25_repeater {
+
+        /*!
+         * \brief Fused CQPSK demodulator
+         * \ingroup op25
+         *
+         * Does the work of gardner_cc -> diff_phasor_cc -> costas_loop_cc ->
+         * complex_to_arg -> multiply_const_ff in one block, for P25 Phase 1
+         * LSM and Phase 2. Each symbol from the Gardner timing loop is
+         * differentially decoded and carrier corrected as it is produced,
+         * and the phases of the whole batch are converted to the nominal
+         * levels -3, -1, +1 and +3 at once, ready for fsk4_slicer_fb.
+         */
+        class OP25_REPEATER_API cqpsk_demod_cf : virtual public gr::block
+        {
+            public:
+                #if GNURADIO_VERSION < 0x030900
+                typedef boost::shared_ptr<cqpsk_demod_cf> sptr;
+                #else
+                typedef std::shared_ptr<cqpsk_demod_cf> sptr;
+                #endif
+
+                /*!
+                 * \param samples_per_symbol nominal samples per symbol (omega)
+                 * \param gain_mu Gardner timing gain
+                 * \param gain_omega Gardner symbol rate gain
+                 * \param costas_loop_bw Costas loop bandwidth
+                 */
+                static sptr make(float samples_per_symbol, float gain_mu, float gain_omega, float costas_loop_bw);
+
+                virtual void set_omega(float omega) {}
+                virtual void reset() {}
+        };
+
+    } // namespace op25_repeater
+} // namespace gr
+
+#endif /* INCLUDED_OP25_REPEATER_CQPSK_DEMOD_CF_H */
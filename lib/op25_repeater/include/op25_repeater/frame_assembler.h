@@ -23,6 +23,8 @@
 #define INCLUDED_OP25_REPEATER_FRAME_ASSEMBLER_H
 
 #include <op25_repeater/api.h>
+#include <op25_repeater/control_frame.h>
+#include <op25_repeater/codec_frame.h>
 #include <gnuradio/block.h>
 #include <gnuradio/msg_queue.h>
 
@@ -59,8 +61,16 @@ namespace gr {
                 virtual void sync_reset(void) {}
                 virtual void crypt_reset(void) {}
                 virtual void crypt_key(uint16_t keyid, uint8_t algid, const std::vector<uint8_t> &key) {}
-                typedef void (*voice_codec_cb_t)(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, void *user_data);
+                // errs is the decoder's error count for the frame; e0 and e1 are the FEC errors
+                // of its first two codewords (IMBE: E0 and ET), 0 for codecs without them.
+                // encrypted is set when there was no key for the frame and params are ciphertext.
+                typedef void (*voice_codec_cb_t)(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted, void *user_data);
                 virtual void set_voice_codec_callback(voice_codec_cb_t cb, void *user_data) {}
+                virtual void set_control_ring(control_frame_ring *ring) {}
+                // Output silent DMR frames tagged "codec_frames" with their codewords instead of synthesized audio
+                virtual void set_deferred_vocoder(bool deferred) {}
+                // Use the table driven synthesis of the software vocoder
+                virtual void set_fast_vocoder(bool fast) {}
         };
 
     } // namespace op25_repeater
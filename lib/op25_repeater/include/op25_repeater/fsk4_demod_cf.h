@@ -0,0 +1,65 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_OP25_REPEATER_FSK4_DEMOD_CF_H
+#define INCLUDED_OP25_REPEATER_FSK4_DEMOD_CF_H
+
+#include <op25_repeater/api.h>
+#include <gnuradio/block.h>
+#include <vector>
+
+namespace gr {
+    namespace op25_repeater {
+
+        /*!
+         * \brief Fused C4FM demodulator
+         * \ingroup op25
+         *
+         * Does the work of pll_freqdet_cf -> multiply_const_ff ->
+         * fft_filter_fff -> fir_filter_fff -> fsk4_demod_ff in one block.
+         * The PLL frequency detector output is scaled to the symbol
+         * deviation, run through the baseband noise filter and the
+         * symbol averaging filter (combined into one FIR), and the
+         * symbol timing is recovered with the same MMSE tracking loop
+         * as fsk4_demod_ff. The output is one float per symbol at the
+         * nominal levels -3, -1, +1 and +3, ready for fsk4_slicer_fb.
+         */
+        class OP25_REPEATER_API fsk4_demod_cf : virtual public gr::block
+        {
+            public:
+                #if GNURADIO_VERSION < 0x030900
+                typedef boost::shared_ptr<fsk4_demod_cf> sptr;
+                #else
+                typedef std::shared_ptr<fsk4_demod_cf> sptr;
+                #endif
+
+                /*!
+                 * \param sample_rate_Hz input sample rate
+                 * \param symbol_rate_Hz symbol rate, 4800 for P25 Phase 1
+                 * \param deviation_Hz deviation of the +1 symbol, 600 for P25 Phase 1
+                 * \param filter_taps baseband noise filter taps at sample_rate_Hz
+                 */
+                static sptr make(float sample_rate_Hz, float symbol_rate_Hz, float deviation_Hz, const std::vector<float> &filter_taps);
+
+                virtual void reset() {}
+        };
+
+    } // namespace op25_repeater
+} // namespace gr
+
+#endif /* INCLUDED_OP25_REPEATER_FSK4_DEMOD_CF_H */
@@ -0,0 +1,143 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_OP25_REPEATER_AUDIO_RING_H
+#define INCLUDED_OP25_REPEATER_AUDIO_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#include "../include/op25_repeater/codec_frame.h"
+
+static const size_t AUDIO_RING_FRAME = 160;   // samples per 20ms vocoder frame at 8 kHz
+static const size_t AUDIO_RING_FRAMES = 200;  // 4 seconds of vocoder frames
+
+// Fixed size single producer, single consumer ring of decoded PCM samples. The
+// decoders push a vocoder frame at a time and the frame assembler copies out
+// as much as the output buffer has room for. When the ring is full new samples
+// are dropped and counted rather than growing the queue.
+class audio_ring
+{
+public:
+	audio_ring(size_t capacity = AUDIO_RING_FRAME * AUDIO_RING_FRAMES) :
+		d_samples(round_up(capacity)),
+		d_mask(round_up(capacity) - 1),
+		d_head(0),
+		d_tail(0),
+		d_overflows(0)
+	{
+	}
+
+	// Producer side
+	void push_back(int16_t sample)
+	{
+		size_t head = d_head.load(std::memory_order_relaxed);
+		if (head - d_tail.load(std::memory_order_acquire) >= d_samples.size()) {
+			d_overflows.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		d_samples[head & d_mask] = sample;
+		d_head.store(head + 1, std::memory_order_release);
+	}
+
+	void push_back(const int16_t *samples, size_t n)
+	{
+		size_t head = d_head.load(std::memory_order_relaxed);
+		size_t space = d_samples.size() - (head - d_tail.load(std::memory_order_acquire));
+		if (n > space) {
+			d_overflows.fetch_add(n - space, std::memory_order_relaxed);
+			n = space;
+		}
+		size_t start = head & d_mask;
+		size_t first = std::min(n, d_samples.size() - start);
+		memcpy(&d_samples[start], samples, first * sizeof(int16_t));
+		memcpy(&d_samples[0], samples + first, (n - first) * sizeof(int16_t));
+		d_head.store(head + n, std::memory_order_release);
+	}
+
+	// Consumer side. Copies up to max samples into out and returns how many.
+	size_t pop(int16_t *out, size_t max)
+	{
+		size_t tail = d_tail.load(std::memory_order_relaxed);
+		size_t n = d_head.load(std::memory_order_acquire) - tail;
+		if (n > max)
+			n = max;
+		size_t start = tail & d_mask;
+		size_t first = std::min(n, d_samples.size() - start);
+		memcpy(out, &d_samples[start], first * sizeof(int16_t));
+		memcpy(out + first, &d_samples[0], (n - first) * sizeof(int16_t));
+		d_tail.store(tail + n, std::memory_order_release);
+		return n;
+	}
+
+	// Consumer side. Drops everything queued so far.
+	void clear() { d_tail.store(d_head.load(std::memory_order_acquire), std::memory_order_release); }
+
+	size_t size() const { return d_head.load(std::memory_order_acquire) - d_tail.load(std::memory_order_acquire); }
+	bool empty() const { return size() == 0; }
+	size_t capacity() const { return d_samples.size(); }
+	size_t pushed() const { return d_head.load(std::memory_order_acquire); } // total samples ever queued
+	size_t popped() const { return d_tail.load(std::memory_order_acquire); } // total samples ever taken out
+	long overflows() const { return d_overflows.load(std::memory_order_relaxed); }
+
+private:
+	static size_t round_up(size_t n)
+	{
+		size_t size = 1;
+		while (size < n)
+			size <<= 1;
+		return size;
+	}
+
+	std::vector<int16_t> d_samples;
+	const size_t d_mask;
+	alignas(64) std::atomic<size_t> d_head;   // written by the producer
+	alignas(64) std::atomic<size_t> d_tail;   // written by the consumer
+	std::atomic<long> d_overflows;
+};
+
+// A codec frame standing in for the silent frame queued at pushed() == pos.
+// The frame assemblers turn these into codec_frame tags as the audio goes out.
+struct deferred_codec_frame {
+	size_t pos;
+	gr::op25_repeater::codec_frame frame;
+};
+
+typedef std::vector<deferred_codec_frame> deferred_codec_frames;
+
+// Used by the decoders in place of synthesis when the vocoder is deferred
+inline void defer_codec_frame(audio_ring &ring, deferred_codec_frames &frames, int codec_type, const uint32_t *params, int param_count, int e0, int e1)
+{
+	static const int16_t silence[gr::op25_repeater::CODEC_FRAME_SAMPLES] = {0};
+	deferred_codec_frame deferred;
+	deferred.pos = ring.pushed();
+	deferred.frame.codec_type = codec_type;
+	deferred.frame.param_count = param_count;
+	deferred.frame.e0 = std::min(e0, 255);
+	deferred.frame.e1 = std::min(e1, 255);
+	memset(deferred.frame.params, 0, sizeof(deferred.frame.params));
+	memcpy(deferred.frame.params, params, std::min(param_count, 8) * sizeof(uint32_t));
+	frames.push_back(deferred);
+	ring.push_back(silence, gr::op25_repeater::CODEC_FRAME_SAMPLES);
+}
+
+#endif /* INCLUDED_OP25_REPEATER_AUDIO_RING_H */
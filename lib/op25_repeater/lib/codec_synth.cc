@@ -0,0 +1,192 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <string.h>
+
+#include "../include/op25_repeater/codec_frame.h"
+#include "mbelib.h"
+#include "ambe.h"
+#include "p25p2_vf.h"
+#include "software_imbe_decoder.h"
+#include "imbe_vocoder/imbe_vocoder.h"
+
+namespace gr {
+    namespace op25_repeater {
+
+        // Decoder state for one stream. The steps below follow the live decoders
+        // (p25p1_fdma, p25p2_tdma and rx_sync) so deferred audio matches them.
+        struct codec_synth::impl {
+            bool soft_vocoder;
+            software_imbe_decoder software_decoder;
+            imbe_vocoder vocoder;
+            p25p2_vf vf;
+            mbe_parms cur_mp;
+            mbe_parms prev_mp;
+            mbe_parms enh_mp;
+            mbe_tone tone_mp;
+            mbe_errs errs_mp;
+            int mbe_err_cnt;
+            bool tone_frame;
+
+            impl(bool soft, bool fast) : soft_vocoder(soft), mbe_err_cnt(0), tone_frame(false)
+            {
+                software_decoder.set_fast_synthesis(fast);
+                mbe_initMbeParms(&cur_mp, &prev_mp, &enh_mp);
+                mbe_initToneParms(&tone_mp);
+                mbe_initErrParms(&errs_mp);
+            }
+
+            void decode_imbe(const codec_frame &frame, int16_t *out);
+            void decode_p25_ambe(const codec_frame &frame, int16_t *out);
+            void decode_dmr_ambe(const codec_frame &frame, int16_t *out);
+            int dequantize_ambe(const codec_frame &frame, int *u);
+        };
+
+        codec_synth::codec_synth(bool soft_vocoder, bool fast_vocoder) :
+            d_impl(new impl(soft_vocoder, fast_vocoder))
+        {
+        }
+
+        codec_synth::~codec_synth()
+        {
+            delete d_impl;
+        }
+
+        bool
+        codec_synth::decode(const codec_frame &frame, int16_t *out)
+        {
+            memset(out, 0, CODEC_FRAME_SAMPLES * sizeof(int16_t));
+            switch (frame.codec_type) {
+            case CODEC_P25_IMBE:
+                d_impl->decode_imbe(frame, out);
+                return true;
+            case CODEC_P25_AMBE:
+                d_impl->decode_p25_ambe(frame, out);
+                return true;
+            case CODEC_DMR_AMBE:
+                d_impl->decode_dmr_ambe(frame, out);
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        // As p25p1_fdma::process_voice()
+        void
+        codec_synth::impl::decode_imbe(const codec_frame &frame, int16_t *out)
+        {
+            const uint32_t *u = frame.params;
+            if (soft_vocoder) {
+                software_decoder.decode_fullrate(out, u[0], u[1], u[2], u[3], u[4], u[5], u[6], u[7], frame.e0, frame.e1);
+            } else {
+                int16_t frame_vector[8];
+                for (int i = 0; i < 8; i++) {
+                    frame_vector[i] = u[i] & 0xFFFF;
+                }
+                frame_vector[7] >>= 1;
+                vocoder.imbe_decode(frame_vector, out);
+            }
+        }
+
+        // The running error rate and the tone / frame repeat handling shared by
+        // both AMBE paths. Returns 0 if there are parameters to synthesize.
+        int
+        codec_synth::impl::dequantize_ambe(const codec_frame &frame, int *u)
+        {
+            int b[9];
+            for (int i = 0; i < 4; i++) {
+                u[i] = frame.params[i];
+            }
+            vf.unpack_b(b, u);
+            errs_mp.E0 = frame.e0;
+            errs_mp.E1 = frame.e1;
+            errs_mp.ER = (0.95 * errs_mp.ER) + (0.001064 * (double)(frame.e0 + frame.e1));
+
+            int rc = mbe_dequantizeAmbeTone(&tone_mp, &errs_mp, u);
+            if (rc >= 0) {                          // Tone Frame
+                if (rc == 0) {                      // Valid Tone
+                    tone_frame = true;
+                    mbe_err_cnt = 0;
+                } else if ((++mbe_err_cnt < 4) && tone_frame) {
+                    mbe_useLastMbeParms(&cur_mp, &prev_mp);
+                    rc = 0;
+                } else {
+                    tone_frame = false;
+                    rc = -1;
+                }
+            } else {
+                rc = mbe_dequantizeAmbe2250Parms(&cur_mp, &prev_mp, &errs_mp, b);
+                if (rc == 0) {                      // Voice Frame
+                    tone_frame = false;
+                    mbe_err_cnt = 0;
+                } else if ((++mbe_err_cnt < 4) && !tone_frame) {
+                    mbe_useLastMbeParms(&cur_mp, &prev_mp);
+                    rc = 0;
+                } else {
+                    tone_frame = false;
+                }
+            }
+            if (errs_mp.ER > 0.096)                 // Mute if error rate exceeds threshold
+                rc = -1;
+            return rc;
+        }
+
+        // As p25p2_tdma::handle_voice_frame()
+        void
+        codec_synth::impl::decode_p25_ambe(const codec_frame &frame, int16_t *out)
+        {
+            int u[4];
+            if (dequantize_ambe(frame, u) == 0) {
+                if (tone_frame) {
+                    software_decoder.decode_tone(out, tone_mp.ID, tone_mp.AD, &tone_mp.n);
+                } else if (soft_vocoder) {
+                    int K = 12;
+                    if (cur_mp.L <= 36)
+                        K = int(float(cur_mp.L + 2.0) / 3.0);
+                    software_decoder.decode_tap(out, cur_mp.L, K, cur_mp.w0, &cur_mp.Vl[1], &cur_mp.Ml[1]);
+                } else {
+                    vocoder.decode_tap(out, cur_mp.L, cur_mp.w0, &cur_mp.Vl[1], &cur_mp.Ml[1]);
+                }
+            }
+            mbe_moveMbeParms(&cur_mp, &prev_mp);
+            mbe_moveMbeParms(&cur_mp, &enh_mp);
+        }
+
+        // As rx_sync::codeword() for CODEWORD_DMR
+        void
+        codec_synth::impl::decode_dmr_ambe(const codec_frame &frame, int16_t *out)
+        {
+            int u[4];
+            tone_frame = false;     // rx_sync keeps do_tone per frame, not per stream
+            bool do_silence = (dequantize_ambe(frame, u) != 0);
+            if (tone_frame && !do_silence) {
+                software_decoder.decode_tone(out, tone_mp.ID, tone_mp.AD, &tone_mp.n);
+                return;
+            }
+            mbe_moveMbeParms(&cur_mp, &prev_mp);
+            if (do_silence)
+                return;
+            if (soft_vocoder) {
+                software_decoder.decode_tap(out, cur_mp.L, 0, cur_mp.w0, &cur_mp.Vl[1], &cur_mp.Ml[1]);
+            } else {
+                vocoder.decode_tap(out, cur_mp.L, cur_mp.w0, &cur_mp.Vl[1], &cur_mp.Ml[1]);
+            }
+        }
+
+    } /* namespace op25_repeater */
+} /* namespace gr */
@@ -0,0 +1,195 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <gnuradio/io_signature.h>
+#include <gnuradio/math.h>
+#include <gnuradio/expj.h>
+#include <volk/volk.h>
+#include "cqpsk_demod_cf_impl.h"
+
+namespace gr {
+    namespace op25_repeater {
+
+        static const int NUM_COMPLEX = 100; // delay line size, as in gardner_cc
+
+        cqpsk_demod_cf::sptr
+        cqpsk_demod_cf::make(float samples_per_symbol, float gain_mu, float gain_omega, float costas_loop_bw)
+        {
+            return gnuradio::get_initial_sptr
+                (new cqpsk_demod_cf_impl(samples_per_symbol, gain_mu, gain_omega, costas_loop_bw));
+        }
+
+        cqpsk_demod_cf_impl::cqpsk_demod_cf_impl(float samples_per_symbol, float gain_mu, float gain_omega, float costas_loop_bw)
+            : gr::block("cqpsk_demod_cf",
+                    gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                    gr::io_signature::make(1, 1, sizeof(float))),
+            d_mu(0),
+            d_gain_omega(gain_omega),
+            d_omega_rel(0.002),
+            d_gain_mu(gain_mu),
+            d_last_sample(0),
+            d_dl(NUM_COMPLEX, gr_complex(0, 0)),
+            d_dl_index(0),
+            d_prev_symbol(0),
+            d_phase(0),
+            d_freq(0),
+            d_max_phase(M_PI / 2)
+        {
+            // Critically damped, as costas_loop_cc::update_gains()
+            float damping = sqrtf(2.0f) / 2.0f;
+            float denom = (1.0 + 2.0 * damping * costas_loop_bw + costas_loop_bw * costas_loop_bw);
+            d_alpha = (4 * damping * costas_loop_bw) / denom;
+            d_beta = (4 * costas_loop_bw * costas_loop_bw) / denom;
+
+            set_omega(samples_per_symbol);
+            set_relative_rate(1.0 / d_omega);
+        }
+
+        cqpsk_demod_cf_impl::~cqpsk_demod_cf_impl()
+        {
+        }
+
+        void
+        cqpsk_demod_cf_impl::reset()
+        {
+            gr::thread::scoped_lock lock(d_mutex);
+            d_last_sample = 0;
+            d_phase = 0;
+            d_freq = 0;
+        }
+
+        void
+        cqpsk_demod_cf_impl::set_omega(float omega)
+        {
+            gr::thread::scoped_lock lock(d_mutex);
+            d_omega = omega;
+            float min_omega = omega * (1.0 - d_omega_rel);
+            float max_omega = omega * (1.0 + d_omega_rel);
+            d_omega_mid = 0.5 * (min_omega + max_omega);
+            d_twice_sps = 2 * (int) ceilf(d_omega);
+            int num_complex = std::max(d_twice_sps * 2, 16);
+            if (num_complex > NUM_COMPLEX)
+                fprintf(stderr, "cqpsk_demod_cf: warning omega %f size %d exceeds NUM_COMPLEX %d\n", omega, num_complex, NUM_COMPLEX);
+            d_dl[0] = gr_complex(0, 0);
+        }
+
+        void
+        cqpsk_demod_cf_impl::forecast(int noutput_items, gr_vector_int &ninput_items_required)
+        {
+            unsigned ninputs = ninput_items_required.size();
+            for (unsigned i = 0; i < ninputs; i++)
+                ninput_items_required[i] = (int) ceil((noutput_items * d_omega) + d_interp.ntaps());
+        }
+
+        // Differential decode and carrier correct one symbol from the timing loop
+        gr_complex
+        cqpsk_demod_cf_impl::next_symbol(const gr_complex &interp_samp)
+        {
+            gr_complex diff = interp_samp * std::conj(d_prev_symbol);
+            d_prev_symbol = interp_samp;
+
+            gr_complex sample = diff * gr_expj(-d_phase);
+
+            float error = ((sample.real() > 0 ? 1.0 : -1.0) * sample.imag() -
+                           (sample.imag() > 0 ? 1.0 : -1.0) * sample.real());
+            error = gr::branchless_clip(error, 1.0);
+
+            d_freq = d_freq + d_beta * error;
+            d_phase = d_phase + d_freq + d_alpha * error;
+            if (d_phase > d_max_phase)
+                d_phase = d_max_phase;
+            else if (d_phase < -d_max_phase)
+                d_phase = -d_max_phase;
+            if (d_freq > 1.0)
+                d_freq = 1.0;
+            else if (d_freq < -1.0)
+                d_freq = -1.0;
+
+            return sample;
+        }
+
+        int
+        cqpsk_demod_cf_impl::general_work(int noutput_items,
+                gr_vector_int &ninput_items,
+                gr_vector_const_void_star &input_items,
+                gr_vector_void_star &output_items)
+        {
+            gr::thread::scoped_lock lock(d_mutex);
+            const gr_complex *in = (const gr_complex *) input_items[0];
+            float *out = (float *) output_items[0];
+
+            if (d_symbols.size() < (size_t) noutput_items)
+                d_symbols.resize(noutput_items);
+
+            int i = 0, o = 0;
+
+            while ((o < noutput_items) && (i < ninput_items[0])) {
+                while ((d_mu > 1.0) && (i < ninput_items[0])) {
+                    d_mu --;
+                    d_dl[d_dl_index] = (in[i] == in[i]) ? in[i] : gr_complex(0, 0);                // Check for NaN values
+                    d_dl[d_dl_index + d_twice_sps] = (in[i] == in[i]) ? in[i] : gr_complex(0, 0);  // and set to 0
+                    d_dl_index ++;
+                    d_dl_index = d_dl_index % d_twice_sps;
+                    i++;
+                }
+
+                if (i < ninput_items[0]) {
+                    float half_omega = d_omega / 2.0;
+                    int half_sps = (int) floorf(half_omega);
+                    float half_mu = d_mu + half_omega - (float) half_sps;
+                    if (half_mu > 1.0) {
+                        half_mu -= 1.0;
+                        half_sps += 1;
+                    }
+                    gr_complex interp_samp_mid = d_interp.interpolate(&d_dl[d_dl_index], d_mu);
+                    gr_complex interp_samp = d_interp.interpolate(&d_dl[d_dl_index + half_sps], half_mu);
+
+                    float error_real = (d_last_sample.real() - interp_samp.real()) * interp_samp_mid.real();
+                    float error_imag = (d_last_sample.imag() - interp_samp.imag()) * interp_samp_mid.imag();
+                    d_last_sample = interp_samp;
+                    float symbol_error = error_real + error_imag; // Gardner loop error
+                    if (std::isnan(symbol_error)) symbol_error = 0.0;
+                    if (symbol_error < -1.0) symbol_error = -1.0;
+                    if (symbol_error >  1.0) symbol_error =  1.0;
+
+                    d_omega = d_omega + (d_gain_omega * symbol_error * abs(interp_samp));
+                    d_omega = d_omega_mid + gr::branchless_clip(d_omega - d_omega_mid, d_omega_rel);
+
+                    d_mu += d_omega + d_gain_mu * symbol_error;
+
+                    d_symbols[o++] = next_symbol(interp_samp);
+                }
+            }
+
+            // Phase in radians scaled so the symbols land on -3/-1/+1/+3
+            if (o > 0)
+                volk_32fc_s32f_atan2_32f(out, &d_symbols[0], M_PI / 4, o);
+
+            consume_each(i);
+            return o;
+        }
+
+    } /* namespace op25_repeater */
+} /* namespace gr */
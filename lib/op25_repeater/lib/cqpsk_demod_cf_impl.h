@@ -0,0 +1,74 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_OP25_REPEATER_CQPSK_DEMOD_CF_IMPL_H
+#define INCLUDED_OP25_REPEATER_CQPSK_DEMOD_CF_IMPL_H
+
+#include "../include/op25_repeater/cqpsk_demod_cf.h"
+#include <gnuradio/filter/mmse_fir_interpolator_cc.h>
+#include <gnuradio/thread/thread.h>
+#include <vector>
+
+namespace gr {
+    namespace op25_repeater {
+
+        class cqpsk_demod_cf_impl : public cqpsk_demod_cf
+        {
+            private:
+                // Symbol timing, as gardner_cc
+                float d_mu;
+                float d_omega, d_gain_omega, d_omega_rel, d_omega_mid;
+                float d_gain_mu;
+                int d_twice_sps;
+                gr_complex d_last_sample;
+                gr::filter::mmse_fir_interpolator_cc d_interp;
+                std::vector<gr_complex> d_dl;
+                int d_dl_index;
+
+                // Differential decode, as diff_phasor_cc
+                gr_complex d_prev_symbol;
+
+                // Carrier recovery, as costas_loop_cc with the fourth order detector
+                float d_alpha, d_beta;
+                float d_phase, d_freq;
+                float d_max_phase;
+
+                std::vector<gr_complex> d_symbols; // corrected symbols waiting to be turned into levels
+                gr::thread::mutex d_mutex;
+
+                gr_complex next_symbol(const gr_complex &interp_samp);
+
+            public:
+                cqpsk_demod_cf_impl(float samples_per_symbol, float gain_mu, float gain_omega, float costas_loop_bw);
+                ~cqpsk_demod_cf_impl();
+
+                void set_omega(float omega);
+                void reset();
+
+                void forecast(int noutput_items, gr_vector_int &ninput_items_required);
+
+                int general_work(int noutput_items,
+                        gr_vector_int &ninput_items,
+                        gr_vector_const_void_star &input_items,
+                        gr_vector_void_star &output_items);
+        };
+
+    } // namespace op25_repeater
+} // namespace gr
+
+#endif /* INCLUDED_OP25_REPEATER_CQPSK_DEMOD_CF_IMPL_H */
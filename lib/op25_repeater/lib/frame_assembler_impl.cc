@@ -85,6 +85,48 @@ namespace gr {
                 d_sync->set_voice_codec_callback(cb, user_data);
         }
 
+        void frame_assembler_impl::set_control_ring(control_frame_ring *ring) {
+            if (d_sync)
+                d_sync->set_control_ring(ring);
+        }
+
+        void frame_assembler_impl::set_deferred_vocoder(bool deferred) {
+            if (d_sync)
+                d_sync->set_deferred_frames(deferred ? &d_deferred_frames : NULL);
+        }
+
+        void frame_assembler_impl::set_fast_vocoder(bool fast) {
+            if (d_sync)
+                d_sync->set_fast_vocoder(fast);
+        }
+
+        // Tag the deferred frames that went out in the n samples starting at ring
+        // position start, all in one tag on the first of them
+        void frame_assembler_impl::tag_codec_frames(int slot_id, size_t start, int n) {
+            deferred_codec_frames &frames = d_deferred_frames[slot_id];
+            size_t i = 0;
+            d_codec_batch.clear();
+            for (; i < frames.size(); i++) {
+                if (frames[i].pos >= start + n)
+                    break;
+                if (frames[i].pos >= start) {
+                    tagged_codec_frame tagged;
+                    tagged.offset = frames[i].pos - start;
+                    tagged.frame = frames[i].frame;
+                    d_codec_batch.push_back(tagged);
+                }
+            }
+            frames.erase(frames.begin(), frames.begin() + i);
+
+            if (!d_codec_batch.empty()) {
+                uint32_t first = d_codec_batch[0].offset;
+                for (size_t j = 0; j < d_codec_batch.size(); j++) {
+                    d_codec_batch[j].offset -= first;
+                }
+                add_item_tag(slot_id, nitems_written(slot_id) + first, d_codec_frame_key, pmt::make_blob(d_codec_batch.data(), d_codec_batch.size() * sizeof(tagged_codec_frame)), pmt::intern(name()));
+            }
+        }
+
         void frame_assembler_impl::set_debug(int debug) {
             if (d_sync)
                 d_sync->set_debug(debug);
@@ -120,6 +162,8 @@ namespace gr {
             d_msgq_id(msgq_id),
             d_msg_queue(queue),
             output_queue(),
+            d_audio_overflows(0),
+            d_codec_frame_key(pmt::intern("codec_frames")),
             d_sync(NULL)
         {
             if (strcasecmp(options, "smartnet") == 0)
@@ -128,6 +172,9 @@ namespace gr {
                 d_sync = new rx_subchannel(options, logts, debug, msgq_id, queue);
             else
                 d_sync = new rx_sync(options, logts, debug, msgq_id, queue, output_queue, d_soft_vocoder);
+
+            // Enough for a full output buffer of frames, so tagging does not allocate
+            d_codec_batch.reserve(64);
         }
 
         int 
@@ -145,22 +192,12 @@ namespace gr {
                     }
                 }
         
-        int amt_produce = 0;
-
-        
-        
-/*
-          
-        if (amt_produce > (int)output_queue.size()) {
-          amt_produce = output_queue.size();
+        long audio_overflows = output_queue[0].overflows() + output_queue[1].overflows();
+        if (audio_overflows != d_audio_overflows) {
+          BOOST_LOG_TRIVIAL(error) << "DMR Frame Assembler - audio ring full, dropped " << (audio_overflows - d_audio_overflows) << " samples";
+          d_audio_overflows = audio_overflows;
         }
-*/  
-        produce(0, output_queue[0].size());
-        produce(1, output_queue[1].size());
 
-            if ((output_queue[0].size() > 0) || ( output_queue[1].size() > 0)) {
-        //BOOST_LOG_TRIVIAL(info) << "DMR Frame Assembler - Amt Prod: " << amt_produce << " output_queue 0: " << output_queue[0].size() << " output_queue 1: " << output_queue[1].size() <<" noutput_items: " <<  noutput_items;
-        }
         for (int slot_id = 0; slot_id < 2; slot_id++) {
           int16_t *out = (int16_t *)output_items[slot_id];
           int src_id = d_sync->get_src_id(slot_id);
@@ -183,12 +220,13 @@ namespace gr {
         if (terminated) {
             add_item_tag(0, nitems_written(0), pmt::intern("terminate"), pmt::from_long(1), pmt::intern(name()));
         }*/
-          for (int i = 0; i < output_queue[slot_id].size(); i++) {
-              //BOOST_LOG_TRIVIAL(info) << output_queue[slot_id][i];
-            out[i] = output_queue[slot_id][i];
+          // Whatever does not fit in the output buffer stays queued for the next call
+          size_t popped = output_queue[slot_id].popped();
+          int n = output_queue[slot_id].pop(out, noutput_items);
+          if (!d_deferred_frames[slot_id].empty()) {
+            tag_codec_frames(slot_id, popped, n);
           }
-          output_queue[slot_id].clear();
-          //output_queue[slot_id].erase(output_queue[slot_id].begin(), output_queue[slot_id].begin() + output_queue[slot_id].size());
+          produce(slot_id, n);
         }
 
         //BOOST_LOG_TRIVIAL(info) << "DMR Frame Assembler - Amt Prod: " << amt_produce << " output_items 0: " << len(output_items[0]) << " output_items 1: " << len(output_items[1]) <<" noutput_items: " <<  noutput_items;
@@ -31,6 +31,7 @@
 #include <deque>
 #include <array>
 #include "rx_base.h"
+#include "audio_ring.h"
 #include "log_ts.h"
 
 typedef std::deque<uint8_t> dibit_queue;
@@ -44,8 +45,11 @@ namespace gr {
                 int d_debug;
                 int d_msgq_id;
                 gr::msg_queue::sptr d_msg_queue;
-                //std::deque<int16_t> output_queue[2];
-                std::array<std::deque<int16_t>, 2> output_queue;
+                std::array<audio_ring, 2> output_queue;
+                long d_audio_overflows;
+                std::array<deferred_codec_frames, 2> d_deferred_frames;
+                std::vector<tagged_codec_frame> d_codec_batch;  // reused to pack each call's frames into one tag
+                pmt::pmt_t d_codec_frame_key;
                 rx_base* d_sync;
 
                 // internal functions
@@ -59,6 +63,10 @@ namespace gr {
                 void crypt_reset();
                 void crypt_key(uint16_t keyid, uint8_t algid, const std::vector<uint8_t> &key);
                 void set_voice_codec_callback(voice_codec_cb_t cb, void *user_data);
+                void set_control_ring(control_frame_ring *ring);
+                void set_deferred_vocoder(bool deferred);
+                void set_fast_vocoder(bool fast);
+                void tag_codec_frames(int slot_id, size_t start, int n);
 
             public:
                 log_ts logts;
@@ -0,0 +1,268 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+#include <gnuradio/io_signature.h>
+#include <gnuradio/math.h>
+#include <volk/volk.h>
+#include "fsk4_demod_cf_impl.h"
+#include "fsk4_interpolator_taps.h"
+
+namespace gr {
+    namespace op25_repeater {
+
+        static const int SYMBOL_FILTER_LEN = 5; // fir_filter_fff boxcar used after the noise filter
+
+        fsk4_demod_cf::sptr
+        fsk4_demod_cf::make(float sample_rate_Hz, float symbol_rate_Hz, float deviation_Hz, const std::vector<float> &filter_taps)
+        {
+            return gnuradio::get_initial_sptr
+                (new fsk4_demod_cf_impl(sample_rate_Hz, symbol_rate_Hz, deviation_Hz, filter_taps));
+        }
+
+        fsk4_demod_cf_impl::fsk4_demod_cf_impl(float sample_rate_Hz, float symbol_rate_Hz, float deviation_Hz, const std::vector<float> &filter_taps)
+            : gr::block("fsk4_demod_cf",
+                    gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                    gr::io_signature::make(1, 1, sizeof(float))),
+            d_phase(0),
+            d_freq(0),
+            d_block_rate(sample_rate_Hz / symbol_rate_Hz),
+            d_symbol_clock(0.0),
+            d_symbol_spread(2.0), // nominal symbol spread of 2.0 gives outputs at -3, -1, +1, +3
+            d_symbol_time(symbol_rate_Hz / sample_rate_Hz),
+            d_fine_frequency_correction(0.0),
+            d_coarse_frequency_correction(0.0)
+        {
+            // PLL settings used in front of fsk4_demod_ff by trunk-recorder
+            const double freq_to_norm_radians = M_PI / (sample_rate_Hz / 2.0);
+            const float loop_bw = (symbol_rate_Hz / 2.0 * 1.2) * freq_to_norm_radians;
+            const float damping = sqrtf(2.0f) / 2.0f;
+            float denom = (1.0 + 2.0 * damping * loop_bw + loop_bw * loop_bw);
+            d_alpha = (4 * damping * loop_bw) / denom;
+            d_beta = (4 * loop_bw * loop_bw) / denom;
+            d_max_freq = (3 * deviation_Hz * 1.9) * freq_to_norm_radians;
+            d_min_freq = (-3 * deviation_Hz * 1.9) * freq_to_norm_radians;
+            d_pll_gain = 1.0 / (deviation_Hz * freq_to_norm_radians);
+
+            // The noise filter and the boxcar are both linear, so run them as one FIR
+            std::vector<float> combined(filter_taps.size() + SYMBOL_FILTER_LEN - 1, 0.0);
+            for (size_t i = 0; i < filter_taps.size(); i++) {
+                for (int j = 0; j < SYMBOL_FILTER_LEN; j++) {
+                    combined[i + j] += filter_taps[i] * (1.0 / SYMBOL_FILTER_LEN);
+                }
+            }
+            d_taps.assign(combined.rbegin(), combined.rend());
+
+            d_baseband.assign(d_taps.size() - 1, 0.0);
+            d_filtered.assign(NTAPS - 1, 0.0);
+        }
+
+        fsk4_demod_cf_impl::~fsk4_demod_cf_impl()
+        {
+        }
+
+        /*
+         * Reset tracking loops.
+         */
+        void
+        fsk4_demod_cf_impl::reset()
+        {
+            d_phase = 0;
+            d_freq = 0;
+            d_fine_frequency_correction = 0.0;
+            d_coarse_frequency_correction = 0.0;
+            d_symbol_clock = 0.0;
+            d_symbol_spread = 2.0;
+        }
+
+        void
+        fsk4_demod_cf_impl::forecast(int noutput_items, gr_vector_int &ninput_items_required)
+        {
+            const int nof_samples_reqd = static_cast<int>(ceil(d_block_rate * noutput_items));
+            std::fill(ninput_items_required.begin(), ninput_items_required.end(), nof_samples_reqd);
+        }
+
+        void
+        fsk4_demod_cf_impl::resize_buffers(int n)
+        {
+            // Only grows, so steady state work calls do not allocate
+            if (d_baseband.size() < d_taps.size() - 1 + n) {
+                d_baseband.resize(d_taps.size() - 1 + n);
+            }
+            if (d_filtered.size() < (size_t) (NTAPS - 1 + n)) {
+                d_filtered.resize(NTAPS - 1 + n);
+            }
+        }
+
+        int
+        fsk4_demod_cf_impl::general_work(int noutput_items,
+                gr_vector_int &ninput_items,
+                gr_vector_const_void_star &input_items,
+                gr_vector_void_star &output_items)
+        {
+            const gr_complex *in = (const gr_complex *) input_items[0];
+            float *out = (float *) output_items[0];
+            int consumed = 0;
+            int produced = 0;
+
+            // Every input sample gives at most one symbol, so a chunk no longer
+            // than the space left in the output can always be finished
+            while ((consumed < ninput_items[0]) && (produced < noutput_items)) {
+                int n = std::min(ninput_items[0] - consumed, noutput_items - produced);
+                produced += demodulate(in + consumed, n, out + produced);
+                consumed += n;
+            }
+
+            consume_each(consumed);
+            return produced;
+        }
+
+        int
+        fsk4_demod_cf_impl::demodulate(const gr_complex *in, int n, float *out)
+        {
+            const size_t fir_history = d_taps.size() - 1;
+            const size_t mmse_history = NTAPS - 1;
+            resize_buffers(n);
+            float *baseband = &d_baseband[fir_history];
+            float *filtered = &d_filtered[mmse_history];
+
+            // FM demodulate. The loop feeds back on every sample, so it stays scalar.
+            for (int i = 0; i < n; i++) {
+                baseband[i] = d_freq * d_pll_gain;
+
+                float error = gr::fast_atan2f(in[i].imag(), in[i].real()) - d_phase;
+                if (error > GR_M_PI)
+                    error -= 2.0 * GR_M_PI;
+                else if (error < -GR_M_PI)
+                    error += 2.0 * GR_M_PI;
+
+                d_freq = d_freq + d_beta * error;
+                d_phase = d_phase + d_freq + d_alpha * error;
+                while (d_phase > (2 * GR_M_PI))
+                    d_phase -= 2 * GR_M_PI;
+                while (d_phase < (-2 * GR_M_PI))
+                    d_phase += 2 * GR_M_PI;
+                if (d_freq > d_max_freq)
+                    d_freq = d_max_freq;
+                else if (d_freq < d_min_freq)
+                    d_freq = d_min_freq;
+            }
+
+            // Baseband and symbol filters
+            for (int i = 0; i < n; i++) {
+                volk_32f_x2_dot_prod_32f(&filtered[i], &d_baseband[i], &d_taps[0], d_taps.size());
+            }
+
+            // Symbol timing
+            int nout = 0;
+            for (int i = 0; i < n; i++) {
+                if (track_symbol(&d_filtered[i], &out[nout])) {
+                    nout++;
+                }
+            }
+
+            // Keep the tail of each buffer as the history for the next call
+            memmove(&d_baseband[0], &d_baseband[n], fir_history * sizeof(float));
+            memmove(&d_filtered[0], &d_filtered[n], mmse_history * sizeof(float));
+
+            return nout;
+        }
+
+        // history points at the last NTAPS filtered samples, oldest first. This is
+        // fsk4_demod_ff_impl::tracking_loop_mmse() working on a linear buffer.
+        bool
+        fsk4_demod_cf_impl::track_symbol(const float *history, float *output)
+        {
+            d_symbol_clock += d_symbol_time;
+
+            if (d_symbol_clock <= 1.0)
+                return false;
+
+            d_symbol_clock -= 1.0;
+
+            int imu = (int) floor(0.5 + (NSTEPS * ((d_symbol_clock / d_symbol_time))));
+            int imu_p1 = imu + 1;
+            if (imu >= NSTEPS) {
+                imu = NSTEPS - 1;
+                imu_p1 = NSTEPS;
+            }
+
+            double interp = 0.0;
+            double interp_p1 = 0.0;
+            for (int i = 0; i < NTAPS; i++) {
+                interp    += TAPS[imu   ][i] * history[i];
+                interp_p1 += TAPS[imu_p1][i] * history[i];
+            }
+
+            interp -= d_fine_frequency_correction;
+            interp_p1 -= d_fine_frequency_correction;
+
+            *output = 2.0 * interp / d_symbol_spread;
+
+            double symbol_error;
+            const double K_SYMBOL_SPREAD = 0.0100; // tracking loop gain constant
+
+            if (interp < - d_symbol_spread) {
+                // symbol is -3: Expected at -1.5 * symbol_spread
+                symbol_error = interp + (1.5 * d_symbol_spread);
+                d_symbol_spread -= (symbol_error * 0.5 * K_SYMBOL_SPREAD);
+            } else if (interp < 0.0) {
+                // symbol is -1: Expected at -0.5 * symbol_spread
+                symbol_error = interp + (0.5 * d_symbol_spread);
+                d_symbol_spread -= (symbol_error * K_SYMBOL_SPREAD);
+            } else if (interp < d_symbol_spread) {
+                // symbol is +1: Expected at +0.5 * symbol_spread
+                symbol_error = interp - (0.5 * d_symbol_spread);
+                d_symbol_spread += (symbol_error * K_SYMBOL_SPREAD);
+            } else {
+                // symbol is +3: Expected at +1.5 * symbol_spread
+                symbol_error = interp - (1.5 * d_symbol_spread);
+                d_symbol_spread += (symbol_error * 0.5 * K_SYMBOL_SPREAD);
+            }
+
+            // symbol clock tracking loop gain
+            const double K_SYMBOL_TIMING = 0.025;
+            if (interp_p1 < interp) {
+                d_symbol_clock += symbol_error * K_SYMBOL_TIMING;
+            } else {
+                d_symbol_clock -= symbol_error * K_SYMBOL_TIMING;
+            }
+
+            // constrain symbol spread to +/- 20% of nominal 2.0
+            const double SYMBOL_SPREAD_MAX = 2.4;
+            const double SYMBOL_SPREAD_MIN = 1.6;
+            d_symbol_spread = std::max(d_symbol_spread, SYMBOL_SPREAD_MIN);
+            d_symbol_spread = std::min(d_symbol_spread, SYMBOL_SPREAD_MAX);
+
+            static const double K_COARSE_FREQUENCY = 0.00125;
+            d_coarse_frequency_correction += ((d_fine_frequency_correction - d_coarse_frequency_correction) * K_COARSE_FREQUENCY);
+
+            static const double K_FINE_FREQUENCY = 0.125;
+            d_fine_frequency_correction += (symbol_error * K_FINE_FREQUENCY);
+
+            return true;
+        }
+
+    } /* namespace op25_repeater */
+} /* namespace gr */
@@ -0,0 +1,76 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_OP25_REPEATER_FSK4_DEMOD_CF_IMPL_H
+#define INCLUDED_OP25_REPEATER_FSK4_DEMOD_CF_IMPL_H
+
+#include "../include/op25_repeater/fsk4_demod_cf.h"
+
+namespace gr {
+    namespace op25_repeater {
+
+        class fsk4_demod_cf_impl : public fsk4_demod_cf
+        {
+            private:
+                // PLL frequency detector, same loop as gr::analog::pll_freqdet_cf
+                float d_alpha;
+                float d_beta;
+                float d_phase;
+                float d_freq;
+                float d_max_freq;
+                float d_min_freq;
+                float d_pll_gain;
+
+                // Noise filter convolved with the symbol averaging filter, stored
+                // reversed so each output is one dot product over the input
+                std::vector<float> d_taps;
+
+                // Symbol timing, same loop as fsk4_demod_ff
+                float d_block_rate;
+                double d_symbol_clock;
+                double d_symbol_spread;
+                float d_symbol_time;
+                double d_fine_frequency_correction;
+                double d_coarse_frequency_correction;
+
+                // Work buffers, each starting with the history the next stage needs
+                std::vector<float> d_baseband;  // d_taps.size() - 1 samples of history
+                std::vector<float> d_filtered;  // NTAPS - 1 samples of history
+
+                void resize_buffers(int n);
+                int demodulate(const gr_complex *in, int n, float *out);
+                bool track_symbol(const float *history, float *output);
+
+            public:
+                fsk4_demod_cf_impl(float sample_rate_Hz, float symbol_rate_Hz, float deviation_Hz, const std::vector<float> &filter_taps);
+                ~fsk4_demod_cf_impl();
+
+                void reset();
+
+                void forecast(int noutput_items, gr_vector_int &ninput_items_required);
+
+                int general_work(int noutput_items,
+                        gr_vector_int &ninput_items,
+                        gr_vector_const_void_star &input_items,
+                        gr_vector_void_star &output_items);
+        };
+
+    } // namespace op25_repeater
+} // namespace gr
+
+#endif /* INCLUDED_OP25_REPEATER_FSK4_DEMOD_CF_IMPL_H */
@@ -25,6 +25,7 @@
 #include <gnuradio/io_signature.h>
 #include "p25_frame_assembler_impl.h"
 
+#include <algorithm>
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -108,6 +109,9 @@ static const int MAX_IN = 1;	// maximum number of input streams
 	d_do_msgq(do_msgq),
 	d_msg_queue(queue),
 	output_queue(),
+	d_audio_overflows(0),
+	d_terminate_at(-1),
+	d_codec_frame_key(pmt::intern("codec_frames")),
 	op25audio(udp_host, port, debug),
   d_input_rate(4800),
   d_tag_src(pmt::intern(name())), 
@@ -127,6 +131,9 @@ static const int MAX_IN = 1;	// maximum number of input streams
 
       if (!d_do_audio_output && !d_do_imbe)
         set_output_multiple(160);
+
+      // Enough for a full output buffer of frames, so tagging does not allocate
+      d_codec_batch.reserve(64);
     }
 
 
@@ -145,6 +152,47 @@ static const int MAX_IN = 1;	// maximum number of input streams
       p2tdma.set_voice_codec_callback(cb, user_data);
     }
 
+    void p25_frame_assembler_impl::set_fast_vocoder(bool fast) {
+      p1fdma.set_fast_vocoder(fast);
+      p2tdma.set_fast_vocoder(fast);
+    }
+
+    void p25_frame_assembler_impl::set_deferred_vocoder(bool deferred) {
+      p1fdma.set_deferred_frames(deferred ? &d_deferred_frames : NULL);
+      p2tdma.set_deferred_frames(deferred ? &d_deferred_frames : NULL);
+    }
+
+    // Tag the deferred frames that went out in the n samples starting at ring
+    // position start, all in one tag on the first of them
+    void p25_frame_assembler_impl::tag_codec_frames(size_t start, int n) {
+      size_t i = 0;
+      d_codec_batch.clear();
+      for (; i < d_deferred_frames.size(); i++) {
+        const deferred_codec_frame &deferred = d_deferred_frames[i];
+        if (deferred.pos >= start + n)
+          break;
+        if (deferred.pos >= start) {
+          tagged_codec_frame tagged;
+          tagged.offset = deferred.pos - start;
+          tagged.frame = deferred.frame;
+          d_codec_batch.push_back(tagged);
+        }
+      }
+      d_deferred_frames.erase(d_deferred_frames.begin(), d_deferred_frames.begin() + i);
+
+      if (!d_codec_batch.empty()) {
+        uint32_t first = d_codec_batch[0].offset;
+        for (size_t j = 0; j < d_codec_batch.size(); j++) {
+          d_codec_batch[j].offset -= first;
+        }
+        add_item_tag(0, nitems_written(0) + first, d_codec_frame_key, pmt::make_blob(d_codec_batch.data(), d_codec_batch.size() * sizeof(tagged_codec_frame)), d_tag_src);
+      }
+    }
+
+    void p25_frame_assembler_impl::set_control_ring(control_frame_ring *ring) {
+      p1fdma.set_control_ring(ring);
+    }
+
 void p25_frame_assembler_impl::send_grp_src_id() {
           long tdma_src_id = -1;
           long tdma_grp_id = -1;
@@ -220,23 +268,35 @@ p25_frame_assembler_impl::general_work (int noutput_items,
 
       // If this block is being used for Trunking, then you want to skip all of this.
       if (d_do_audio_output) {
-        amt_produce = output_queue.size();
         int16_t *out = (int16_t *)output_items[0];
 
+        if (output_queue.overflows() != d_audio_overflows) {
+          BOOST_LOG_TRIVIAL(error) << "P25 Frame Assembler - audio ring full, dropped " << (output_queue.overflows() - d_audio_overflows) << " samples";
+          d_audio_overflows = output_queue.overflows();
+        }
+
+        // The TDU goes out with the audio that was queued ahead of it, which may
+        // take more than one call now that each call is limited to noutput_items
+        if (terminate_call.first) {
+          d_terminate_at = output_queue.popped() + terminate_call.second;
+        }
+
         //BOOST_LOG_TRIVIAL(trace) << "P25 Frame Assembler -  output_queue: " << output_queue.size() << " noutput_items: " <<  noutput_items << " ninput_items: " << ninput_items[0];
 
-        if (amt_produce > 0) {
-            if (amt_produce >= 32768) {
-              BOOST_LOG_TRIVIAL(error) << "P25 Frame Assembler -  output_queue size: " << output_queue.size() << " max size: " << output_queue.max_size() << " limiting amt_produce to  32767 ";
-              
-              amt_produce = 32767; // buffer limit is 32768, see gnuradio/gnuradio-runtime/lib/../include/gnuradio/buffer.h:186
-            }
+        size_t popped = output_queue.popped();
+        amt_produce = output_queue.pop(out, noutput_items);
+        if (!d_deferred_frames.empty()) {
+          tag_codec_frames(popped, amt_produce);
+        }
 
-            for (int i = 0; i < amt_produce; i++) {
-              out[i] = output_queue[i];
-            }
-            output_queue.erase(output_queue.begin(), output_queue.begin() + amt_produce);
+        if ((d_terminate_at >= 0) && ((long) output_queue.popped() >= d_terminate_at)) {
+          terminate_call = std::make_pair(true, (long) amt_produce - ((long) output_queue.popped() - d_terminate_at));
+          d_terminate_at = -1;
+        } else {
+          terminate_call.first = false;
+        }
 
+        if (amt_produce > 0) {
             send_grp_src_id();
 
             BOOST_LOG_TRIVIAL(trace) << "setting silence_frame_count " << silence_frame_count << " to d_silence_frames: " << d_silence_frames << std::endl;
@@ -259,14 +319,17 @@ p25_frame_assembler_impl::general_work (int noutput_items,
             if ((amt_produce != 1) && (terminate_call.second < amt_produce)) {
               BOOST_LOG_TRIVIAL(info) << "P25 Frame Assembler: TDU was not at the end of the data. TDU: " << terminate_call.second << " Amount: " << amt_produce << " nitems_written(0): " << nitems_written(0);  
             }
-            add_item_tag(0, nitems_written(0), pmt::intern("terminate"), pmt::from_long(1), d_tag_src );
+            // Tag the last sample of the transmission that ended, so the sink
+            // can tell it apart from any audio that follows it in this batch
+            long terminate_offset = std::max(0L, std::min(terminate_call.second, (long) amt_produce) - 1);
+            add_item_tag(0, nitems_written(0) + terminate_offset, pmt::intern("terminate"), pmt::from_long(1), d_tag_src );
             
             Rx_Status status = p1fdma.get_rx_status();
             
             // If something was recorded, send the number of Errors and Spikes that were counted during that period
             if (status.total_len > 0 ) {
-              add_item_tag(0, nitems_written(0), pmt::intern("spike_count"), pmt::from_long(status.spike_count), d_tag_src);
-              add_item_tag(0, nitems_written(0), pmt::intern("error_count"), pmt::from_long(status.error_count), d_tag_src);
+              add_item_tag(0, nitems_written(0) + terminate_offset, pmt::intern("spike_count"), pmt::from_long(status.spike_count), d_tag_src);
+              add_item_tag(0, nitems_written(0) + terminate_offset, pmt::intern("error_count"), pmt::from_long(status.error_count), d_tag_src);
               p1fdma.reset_rx_status();
             }
             if (silence_frame_count > 0) {
@@ -34,6 +34,7 @@
 #include "p25p1_fdma.h"
 #include "p25p2_tdma.h"
 #include "op25_audio.h"
+#include "audio_ring.h"
 #include "log_ts.h"
 
 typedef std::deque<uint8_t> dibit_queue;
@@ -70,7 +71,14 @@ namespace gr {
     void set_debug(int debug) ;
     void reset_timer() ;
 	typedef std::vector<bool> bit_vector;
-	std::deque<int16_t> output_queue;
+	audio_ring output_queue;
+	long d_audio_overflows;
+	long d_terminate_at;  // output_queue.popped() count the pending TDU follows, or -1
+	deferred_codec_frames d_deferred_frames;
+	std::vector<tagged_codec_frame> d_codec_batch;  // reused to pack each call's frames into one tag
+	pmt::pmt_t d_codec_frame_key;
+
+  void tag_codec_frames(size_t start, int n);
 
   void p25p2_queue_msg(int duid);
   void set_phase2_tdma(bool p);
@@ -91,6 +99,9 @@ public:
       void clear_silence_frame_count();
       void clear();
       void set_voice_codec_callback(voice_codec_cb_t cb, void *user_data);
+      void set_control_ring(control_frame_ring *ring);
+      void set_deferred_vocoder(bool deferred);
+      void set_fast_vocoder(bool fast);
       log_ts logts;
     };
 
@@ -206,7 +206,7 @@ namespace gr {
                 fprintf(stderr, "%s p25p1_fdma::set_nac: 0x%03x\n", logts.get(d_msgq_id), d_nac);
         }
 
-        p25p1_fdma::p25p1_fdma(const op25_audio& udp, log_ts& logger, int debug, bool do_imbe, bool do_output, bool do_msgq, gr::msg_queue::sptr queue, std::deque<int16_t> &output_queue, bool do_audio_output, bool soft_vocoder, int msgq_id) :
+        p25p1_fdma::p25p1_fdma(const op25_audio& udp, log_ts& logger, int debug, bool do_imbe, bool do_output, bool do_msgq, gr::msg_queue::sptr queue, audio_ring &output_queue, bool do_audio_output, bool soft_vocoder, int msgq_id) :
             write_bufp(0),
             d_debug(debug),
             d_do_imbe(do_imbe),
@@ -216,6 +216,7 @@ namespace gr {
             d_do_audio_output(do_audio_output),
             d_nac(0),
             d_msg_queue(queue),
+            d_control_ring(NULL),
             d_soft_vocoder(soft_vocoder),
             output_queue(output_queue),
             framer(new p25_framer(logger, debug, msgq_id)),
@@ -234,7 +235,8 @@ namespace gr {
 			terminate_call(std::pair<bool,long>(false,0)),
             p1voice_decode((debug > 0), udp, output_queue),
             voice_codec_cb_(NULL),
-            voice_codec_cb_data_(NULL)
+            voice_codec_cb_data_(NULL),
+            d_deferred_frames(NULL)
         {
 			rx_status.error_count = 0;
 			rx_status.total_len = 0;
@@ -280,7 +282,7 @@ namespace gr {
 			p1voice_decode.clear();
 		}
 
-        void p25p1_fdma::process_duid(uint32_t const duid, uint32_t const nac, const uint8_t* buf, const int len) {
+        void p25p1_fdma::process_duid(uint32_t const duid, uint32_t const nac, const uint8_t* buf, const int len, bool crc_ok) {
             char wbuf[256];
             int p = 0;
             if (!d_do_msgq)
@@ -292,6 +294,12 @@ namespace gr {
                 memcpy(&wbuf[p], buf, len);	// copy data
                 p += len;
             }
+            if (d_control_ring) {
+                d_control_ring->push(duid, nac, crc_ok, logts.get_ts(), (const uint8_t *)wbuf, p);
+                if (crc_ok)
+                    qtimer.reset();
+                return;
+            }
             send_msg(std::string(wbuf, p), duid);
             qtimer.reset();
         }
@@ -725,8 +733,11 @@ namespace gr {
             block_vector deinterleave_buf;
             if (process_blocks(fr, fr_len, deinterleave_buf) == 0) {
                 for (size_t j = 0; (j < deinterleave_buf.size()) && (lb == 0); j++) {
-                    if (crc16(deinterleave_buf[j].data(), 12) != 0) // validate CRC
+                    if (crc16(deinterleave_buf[j].data(), 12) != 0) { // validate CRC
+                        if (d_control_ring)
+                            process_duid(framer->duid, framer->nac, deinterleave_buf[j].data(), 10, false);
                         return;
+                    }
 
                     lb = deinterleave_buf[j][0] >> 7;	// last block flag
                     op = deinterleave_buf[j][0] & 0x3f;	// opcode
@@ -897,11 +908,14 @@ namespace gr {
                     if (voice_codec_cb_) {
                         voice_codec_cb_(0 /*CODEC_P25_IMBE*/, (long)vf_tgid,
                                         (cached_src_id > 0) ? (uint32_t)cached_src_id : 0,
-                                        u, 8, (int)errs, voice_codec_cb_data_);
+                                        u, 8, (int)errs, (int)E0, (int)ET, !audio_valid, voice_codec_cb_data_);
                     }
 
                     if (d_do_audio_output) {
-                        if ( !encrypted()) {
+                        if (!encrypted() && d_deferred_frames && !op25audio.enabled()) {
+                            // Keep the codewords and leave the audio to be synthesized later
+                            defer_codec_frame(output_queue, *d_deferred_frames, CODEC_P25_IMBE, u, 8, E0, ET);
+                        } else if ( !encrypted()) {
                             // This is the Vocoder that OP25 currently uses.
 
                             if (d_soft_vocoder) {
@@ -923,9 +937,7 @@ namespace gr {
                             if (op25audio.enabled()) {      // decoded audio goes out via UDP (normal code path)
                                 op25audio.send_audio(snd, SND_FRAME * sizeof(int16_t));
                             } else {                        // decoded audio back to gnuradio (still supported?)
-                                for (int i = 0; i < SND_FRAME; i++) {
-                                    output_queue.push_back(snd[i]);
-                                }
+                                output_queue.push_back(snd, SND_FRAME);
                             }
                         } else {
 		                    // For encrypted voice without a valid key, push silent audio frames
@@ -1081,6 +1093,10 @@ namespace gr {
                     }
 
                     qtimer.reset();
+                    if (d_control_ring) {
+                        d_control_ring->push(get_msg_type(PROTOCOL_P25, M_P25_TIMEOUT), 0, true, logts.get_ts(), NULL, 0);
+                        return;
+                    }
                     gr::message::sptr msg = gr::message::make(get_msg_type(PROTOCOL_P25, M_P25_TIMEOUT), (d_msgq_id << 1), logts.get_ts());
                     if (!d_msg_queue->full_p())
                         d_msg_queue->insert_tail(msg);
@@ -35,8 +35,10 @@
 #include "p25_crypt_algs.h"
 #include "p25p1_voice_encode.h"
 #include "p25p1_voice_decode.h"
+#include "audio_ring.h"
 #include <boost/log/trivial.hpp>
 #include "../include/op25_repeater/rx_status.h"
+#include "../include/op25_repeater/control_frame.h"
 #include "imbe_vocoder/imbe_vocoder.h" // for the original full rate vocoder
 
 namespace gr {
@@ -53,7 +55,7 @@ namespace gr {
 
                 // internal functions
                 bool header_codeword(uint64_t acc, uint32_t& nac, uint32_t& duid);
-                void process_duid(uint32_t const duid, uint32_t const nac, const uint8_t* buf, const int len);
+                void process_duid(uint32_t const duid, uint32_t const nac, const uint8_t* buf, const int len, bool crc_ok = true);
                 void process_HDU(const bit_vector& A);
                 void process_LCW(std::vector<uint8_t>& HB);
                 void process_LLDU(const bit_vector& A, std::vector<uint8_t>& HB);
@@ -84,7 +86,8 @@ namespace gr {
                 bool d_soft_vocoder;
                 int d_nac;
                 gr::msg_queue::sptr d_msg_queue;
-                std::deque<int16_t> &output_queue;
+                control_frame_ring *d_control_ring;
+                audio_ring &output_queue;
                 p25_framer* framer;
                 op25_timer qtimer;
 				software_imbe_decoder software_decoder;
@@ -118,12 +121,16 @@ namespace gr {
 
                 imbe_vocoder vocoder; // for original full rate vocoder
 
-                typedef void (*voice_codec_cb_t)(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, void *user_data);
+                typedef void (*voice_codec_cb_t)(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted, void *user_data);
                 voice_codec_cb_t voice_codec_cb_;
                 void *voice_codec_cb_data_;
+                deferred_codec_frames *d_deferred_frames; // not NULL when synthesis is deferred
 
             public:
                 void set_voice_codec_callback(voice_codec_cb_t cb, void *user_data) { voice_codec_cb_ = cb; voice_codec_cb_data_ = user_data; }
+                void set_deferred_frames(deferred_codec_frames *frames) { d_deferred_frames = frames; }
+                void set_fast_vocoder(bool fast) { software_decoder.set_fast_synthesis(fast); }
+                void set_control_ring(control_frame_ring *ring) { d_control_ring = ring; }
                 void set_debug(int debug);
                 void set_nac(int nac);
                 void reset_timer();
@@ -131,7 +138,7 @@ namespace gr {
                 void crypt_reset();
                 void crypt_key(uint16_t keyid, uint8_t algid, const std::vector<uint8_t> &key);
                 void rx_sym (const uint8_t *syms, int nsyms);
-                p25p1_fdma(const op25_audio& udp,  log_ts& logger, int debug, bool do_imbe, bool do_output, bool do_msgq, gr::msg_queue::sptr queue, std::deque<int16_t> &output_queue, bool do_audio_output, bool soft_vocoder, int msgq_id = 0);
+                p25p1_fdma(const op25_audio& udp,  log_ts& logger, int debug, bool do_imbe, bool do_output, bool do_msgq, gr::msg_queue::sptr queue, audio_ring &output_queue, bool do_audio_output, bool soft_vocoder, int msgq_id = 0);
                 ~p25p1_fdma();
                 uint32_t load_nid(const uint8_t *syms, int nsyms, const uint64_t fs);
                 bool load_body(const uint8_t * syms, int nsyms);
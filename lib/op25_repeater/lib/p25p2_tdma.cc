@@ -97,7 +97,7 @@ static const uint8_t mac_msg_len[256] = {
 	28,  0,  0, 14, 17, 14,  0,  0, 16,  8, 11,  0, 13, 19,  0,  0, 
 	 0,  0, 16, 14,  0,  0, 12,  0, 22,  0, 11, 13, 11,  0, 15,  0 };
 
-p25p2_tdma::p25p2_tdma(const op25_audio& udp, log_ts& logger, int slotid, int debug, bool do_msgq, gr::msg_queue::sptr queue, std::deque<int16_t> &qptr, bool do_audio_output, bool soft_vocoder, int msgq_id) :	// constructor
+p25p2_tdma::p25p2_tdma(const op25_audio& udp, log_ts& logger, int slotid, int debug, bool do_msgq, gr::msg_queue::sptr queue, audio_ring &qptr, bool do_audio_output, bool soft_vocoder, int msgq_id) :	// constructor
 	tdma_xormask(new uint8_t[SUPERFRAME_SIZE]),
 	symbols_received(0),
 	packets(0),
@@ -132,7 +132,8 @@ p25p2_tdma::p25p2_tdma(const op25_audio& udp, log_ts& logger, int slotid, int de
     cached_grp_id(-1),
     cached_id_timestamp(0),
     voice_codec_cb_(NULL),
-    voice_codec_cb_data_(NULL)
+    voice_codec_cb_data_(NULL),
+    d_deferred_frames(NULL)
 {
 	assert (slotid == 0 || slotid == 1);
 	mbe_initMbeParms (&cur_mp, &prev_mp, &enh_mp);
@@ -757,7 +758,14 @@ void p25p2_tdma::handle_voice_frame(const uint8_t dibits[], int slot, int voice_
 		uint32_t params[4] = {(uint32_t)u[0], (uint32_t)u[1], (uint32_t)u[2], (uint32_t)u[3]};
 		voice_codec_cb_(1 /*CODEC_P25_AMBE*/, grp_id,
 		                (cached_src_id > 0) ? (uint32_t)cached_src_id : 0,
-		                params, 4, (int)errs, voice_codec_cb_data_);
+		                params, 4, (int)errs, errs_mp.E0, errs_mp.E1, !audio_valid, voice_codec_cb_data_);
+	}
+
+	// Keep the codewords and leave the audio to be synthesized later
+	if (audio_valid && d_deferred_frames && !op25audio.enabled()) {
+		uint32_t params[4] = {(uint32_t)u[0], (uint32_t)u[1], (uint32_t)u[2], (uint32_t)u[3]};
+		defer_codec_frame(output_queue_decode, *d_deferred_frames, gr::op25_repeater::CODEC_P25_AMBE, params, 4, errs_mp.E0, errs_mp.E1);
+		return;
 	}
 
 	// Only dequantize and synthesize if we have valid audio (decrypted or unencrypted)
@@ -804,10 +812,10 @@ void p25p2_tdma::handle_voice_frame(const uint8_t dibits[], int slot, int voice_
 	}
 
 	// Populate output buffer with either audio samples or silence
+	output_queue_decode.push_back(samples_buf, IMBE_SAMPLES_PER_FRAME); // outputs the sound
 	write_bufp = 0;
 	for (int i=0; i < IMBE_SAMPLES_PER_FRAME; i++) {
 		snd = samples_buf[i];
-		output_queue_decode.push_back(snd); // outputs the sound
 		write_buf[write_bufp++] = snd & 0xFF ;
 		write_buf[write_bufp++] = snd >> 8;
 	}
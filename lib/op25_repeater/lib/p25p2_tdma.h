@@ -34,6 +34,7 @@
 #include "p25p2_framer.h"
 #include "p25_crypt_algs.h"
 #include "op25_audio.h"
+#include "audio_ring.h"
 #include "log_ts.h"
 #include "imbe_vocoder/imbe_vocoder.h"
 
@@ -43,7 +44,7 @@
 class p25p2_tdma
 {
 public:
-	p25p2_tdma(const op25_audio& udp, log_ts& logger, int slotid, int debug, bool do_msgq, gr::msg_queue::sptr queue, std::deque<int16_t> &qptr, bool do_audio_output, bool soft_vocoder, int msgq_id = 0) ;	// constructor
+	p25p2_tdma(const op25_audio& udp, log_ts& logger, int slotid, int debug, bool do_msgq, gr::msg_queue::sptr queue, audio_ring &qptr, bool do_audio_output, bool soft_vocoder, int msgq_id = 0) ;	// constructor
 	int handle_packet(uint8_t dibits[], const uint64_t fs) ;
 	void set_slotid(int slotid);
 	void call_end();
@@ -80,7 +81,7 @@ private:
 	software_imbe_decoder software_decoder;
 	imbe_vocoder vocoder;
 	gr::msg_queue::sptr d_msg_queue;
-	std::deque<int16_t> &output_queue_decode;
+	audio_ring &output_queue_decode;
 	bool d_do_msgq;
 	int d_msgq_id;
 	bool d_do_audio_output;
@@ -132,11 +133,14 @@ private:
 
 	void send_msg(const std::string msg_str, long msg_type);
 
-	typedef void (*voice_codec_cb_t)(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, void *user_data);
+	typedef void (*voice_codec_cb_t)(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted, void *user_data);
 	voice_codec_cb_t voice_codec_cb_;
 	void *voice_codec_cb_data_;
+	deferred_codec_frames *d_deferred_frames; // not NULL when synthesis is deferred
 
 public:
 	void set_voice_codec_callback(voice_codec_cb_t cb, void *user_data) { voice_codec_cb_ = cb; voice_codec_cb_data_ = user_data; }
+	void set_deferred_frames(deferred_codec_frames *frames) { d_deferred_frames = frames; }
+	void set_fast_vocoder(bool fast) { software_decoder.set_fast_synthesis(fast); }
 };
 #endif /* INCLUDED_P25P2_TDMA_H */
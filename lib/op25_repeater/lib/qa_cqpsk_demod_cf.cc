@@ -0,0 +1,167 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Runs the same CQPSK through cqpsk_demod_cf and through the chain it
+ * replaces, gardner_cc -> diff_phasor_cc -> costas_loop_cc ->
+ * complex_to_arg -> multiply_const_ff, set up as p25_recorder_qpsk_demod
+ * sets them up, and slices both with fsk4_slicer_fb. Once the loops have
+ * locked the dibits must be identical. The symbols can only differ by the
+ * error of the two arctangents, as the loops do the same arithmetic.
+ */
+
+#include "qa_cqpsk_demod_cf.h"
+
+#include <cmath>
+#include <stdint.h>
+#include <vector>
+
+#include <gnuradio/top_block.h>
+#include <gnuradio/blocks/complex_to_arg.h>
+#include <gnuradio/digital/diff_phasor_cc.h>
+#include <gnuradio/filter/firdes.h>
+#if GNURADIO_VERSION < 0x030800
+#include <gnuradio/blocks/multiply_const_ff.h>
+#include <gnuradio/blocks/vector_sink_b.h>
+#include <gnuradio/blocks/vector_sink_f.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#else
+#include <gnuradio/blocks/multiply_const.h>
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#endif
+
+#include <op25_repeater/costas_loop_cc.h>
+#include <op25_repeater/cqpsk_demod_cf.h>
+#include <op25_repeater/fsk4_slicer_fb.h>
+#include <op25_repeater/gardner_cc.h>
+
+namespace gr {
+    namespace op25_repeater {
+
+        static const double SYMBOL_RATE = 4800;
+        static const int SAMPLES_PER_SYMBOL = 5;
+        static const double SAMPLE_RATE = SYMBOL_RATE * SAMPLES_PER_SYMBOL;
+        static const int LOCK_SYMBOLS = 500; // left out of the comparison while the loops settle
+
+        static uint32_t rand_state = 1;
+
+        static double rand_uniform()
+        {
+            rand_state = rand_state * 1103515245u + 12345u;
+            return ((rand_state >> 8) + 1.0) / 16777217.0;
+        }
+
+        // Root raised cosine shaped pi/4 DQPSK from random dibits, with a
+        // frequency offset and some noise
+        static std::vector<gr_complex> make_cqpsk(int nsymbols, double offset_Hz, double noise)
+        {
+            const double steps[] = {M_PI / 4, 3 * M_PI / 4, -M_PI / 4, -3 * M_PI / 4};
+            std::vector<float> taps = gr::filter::firdes::root_raised_cosine(SAMPLES_PER_SYMBOL, SAMPLE_RATE, SYMBOL_RATE, 0.2, 11 * SAMPLES_PER_SYMBOL);
+
+            std::vector<gr_complex> impulses(nsymbols * SAMPLES_PER_SYMBOL, gr_complex(0, 0));
+            double phase = 0.0;
+            for (int s = 0; s < nsymbols; s++) {
+                phase = fmod(phase + steps[(int) (rand_uniform() * 4) & 3], 2.0 * M_PI);
+                impulses[s * SAMPLES_PER_SYMBOL] = gr_complex(cos(phase), sin(phase));
+            }
+
+            std::vector<gr_complex> samples(impulses.size());
+            double carrier = 0.0;
+            for (size_t i = 0; i < impulses.size(); i++) {
+                gr_complex acc(0, 0);
+                for (size_t t = 0; (t < taps.size()) && (t <= i); t++) {
+                    acc += impulses[i - t] * taps[t];
+                }
+                carrier = fmod(carrier + 2.0 * M_PI * offset_Hz / SAMPLE_RATE, 2.0 * M_PI);
+                double r = noise * sqrt(-2.0 * log(rand_uniform()));
+                double theta = 2.0 * M_PI * rand_uniform();
+                samples[i] = acc * gr_complex(cos(carrier), sin(carrier)) + gr_complex(r * cos(theta), r * sin(theta));
+            }
+            return samples;
+        }
+
+        void
+        qa_cqpsk_demod_cf::t1_matches_unfused_chain()
+        {
+            // As p25_recorder_qpsk_demod::initialize()
+            const float gain_mu = 0.025;
+            const float costas_alpha = 0.008;
+            const float omega = SAMPLES_PER_SYMBOL;
+            const float gain_omega = 0.1 * gain_mu * gain_mu;
+            const int nsymbols = 20000;
+            const float l[] = {-2.0, 0.0, 2.0, 4.0};
+            std::vector<float> slices(l, l + sizeof(l) / sizeof(l[0]));
+
+            gr::top_block_sptr tb = gr::make_top_block("qa_cqpsk_demod_cf");
+            gr::blocks::vector_source_c::sptr src = gr::blocks::vector_source_c::make(make_cqpsk(nsymbols, 100.0, 0.02));
+
+            gardner_cc::sptr clock = gardner_cc::make(omega, gain_mu, gain_omega);
+            gr::digital::diff_phasor_cc::sptr diffdec = gr::digital::diff_phasor_cc::make();
+            costas_loop_cc::sptr costas = costas_loop_cc::make(costas_alpha, 4, (2 * M_PI) / 4);
+            gr::blocks::complex_to_arg::sptr to_float = gr::blocks::complex_to_arg::make();
+            gr::blocks::multiply_const_ff::sptr rescale = gr::blocks::multiply_const_ff::make(1 / (M_PI / 4));
+            fsk4_slicer_fb::sptr unfused_slicer = fsk4_slicer_fb::make(0, 0, slices);
+            gr::blocks::vector_sink_f::sptr unfused_symbols = gr::blocks::vector_sink_f::make();
+            gr::blocks::vector_sink_b::sptr unfused_dibits = gr::blocks::vector_sink_b::make();
+
+            cqpsk_demod_cf::sptr fused = cqpsk_demod_cf::make(omega, gain_mu, gain_omega, costas_alpha);
+            fsk4_slicer_fb::sptr fused_slicer = fsk4_slicer_fb::make(0, 0, slices);
+            gr::blocks::vector_sink_f::sptr fused_symbols = gr::blocks::vector_sink_f::make();
+            gr::blocks::vector_sink_b::sptr fused_dibits = gr::blocks::vector_sink_b::make();
+
+            tb->connect(src, 0, clock, 0);
+            tb->connect(clock, 0, diffdec, 0);
+            tb->connect(diffdec, 0, costas, 0);
+            tb->connect(costas, 0, to_float, 0);
+            tb->connect(to_float, 0, rescale, 0);
+            tb->connect(rescale, 0, unfused_symbols, 0);
+            tb->connect(rescale, 0, unfused_slicer, 0);
+            tb->connect(unfused_slicer, 0, unfused_dibits, 0);
+
+            tb->connect(src, 0, fused, 0);
+            tb->connect(fused, 0, fused_symbols, 0);
+            tb->connect(fused, 0, fused_slicer, 0);
+            tb->connect(fused_slicer, 0, fused_dibits, 0);
+
+            tb->run();
+
+            const std::vector<float> &a_symbols = unfused_symbols->data();
+            const std::vector<float> &b_symbols = fused_symbols->data();
+            const std::vector<unsigned char> &a_dibits = unfused_dibits->data();
+            const std::vector<unsigned char> &b_dibits = fused_dibits->data();
+
+            // Both recover one symbol per symbol time; the last few can be
+            // left in the timing loop's history when the input runs out
+            CPPUNIT_ASSERT(a_symbols.size() > (size_t) (nsymbols - 20));
+            CPPUNIT_ASSERT(b_symbols.size() > (size_t) (nsymbols - 20));
+            size_t n = std::min(a_symbols.size(), b_symbols.size());
+
+            for (size_t i = LOCK_SYMBOLS; i < n; i++) {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(a_symbols[i], b_symbols[i], 1e-2);
+            }
+
+            n = std::min(a_dibits.size(), b_dibits.size());
+            CPPUNIT_ASSERT(n > (size_t) (nsymbols - 20));
+            for (size_t i = LOCK_SYMBOLS; i < n; i++) {
+                CPPUNIT_ASSERT_EQUAL((int) a_dibits[i], (int) b_dibits[i]);
+            }
+        }
+
+    } /* namespace op25_repeater */
+} /* namespace gr */
@@ -0,0 +1,164 @@
+/* -*- c++ -*- */
+/*
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Runs the same C4FM through fsk4_demod_cf and through the chain it
+ * replaces, pll_freqdet_cf -> multiply_const_ff -> fft_filter_fff ->
+ * fir_filter_fff -> fsk4_demod_ff, set up as p25_recorder_fsk4_demod
+ * sets them up, and slices both with fsk4_slicer_fb. The dibits must be
+ * identical. The symbols can only differ by float rounding, since the
+ * fused block runs the two filters as one FIR.
+ */
+
+#include "qa_fsk4_demod_cf.h"
+
+#include <cmath>
+#include <stdint.h>
+#include <vector>
+
+#include <gnuradio/top_block.h>
+#include <gnuradio/msg_queue.h>
+#include <gnuradio/analog/pll_freqdet_cf.h>
+#include <gnuradio/filter/firdes.h>
+#include <gnuradio/filter/fft_filter_fff.h>
+#if GNURADIO_VERSION < 0x030800
+#include <gnuradio/blocks/multiply_const_ff.h>
+#include <gnuradio/blocks/vector_sink_b.h>
+#include <gnuradio/blocks/vector_sink_f.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#include <gnuradio/filter/fir_filter_fff.h>
+#else
+#include <gnuradio/blocks/multiply_const.h>
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#include <gnuradio/filter/fir_filter_blk.h>
+#endif
+
+#include <op25_repeater/fsk4_demod_cf.h>
+#include <op25_repeater/fsk4_demod_ff.h>
+#include <op25_repeater/fsk4_slicer_fb.h>
+
+namespace gr {
+    namespace op25_repeater {
+
+        static const double SYMBOL_RATE = 4800;
+        static const int SAMPLES_PER_SYMBOL = 5;
+        static const double SAMPLE_RATE = SYMBOL_RATE * SAMPLES_PER_SYMBOL;
+        static const double DEVIATION = 600.0;
+
+        static uint32_t rand_state = 1;
+
+        static double rand_uniform()
+        {
+            rand_state = rand_state * 1103515245u + 12345u;
+            return ((rand_state >> 8) + 1.0) / 16777217.0;
+        }
+
+        // C4FM with a frequency offset and some noise, from random dibits
+        static std::vector<gr_complex> make_c4fm(int nsymbols, double offset_Hz, double noise)
+        {
+            const int levels[] = {1, 3, -1, -3};
+            std::vector<gr_complex> samples;
+            double phase = 0.0;
+
+            for (int s = 0; s < nsymbols; s++) {
+                int level = levels[(int) (rand_uniform() * 4) & 3];
+                for (int i = 0; i < SAMPLES_PER_SYMBOL; i++) {
+                    phase += 2.0 * M_PI * (level * DEVIATION + offset_Hz) / SAMPLE_RATE;
+                    phase = fmod(phase, 2.0 * M_PI);
+                    double r = noise * sqrt(-2.0 * log(rand_uniform()));
+                    double theta = 2.0 * M_PI * rand_uniform();
+                    samples.push_back(gr_complex(cos(phase) + r * cos(theta), sin(phase) + r * sin(theta)));
+                }
+            }
+            return samples;
+        }
+
+        void
+        qa_fsk4_demod_cf::t1_matches_unfused_chain()
+        {
+            const double freq_to_norm_radians = M_PI / (SAMPLE_RATE / 2.0);
+            const double fc = 0.0;
+            const int nsymbols = 20000;
+
+#if GNURADIO_VERSION < 0x030900
+            std::vector<float> noise_taps = gr::filter::firdes::low_pass_2(1.0, SAMPLE_RATE, SYMBOL_RATE / 2.0 * 1.175, SYMBOL_RATE / 2.0 * 0.125, 20.0, gr::filter::firdes::WIN_KAISER, 6.76);
+#else
+            std::vector<float> noise_taps = gr::filter::firdes::low_pass_2(1.0, SAMPLE_RATE, SYMBOL_RATE / 2.0 * 1.175, SYMBOL_RATE / 2.0 * 0.125, 20.0, gr::fft::window::WIN_KAISER, 6.76);
+#endif
+            std::vector<float> sym_taps(SAMPLES_PER_SYMBOL, 1.0 / SAMPLES_PER_SYMBOL);
+            const float l[] = {-2.0, 0.0, 2.0, 4.0};
+            std::vector<float> slices(l, l + sizeof(l) / sizeof(l[0]));
+
+            gr::top_block_sptr tb = gr::make_top_block("qa_fsk4_demod_cf");
+            gr::blocks::vector_source_c::sptr src = gr::blocks::vector_source_c::make(make_c4fm(nsymbols, 150.0, 0.05));
+
+            gr::analog::pll_freqdet_cf::sptr pll = gr::analog::pll_freqdet_cf::make((SYMBOL_RATE / 2.0 * 1.2) * freq_to_norm_radians, (fc + (3 * DEVIATION * 1.9)) * freq_to_norm_radians, (fc + (-3 * DEVIATION * 1.9)) * freq_to_norm_radians);
+            gr::blocks::multiply_const_ff::sptr pll_amp = gr::blocks::multiply_const_ff::make(1.0 / (DEVIATION * freq_to_norm_radians));
+            gr::filter::fft_filter_fff::sptr noise_filter = gr::filter::fft_filter_fff::make(1, noise_taps);
+            gr::filter::fir_filter_fff::sptr sym_filter = gr::filter::fir_filter_fff::make(1, sym_taps);
+            fsk4_demod_ff::sptr unfused = fsk4_demod_ff::make(gr::msg_queue::make(), SAMPLE_RATE, SYMBOL_RATE);
+            fsk4_slicer_fb::sptr unfused_slicer = fsk4_slicer_fb::make(0, 0, slices);
+            gr::blocks::vector_sink_f::sptr unfused_symbols = gr::blocks::vector_sink_f::make();
+            gr::blocks::vector_sink_b::sptr unfused_dibits = gr::blocks::vector_sink_b::make();
+
+            fsk4_demod_cf::sptr fused = fsk4_demod_cf::make(SAMPLE_RATE, SYMBOL_RATE, DEVIATION, noise_taps);
+            fsk4_slicer_fb::sptr fused_slicer = fsk4_slicer_fb::make(0, 0, slices);
+            gr::blocks::vector_sink_f::sptr fused_symbols = gr::blocks::vector_sink_f::make();
+            gr::blocks::vector_sink_b::sptr fused_dibits = gr::blocks::vector_sink_b::make();
+
+            tb->connect(src, 0, pll, 0);
+            tb->connect(pll, 0, pll_amp, 0);
+            tb->connect(pll_amp, 0, noise_filter, 0);
+            tb->connect(noise_filter, 0, sym_filter, 0);
+            tb->connect(sym_filter, 0, unfused, 0);
+            tb->connect(unfused, 0, unfused_symbols, 0);
+            tb->connect(unfused, 0, unfused_slicer, 0);
+            tb->connect(unfused_slicer, 0, unfused_dibits, 0);
+
+            tb->connect(src, 0, fused, 0);
+            tb->connect(fused, 0, fused_symbols, 0);
+            tb->connect(fused, 0, fused_slicer, 0);
+            tb->connect(fused_slicer, 0, fused_dibits, 0);
+
+            tb->run();
+
+            const std::vector<float> &a_symbols = unfused_symbols->data();
+            const std::vector<float> &b_symbols = fused_symbols->data();
+            const std::vector<unsigned char> &a_dibits = unfused_dibits->data();
+            const std::vector<unsigned char> &b_dibits = fused_dibits->data();
+
+            // Both recover one symbol per symbol time; the last one or two can
+            // be left in a block's history when the input runs out
+            CPPUNIT_ASSERT(a_symbols.size() > (size_t) (nsymbols - 10));
+            CPPUNIT_ASSERT(b_symbols.size() > (size_t) (nsymbols - 10));
+            size_t n = std::min(a_symbols.size(), b_symbols.size());
+
+            for (size_t i = 0; i < n; i++) {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(a_symbols[i], b_symbols[i], 1e-3);
+            }
+
+            n = std::min(a_dibits.size(), b_dibits.size());
+            CPPUNIT_ASSERT(n > (size_t) (nsymbols - 10));
+            for (size_t i = 0; i < n; i++) {
+                CPPUNIT_ASSERT_EQUAL((int) a_dibits[i], (int) b_dibits[i]);
+            }
+        }
+
+    } /* namespace op25_repeater */
+} /* namespace gr */
@@ -26,11 +26,17 @@
  */
 
 #include "qa_op25_repeater.h"
+#include "qa_fsk4_demod_cf.h"
+#include "qa_cqpsk_demod_cf.h"
+#include "qa_software_imbe_decoder.h"
 
 CppUnit::TestSuite *
 qa_op25_repeater::suite()
 {
   CppUnit::TestSuite *s = new CppUnit::TestSuite("op25_repeater");
+  s->addTest(gr::op25_repeater::qa_fsk4_demod_cf::suite());
+  s->addTest(gr::op25_repeater::qa_cqpsk_demod_cf::suite());
+  s->addTest(gr::op25_repeater::qa_software_imbe_decoder::suite());
 
   return s;
 }
@@ -30,6 +30,7 @@ namespace gr{
             d_debug(debug),
             d_msgq_id(msgq_id),
             d_msg_queue(queue),
+            d_control_ring(NULL),
             sync_timer(op25_timer(1000000)),
             d_cbuf_idx(0),
             logts(logger)
@@ -91,6 +92,8 @@ namespace gr{
                 if (d_debug >= 10) {
                     fprintf(stderr,"%s SMARTNET crc fail\n", logts.get(d_msgq_id));
                 }
+                if (d_control_ring)
+                    d_control_ring->push(get_msg_type(PROTOCOL_SMARTNET, M_SMARTNET_OSW), 0, false, logts.get_ts(), d_pkt.raw_data, 5);
                 return;
             }
 
@@ -216,7 +219,9 @@ namespace gr{
 
         void rx_smartnet::sync_timeout()
         {
-            if ((d_msgq_id >= 0) && (!d_msg_queue->full_p())) {
+            if (d_control_ring) {
+                d_control_ring->push(get_msg_type(PROTOCOL_SMARTNET, M_SMARTNET_TIMEOUT), 0, true, logts.get_ts(), NULL, 0);
+            } else if ((d_msgq_id >= 0) && (!d_msg_queue->full_p())) {
                 std::string m_buf;
                 gr::message::sptr msg;
                 msg = gr::message::make_from_string(m_buf, get_msg_type(PROTOCOL_SMARTNET, M_SMARTNET_TIMEOUT), (d_msgq_id << 1), logts.get_ts());
@@ -230,6 +235,10 @@ namespace gr{
         }
 
         void rx_smartnet::send_msg(const char* buf) {
+            if (d_control_ring) {
+                d_control_ring->push(get_msg_type(PROTOCOL_SMARTNET, M_SMARTNET_OSW), 0, true, logts.get_ts(), (const uint8_t *)buf, 5);
+                return;
+            }
             std::string msg_str = std::string(buf,5);
             if ((d_msgq_id >= 0) && (!d_msg_queue->full_p())) {
 
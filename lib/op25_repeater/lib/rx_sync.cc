@@ -220,7 +220,7 @@ void rx_sync::ysf_sync(const uint8_t dibitbuf[], bool& ysf_fullrate, bool& unmut
 		fprintf(stderr, "%s ysf_sync: muting audio: dt: %d, rc: %d\n", logts.get(d_msgq_id), d_shift_reg, rc);
 }
 
-rx_sync::rx_sync(const char * options, log_ts& logger, int debug, int msgq_id, gr::msg_queue::sptr queue, std::array<std::deque<int16_t>, 2> &output_queue, bool d_soft_vocoder) :	// constructor
+rx_sync::rx_sync(const char * options, log_ts& logger, int debug, int msgq_id, gr::msg_queue::sptr queue, std::array<audio_ring, 2> &output_queue, bool d_soft_vocoder) :	// constructor
 	sync_timer(op25_timer(1000000)),
 	d_symbol_count(0),
 	d_sync_reg(0),
@@ -243,7 +243,8 @@ rx_sync::rx_sync(const char * options, log_ts& logger, int debug, int msgq_id, g
 	d_audio(options, debug),
 	logts(logger),
 	voice_codec_cb_(NULL),
-	voice_codec_cb_data_(NULL)
+	voice_codec_cb_data_(NULL),
+	d_deferred_frames(NULL)
 {
 	if (msgq_id >= 0)
 		d_stereo = false; // single channel audio for trunking
@@ -401,7 +402,7 @@ void rx_sync::codeword(const uint8_t* cw, const enum codeword_types codeword_typ
 			uint32_t params[4] = {(uint32_t)U[0], (uint32_t)U[1], (uint32_t)U[2], (uint32_t)U[3]};
 			voice_codec_cb_(2 /*CODEC_DMR_AMBE*/, 0,
 			                (src_id[slot_id] > 0) ? (uint32_t)src_id[slot_id] : 0,
-			                params, 4, (int)errs, voice_codec_cb_data_);
+			                params, 4, (int)errs, errs_mp[slot_id].E0, errs_mp[slot_id].E1, false, voice_codec_cb_data_);
 		}
 		break;
 	case CODEWORD_DSTAR:
@@ -413,7 +414,7 @@ void rx_sync::codeword(const uint8_t* cw, const enum codeword_types codeword_typ
 		if (voice_codec_cb_) {
 			uint32_t params[9];
 			for (int i = 0; i < 9; i++) params[i] = (uint32_t)b[i];
-			voice_codec_cb_(3 /*CODEC_DSTAR_AMBE*/, 0, 0, params, 9, 0, voice_codec_cb_data_);
+			voice_codec_cb_(3 /*CODEC_DSTAR_AMBE*/, 0, 0, params, 9, 0, 0, 0, false, voice_codec_cb_data_);
 		}
 		break;
 	case CODEWORD_YSF_HALFRATE:	// 104 bits
@@ -434,7 +435,7 @@ void rx_sync::codeword(const uint8_t* cw, const enum codeword_types codeword_typ
 		if (voice_codec_cb_) {
 			uint32_t params[9];
 			for (int i = 0; i < 9; i++) params[i] = (uint32_t)b[i];
-			voice_codec_cb_(5 /*CODEC_YSF_HALFRATE*/, 0, 0, params, 9, 0, voice_codec_cb_data_);
+			voice_codec_cb_(5 /*CODEC_YSF_HALFRATE*/, 0, 0, params, 9, 0, 0, 0, false, voice_codec_cb_data_);
 		}
 		break;
 	case CODEWORD_P25P2:
@@ -446,11 +447,19 @@ void rx_sync::codeword(const uint8_t* cw, const enum codeword_types codeword_typ
 			fullrate_cw[i] = cw[ysf_permutation[i]];
 		imbe_header_decode(fullrate_cw, u[0], u[1], u[2], u[3], u[4], u[5], u[6], u[7], E0, ET);
 		if (voice_codec_cb_) {
-			voice_codec_cb_(4 /*CODEC_YSF_FULLRATE*/, 0, 0, u, 8, 0, voice_codec_cb_data_);
+			voice_codec_cb_(4 /*CODEC_YSF_FULLRATE*/, 0, 0, u, 8, 0, (int)E0, (int)ET, false, voice_codec_cb_data_);
 		}
 		do_fullrate = true;
 		break;
 	}
+
+	// Keep the DMR codewords and leave the audio to be synthesized later
+	if (d_deferred_frames && (codeword_type == CODEWORD_DMR)) {
+		uint32_t params[4] = {(uint32_t)U[0], (uint32_t)U[1], (uint32_t)U[2], (uint32_t)U[3]};
+		defer_codec_frame(output_queue[slot_id], (*d_deferred_frames)[slot_id], CODEC_DMR_AMBE, params, 4, errs_mp[slot_id].E0, errs_mp[slot_id].E1);
+		return;
+	}
+
 	int16_t samp_buf[IMBE_SAMPLES_PER_FRAME];
 
 	if (do_tone) {
@@ -479,15 +488,9 @@ void rx_sync::codeword(const uint8_t* cw, const enum codeword_types codeword_typ
 			}
 		}
 	}
-	float snd;
-	for (int i=0; i < NSAMP_OUTPUT; i++) {
-		if (do_silence) {
-			snd = 0.0f;
-		} else {
-			snd = samp_buf[i];
-		}
-		output_queue[slot_id].push_back(snd);
-	}
+	if (do_silence)
+		memset(samp_buf, 0, NSAMP_OUTPUT * sizeof(int16_t));
+	output_queue[slot_id].push_back(samp_buf, NSAMP_OUTPUT);
 	//output(samp_buf, slot_id);
 }
 
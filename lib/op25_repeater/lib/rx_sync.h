@@ -28,6 +28,7 @@
 #include <string>
 #include <iostream>
 #include <deque>
+#include <array>
 #include <assert.h>
 #include <gnuradio/msg_queue.h>
 
@@ -50,6 +51,7 @@
 #include "op25_imbe_frame.h"
 #include "software_imbe_decoder.h"
 #include "op25_audio.h"
+#include "audio_ring.h"
 #include "log_ts.h"
 
 #include "rx_base.h"
@@ -128,7 +130,7 @@ public:
 	int get_dst_id(int slot);
 	int get_cc(int slot);
 	std::pair<bool,long> get_terminated(int slot);
-	rx_sync(const char * options, log_ts& logger, int debug, int msgq_id, gr::msg_queue::sptr queue, std::array<std::deque<int16_t>, 2> &output_queue, bool d_soft_vocoder);
+	rx_sync(const char * options, log_ts& logger, int debug, int msgq_id, gr::msg_queue::sptr queue, std::array<audio_ring, 2> &output_queue, bool d_soft_vocoder);
 	~rx_sync();
 
 private:
@@ -168,7 +170,7 @@ private:
 	bool d_soft_vocoder;
 	software_imbe_decoder d_software_decoder[2];
 	imbe_vocoder d_imbe_vocoder[2];
-	std::deque<int16_t> d_output_queue[2];
+	audio_ring d_output_queue[2];
 	dmr_cai dmr;
 	int d_msgq_id;
 	gr::msg_queue::sptr d_msg_queue;
@@ -176,15 +178,18 @@ private:
 	int d_debug;
 	op25_audio d_audio;
 	log_ts& logts;
-	std::array<std::deque<int16_t>, 2> &output_queue;
+	std::array<audio_ring, 2> &output_queue;
 	int src_id[2];
 
-	typedef void (*voice_codec_cb_t)(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, void *user_data);
+	typedef void (*voice_codec_cb_t)(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted, void *user_data);
 	voice_codec_cb_t voice_codec_cb_;
 	void *voice_codec_cb_data_;
+	std::array<deferred_codec_frames, 2> *d_deferred_frames; // not NULL when DMR synthesis is deferred
 
 public:
 	void set_voice_codec_callback(voice_codec_cb_t cb, void *user_data);
+	void set_deferred_frames(std::array<deferred_codec_frames, 2> *frames) { d_deferred_frames = frames; }
+	void set_fast_vocoder(bool fast) { d_software_decoder[0].set_fast_synthesis(fast); d_software_decoder[1].set_fast_synthesis(fast); }
 };
 
     } // end namespace op25_repeater
@@ -729,6 +729,77 @@ static const float PhzNz[57] = {
 	0.068775, 0.520336, 2.339119, -0.808328, 1.332154, 2.929768, -0.338316, 0.022767, -1.063795
 };
 
+// cos and sin of pi * k / 128. The unvoiced DFT only ever needs these angles.
+struct dft_table {
+   float c[256];
+   float s[256];
+   dft_table() {
+      for (int k = 0; k < 256; k++) {
+         c[k] = cos(M_PI * k / 128);
+         s[k] = sin(M_PI * k / 128);
+      }
+   }
+};
+
+static const dft_table &get_dft_table()
+{
+   static const dft_table table;
+   return table;
+}
+
+// A bank of harmonic oscillators for synth_voiced_fast(). Each harmonic is a
+// phasor rotated by its phase step every sample, and optionally the step is
+// rotated too for the linearly changing frequency of a fine transition. The
+// harmonics are independent, so the inner loop over them vectorizes.
+struct harmonic_bank {
+   int n;
+   float re[57], im[57];
+   float step_re[57], step_im[57];
+   float chirp_re[57], chirp_im[57];
+   float amp[57], amp_step[57];
+
+   harmonic_bank() : n(0) {}
+
+   void add(float phase, float step, float chirp, float a, float da) {
+      re[n] = cosf(phase); im[n] = sinf(phase);
+      step_re[n] = cosf(step); step_im[n] = sinf(step);
+      chirp_re[n] = cosf(chirp); chirp_im[n] = sinf(chirp);
+      amp[n] = a; amp_step[n] = da;
+      n++;
+   }
+
+   // out[en] = sum of amp * cos(phase) for en = first .. last
+   void run(float *out, int first, int last) {
+      for (int en = first; en <= last; en++) {
+         float acc = 0;
+         for (int k = 0; k < n; k++) {
+            acc += amp[k] * re[k];
+            float r = re[k] * step_re[k] - im[k] * step_im[k];
+            im[k] = re[k] * step_im[k] + im[k] * step_re[k];
+            re[k] = r;
+         }
+         out[en] = acc;
+      }
+   }
+
+   void run_chirp(float *out, int first, int last) {
+      for (int en = first; en <= last; en++) {
+         float acc = 0;
+         for (int k = 0; k < n; k++) {
+            acc += amp[k] * re[k];
+            float r = re[k] * step_re[k] - im[k] * step_im[k];
+            im[k] = re[k] * step_im[k] + im[k] * step_re[k];
+            re[k] = r;
+            float sr = step_re[k] * chirp_re[k] - step_im[k] * chirp_im[k];
+            step_im[k] = step_re[k] * chirp_im[k] + step_im[k] * chirp_re[k];
+            step_re[k] = sr;
+            amp[k] += amp_step[k];
+         }
+         out[en] = acc;
+      }
+   }
+};
+
 software_imbe_decoder::software_imbe_decoder()
 {
    int i,j;
@@ -739,6 +810,7 @@ software_imbe_decoder::software_imbe_decoder()
    L = 9;
    Old = 1; New = 0;
    psi1 = 0.0;
+   d_fast_synthesis = false;
    for(i=0; i < 58; i++) {
       for(j=0; j < 2; j++) {
          log2Mu[i][j] = 0.0;
@@ -1487,6 +1559,8 @@ software_imbe_decoder::synth_unvoiced()
    float Uwi[256];
    float Uwq[256];
    float uw[256];
+   float uws[211];         // windowed noise, for the table driven DFT
+   bool uws_ready = false;
 
    float Tmp;
 
@@ -1515,13 +1589,34 @@ software_imbe_decoder::synth_unvoiced()
          }
       } else {
          Luv = Luv + 1;
-         for(em = al; em <= bl - 1; em++) {
-            Uwi[em] = 0;
-            Uwq[em] = 0;
-            for (en = 0; en < 211; en++) {
-               float exp = -0.0078125 * M_PI * em * (en - 105);
-               Uwi[em] = Uwi[em] + u[en] * ws[en] * cos(exp);
-               Uwq[em] = Uwq[em] + u[en] * ws[en] * sin(exp);
+         if (d_fast_synthesis) {
+            // exp is -pi * k / 128 with k = em * (en - 105), so look it up mod 256
+            const dft_table &table = get_dft_table();
+            if (!uws_ready) {
+               for (en = 0; en < 211; en++) {
+                  uws[en] = u[en] * ws[en];
+               }
+               uws_ready = true;
+            }
+            for(em = al; em <= bl - 1; em++) {
+               float Ui = 0, Uq = 0;
+               int k = -105 * em;
+               for (en = 0; en < 211; en++, k += em) {
+                  Ui += uws[en] * table.c[k & 255];
+                  Uq -= uws[en] * table.s[k & 255];
+               }
+               Uwi[em] = Ui;
+               Uwq[em] = Uq;
+            }
+         } else {
+            for(em = al; em <= bl - 1; em++) {
+               Uwi[em] = 0;
+               Uwq[em] = 0;
+               for (en = 0; en < 211; en++) {
+                  float exp = -0.0078125 * M_PI * em * (en - 105);
+                  Uwi[em] = Uwi[em] + u[en] * ws[en] * cos(exp);
+                  Uwq[em] = Uwq[em] + u[en] * ws[en] * sin(exp);
+               }
             }
          }
          //precompute Tmp = <most of big hairy equation>
@@ -1602,6 +1697,11 @@ software_imbe_decoder::synth_voiced()
       sv[en] = 0;
    }
 
+   if (d_fast_synthesis) {
+      synth_voiced_fast(MaxL);
+      return;
+   }
+
    for(ell = 1; ell <= MaxL; ell++) {
 
       if(ell > L) { 
@@ -1654,3 +1754,59 @@ software_imbe_decoder::synth_voiced()
    }
 }
 
+// The harmonic sums of synth_voiced() with oscillators in place of cos().
+// The window is the same for every harmonic, so the old and new parts of
+// the overlap are each summed first and windowed once per sample.
+void
+software_imbe_decoder::synth_voiced_fast(int MaxL)
+{
+   harmonic_bank fine, old_bank, new_bank;
+   float s_fine[160], s_old[160], s_new[160];
+   float MOld, MNew, Dpl, Dwl, THa, THb, Mb;
+   int ell, en;
+
+   for(ell = 1; ell <= MaxL; ell++) {
+      MNew = (ell > L) ? 0 : M[ell][New];
+      MOld = (ell > OldL) ? 0 : M[ell][Old];
+
+      if(vee[ell][New]) {
+         if(vee[ell][Old]) {
+            if(ell < 8 && fabsf(w0 - Oldw0) < .1 * w0) { // (fine transition)
+               Dpl = phi[ell][New] - phi[ell][Old] -(Oldw0 + w0) * ell * 80;
+               Dwl = .00625 * (Dpl - 2 * M_PI * floorf((Dpl + M_PI) / (2 * M_PI)));
+               THa = (Oldw0 * (float)ell + Dwl);
+               THb = (w0 - Oldw0) * ell * .003125;
+               Mb = .00625 *(MNew - MOld);
+               // phase(en) = phi + (THa + THb * en) * en, so the step grows by 2 * THb
+               fine.add(phi[ell][Old], THa + THb, 2 * THb, MOld, Mb);
+            } else { // (coarse transition)
+               old_bank.add(phi[ell][Old], Oldw0 * ell, 0, MOld, 0);
+               new_bank.add(w0 * (56 - 160) * ell + phi[ell][New], w0 * ell, 0, MNew, 0);
+            }
+         } else {
+            new_bank.add(w0 * (56 - 160) * ell + phi[ell][New], w0 * ell, 0, MNew, 0);
+         }
+      } else if(vee[ell][Old]) {
+         old_bank.add(phi[ell][Old], Oldw0 * ell, 0, MOld, 0);
+      }
+   }
+
+   if (fine.n) {
+      fine.run_chirp(s_fine, 0, 159);
+      for(en = 0; en <= 159; en++) {
+         sv[en] += s_fine[en];
+      }
+   }
+   if (old_bank.n) {
+      old_bank.run(s_old, 0, 105);
+      for(en = 0; en <= 105; en++) {
+         sv[en] += ws[en+105] * s_old[en];
+      }
+   }
+   if (new_bank.n) {
+      new_bank.run(s_new, 56, 159);
+      for(en = 56; en <= 159; en++) {
+         sv[en] += ws[en-55] * s_new[en];
+      }
+   }
+}
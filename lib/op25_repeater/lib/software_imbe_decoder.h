@@ -54,6 +54,12 @@ public:
 	void decode_fullrate(int16_t samples[IMBE_SAMPLES_PER_FRAME], uint32_t u0, uint32_t u1, uint32_t u2, uint32_t u3, uint32_t u4, uint32_t u5, uint32_t u6, uint32_t u7, uint32_t E0, uint32_t ET);
 	void decode_tap(int16_t samples[IMBE_SAMPLES_PER_FRAME], int _L, int _K, float _w0, const int * _v, const float * _mu);
 	void decode_tone(int16_t samples[IMBE_SAMPLES_PER_FRAME], int _ID, int _AD, int * _n);
+
+	/**
+	 * Synthesize with lookup tables and phase stepped oscillators instead
+	 * of calling cos and sin for every harmonic and sample.
+	 */
+	void set_fast_synthesis(bool fast) { d_fast_synthesis = fast; }
 private:
 
 	//NOTE: Single-letter variable names are upper case only; Lower
@@ -86,6 +92,7 @@ private:
 	char RxData[4096];
 	int sym_bp;
 	int ErFlag;
+	bool d_fast_synthesis;
 
 	uint32_t pngen15(uint32_t& pn);
 	uint32_t pngen23(uint32_t& pn);
@@ -99,6 +106,7 @@ private:
 	uint16_t rearrange(uint32_t u0, uint32_t u1, uint32_t u2, uint32_t u3, uint32_t u4, uint32_t u5, uint32_t u6, uint32_t u7);
 	void synth_unvoiced();
 	void synth_voiced();
+	void synth_voiced_fast(int MaxL);
 	void unpack(uint8_t *buf, uint32_t& u0, uint32_t& u1, uint32_t& u2, uint32_t& u3, uint32_t& u4, uint32_t& u5, uint32_t& u6, uint32_t& u7, uint32_t& E0, uint32_t& ET);
 	int repeat_last();
 };
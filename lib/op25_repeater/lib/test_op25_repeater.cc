@@ -27,15 +27,15 @@
 #include <cppunit/TextTestRunner.h>
 #include <cppunit/XmlOutputter.h>
 
-#include <gnuradio/unittests.h>
 #include "qa_op25_repeater.h"
+#include <fstream>
 #include <iostream>
 
 int
 main (int argc, char **argv)
 {
   CppUnit::TextTestRunner runner;
-  std::ofstream xmlfile(get_unittest_path("op25_repeater.xml").c_str());
+  std::ofstream xmlfile("op25_repeater.xml");
   CppUnit::XmlOutputter *xmlout = new CppUnit::XmlOutputter(&runner.result(), xmlfile);
 
   runner.addTest(qa_op25_repeater::suite());
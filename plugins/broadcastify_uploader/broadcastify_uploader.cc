@@ -4,6 +4,7 @@
 
 #include "../../trunk-recorder/call_concluder/call_concluder.h"
 #include "../../trunk-recorder/plugin_manager/plugin_api.h"
+#include "../../trunk-recorder/plugin_manager/upload_engine.h"
 #include "../trunk-recorder/gr_blocks/decoder_wrapper.h"
 #include <boost/dll/alias.hpp> // for BOOST_DLL_ALIAS
 #include <boost/foreach.hpp>
@@ -32,13 +33,11 @@ struct Broadcastify_Uploader_Data {
   bool ota_enabled;
 };
 
-boost::mutex curl_share_mutex;
-
 class Broadcastify_Uploader : public Plugin_Api {
   // float aggr_;
   // my_plugin_aggregator() : aggr_(0) {}
   Broadcastify_Uploader_Data data;
-  CURLSH *curl_share;
+  Upload_Engine *upload_engine;
   long curl_dns_ttl;
   std::string plugin_name;
 
@@ -160,7 +159,7 @@ private:
   }
 
 public:
-  Broadcastify_Uploader() : curl_share(NULL), curl_dns_ttl(300) {}
+  Broadcastify_Uploader() : upload_engine(NULL), curl_dns_ttl(300) {}
 
   Broadcastify_System_Key *get_system(std::string short_name) {
     for (std::vector<Broadcastify_System_Key>::iterator it = data.keys.begin(); it != data.keys.end(); ++it) {
@@ -191,83 +190,57 @@ public:
     return 0;
   }
 
-  static size_t write_callback(void *contents, size_t size, size_t nmemb, void *userp) {
-    ((std::string *)userp)->append((char *)contents, size * nmemb);
-    return size * nmemb;
-  }
-
   CURLcode upload_audio_file(std::string converted, std::string url) {
     struct stat file_info;
 
     /* get the file size of the local file */
     stat(converted.c_str(), &file_info);
 
-    FILE *audio = fopen(converted.c_str(), "rb");
+    Upload_Request request;
+    request.upload_file = fopen(converted.c_str(), "rb");
 
     // Make sure we have something to read.
-    if (!audio) {
+    if (!request.upload_file) {
       BOOST_LOG_TRIVIAL(info) << "Error opening file " << converted;
       return CURLE_READ_ERROR;
     }
 
-    CURL *curl;
-    CURLcode res = CURLE_FAILED_INIT;
-
-    struct curl_slist *headers = NULL;
-
-    curl = curl_easy_init();
-    if (curl) {
-      curl_easy_setopt(curl, CURLOPT_USERAGENT, "TrunkRecorder1.0");
-
-      /* enable uploading */
-      curl_easy_setopt(curl, CURLOPT_UPLOAD, 1L);
-
-      /* HTTP PUT please */
-      //curl_easy_setopt(curl, CURLOPT_PUT, 1L);
-
-      /* specify target URL, and note that this URL should include a file
-       name, not only a directory */
-      curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-
-      /* now specify which file to upload */
-      curl_easy_setopt(curl, CURLOPT_READDATA, audio);
+    CURL *curl = request.handle;
+    if (!curl) {
+      return CURLE_FAILED_INIT;
+    }
 
-      /* provide the size of the upload, we specially typecast the value
-       to curl_off_t since we must be sure to use the correct data size */
-      curl_easy_setopt(curl, CURLOPT_INFILESIZE_LARGE,
-                       (curl_off_t)file_info.st_size);
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, "TrunkRecorder1.0");
 
-      headers = curl_slist_append(headers, "Content-Type: audio/aac");
-      /* Expect: 100-continue is not wanted */
-      headers = curl_slist_append(headers, "Expect:");
-      /* Transfer-Encoding: chunked is not wanted */
-      headers = curl_slist_append(headers, "Transfer-Encoding:");
+    /* enable uploading */
+    curl_easy_setopt(curl, CURLOPT_UPLOAD, 1L);
 
-      curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    /* specify target URL, and note that this URL should include a file
+     name, not only a directory */
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
 
-      curl_easy_setopt(curl, CURLOPT_SHARE, curl_share);
-      curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, curl_dns_ttl);
+    /* now specify which file to upload */
+    curl_easy_setopt(curl, CURLOPT_READDATA, request.upload_file);
 
-      /* Perform the request, res will get the return code */
-      res = curl_easy_perform(curl);
+    /* provide the size of the upload, we specially typecast the value
+     to curl_off_t since we must be sure to use the correct data size */
+    curl_easy_setopt(curl, CURLOPT_INFILESIZE_LARGE,
+                     (curl_off_t)file_info.st_size);
 
-      /* always cleanup */
-      curl_slist_free_all(headers);
-      curl_easy_cleanup(curl);
-    }
+    request.headers = curl_slist_append(request.headers, "Content-Type: audio/aac");
+    /* Expect: 100-continue is not wanted */
+    request.headers = curl_slist_append(request.headers, "Expect:");
+    /* Transfer-Encoding: chunked is not wanted */
+    request.headers = curl_slist_append(request.headers, "Transfer-Encoding:");
 
-    fclose(audio);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, request.headers);
+    curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, curl_dns_ttl);
 
-    return res;
+    return upload_engine->perform(&request).code;
   }
 
   int upload(Call_Data_t call_info) {
 
-    CURLMcode res;
-    CURLM *multi_handle;
-    int still_running = 0;
-    std::string response_buffer;
-
     Broadcastify_System_Key *sys = get_system(call_info.short_name);
     if (!sys) {
       return 0;
@@ -293,13 +266,15 @@ public:
       return 0;
     }
 
-    struct curl_slist *headerlist = NULL;
+    Upload_Request request;
+    CURL *curl = request.handle;
+    if (!curl) {
+      return 1;
+    }
 
-    CURL *curl = curl_easy_init();
-    curl_mime *mime;
     curl_mimepart *part;
-
-    mime = curl_mime_init(curl);
+    request.mime = curl_mime_init(curl);
+    curl_mime *mime = request.mime;
 
     part = curl_mime_addpart(mime);
     curl_mime_data(part, call_info.call_json.dump().c_str(), CURL_ZERO_TERMINATED);
@@ -329,160 +304,70 @@ public:
       }
     }
 
-    multi_handle = curl_multi_init();
-
     /* initialize custom header list (stating that Expect: 100-continue is not wanted */
-    headerlist = curl_slist_append(headerlist, "Expect:");
-    if (curl && multi_handle) {
-      /* what URL that receives this POST */
-      curl_easy_setopt(curl, CURLOPT_URL, data.bcfy_calls_server.c_str());
-
-      curl_easy_setopt(curl, CURLOPT_USERAGENT, "TrunkRecorder1.0");
-      curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headerlist);
-      curl_easy_setopt(curl, CURLOPT_MIMEPOST, mime);
-
-      curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
-      curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response_buffer);
+    request.headers = curl_slist_append(request.headers, "Expect:");
 
-      curl_easy_setopt(curl, CURLOPT_SHARE, curl_share);
-      curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, curl_dns_ttl);
+    /* what URL that receives this POST */
+    curl_easy_setopt(curl, CURLOPT_URL, data.bcfy_calls_server.c_str());
 
-      // broadcastify seems to make a habit out of letting their ssl certs expire
-      if (this->data.ssl_verify_disable) {
-        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
-        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
-      }
-
-      curl_multi_add_handle(multi_handle, curl);
-
-      curl_multi_perform(multi_handle, &still_running);
-
-      while (still_running) {
-        struct timeval timeout;
-        int rc;       /* select() return code */
-        CURLMcode mc; /* curl_multi_fdset() return code */
-
-        fd_set fdread;
-        fd_set fdwrite;
-        fd_set fdexcep;
-        int maxfd = -1;
-
-        long curl_timeo = -1;
-
-        FD_ZERO(&fdread);
-        FD_ZERO(&fdwrite);
-        FD_ZERO(&fdexcep);
-
-        /* set a suitable timeout to play around with */
-        timeout.tv_sec = 1;
-        timeout.tv_usec = 0;
-
-        curl_multi_timeout(multi_handle, &curl_timeo);
-        if (curl_timeo >= 0) {
-          timeout.tv_sec = curl_timeo / 1000;
-          if (timeout.tv_sec > 1)
-            timeout.tv_sec = 1;
-          else
-            timeout.tv_usec = (curl_timeo % 1000) * 1000;
-        }
-
-        /* get file descriptors from the transfers */
-        mc = curl_multi_fdset(multi_handle, &fdread, &fdwrite, &fdexcep, &maxfd);
-
-        if (mc != CURLM_OK) {
-          fprintf(stderr, "curl_multi_fdset() failed, code %d.\n", mc);
-          break;
-        }
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, "TrunkRecorder1.0");
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, request.headers);
+    curl_easy_setopt(curl, CURLOPT_MIMEPOST, mime);
+    curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, curl_dns_ttl);
 
-        /* On success the value of maxfd is guaranteed to be >= -1. We call
-         select(maxfd + 1, ...); specially in case of (maxfd == -1) there are
-         no fds ready yet so we call select(0, ...) --or Sleep() on Windows--
-         to sleep 100ms, which is the minimum suggested value in the
-         curl_multi_fdset() doc. */
-
-        if (maxfd == -1) {
-          /* Portable sleep for platforms other than Windows. */
-          struct timeval wait = {0, 100 * 1000}; /* 100ms */
-          rc = select(0, NULL, NULL, NULL, &wait);
-        } else {
-          /* Note that on some platforms 'timeout' may be modified by select().
-           If you need access to the original value save a copy beforehand. */
-          rc = select(maxfd + 1, &fdread, &fdwrite, &fdexcep, &timeout);
-        }
-
-        switch (rc) {
-        case -1:
-          /* select error */
-          break;
-        case 0:
-        default:
-          /* timeout or readable/writable sockets */
-          curl_multi_perform(multi_handle, &still_running);
-          break;
-        }
-      }
-
-      // Grab HTTP status BEFORE cleaning up easy handle (important!)
-      long response_code = 0;
-      curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
-
-      res = curl_multi_cleanup(multi_handle);
-
-      /* always cleanup */
-      curl_easy_cleanup(curl);
-
-      /* then cleanup the mime */
-      curl_mime_free(mime);
-
-      /* free slist */
-      curl_slist_free_all(headerlist);
+    // broadcastify seems to make a habit out of letting their ssl certs expire
+    if (this->data.ssl_verify_disable) {
+      curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
+      curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
 
-      std::string loghdr = log_header(call_info.short_name,call_info.call_num,call_info.talkgroup_display,call_info.freq);
+    // Waits here while the upload engine's thread does the transfer
+    const Upload_Result &result = upload_engine->perform(&request);
+    const std::string &response_buffer = result.response;
 
-      if (res != CURLM_OK || response_code != 200) {
-        BOOST_LOG_TRIVIAL(error) << loghdr << this->plugin_name << " Metadata Upload Error: " << response_buffer;
-        return 1;
-      }
+    std::string loghdr = log_header(call_info.short_name, call_info.call_num, call_info.talkgroup_display, call_info.freq);
 
-      std::size_t spacepos = response_buffer.find(' ');
-      if (spacepos < 1) {
-        BOOST_LOG_TRIVIAL(error) << loghdr << response_buffer;
-        return 1;
-      }
+    if (result.code != CURLE_OK || result.response_code != 200) {
+      BOOST_LOG_TRIVIAL(error) << loghdr << this->plugin_name << " Metadata Upload Error: " << (result.code != CURLE_OK ? curl_easy_strerror(result.code) : response_buffer);
+      return 1;
+    }
 
-      std::string code = response_buffer.substr(0, spacepos);
-      std::string message = response_buffer.substr(spacepos + 1);
+    std::size_t spacepos = response_buffer.find(' ');
+    if (spacepos < 1) {
+      BOOST_LOG_TRIVIAL(error) << loghdr << response_buffer;
+      return 1;
+    }
 
-      if (code == "1" && (message.rfind("SKIPPED", 0) == 0)) {
-        BOOST_LOG_TRIVIAL(info) << loghdr << this->plugin_name << " Upload Skipped: " << message;
-        return 0;
-      }
+    std::string code = response_buffer.substr(0, spacepos);
+    std::string message = response_buffer.substr(spacepos + 1);
 
-      if (code == "1" && (message.rfind("REJECTED", 0) == 0)) {
-        BOOST_LOG_TRIVIAL(error) << loghdr << this->plugin_name << " Upload REJECTED: " << message;
-        return 0;
-      }
-
-      if (code != "0") {
-        BOOST_LOG_TRIVIAL(error) << loghdr << this->plugin_name << " Metadata Upload Error: " << message;
-        return 1;
-      }
+    if (code == "1" && (message.rfind("SKIPPED", 0) == 0)) {
+      BOOST_LOG_TRIVIAL(info) << loghdr << this->plugin_name << " Upload Skipped: " << message;
+      return 0;
+    }
 
-      CURLcode audio_error = this->upload_audio_file(call_info.converted, message);
+    if (code == "1" && (message.rfind("REJECTED", 0) == 0)) {
+      BOOST_LOG_TRIVIAL(error) << loghdr << this->plugin_name << " Upload REJECTED: " << message;
+      return 0;
+    }
 
-      if (audio_error) {
-        BOOST_LOG_TRIVIAL(error) << loghdr << this->plugin_name << " Audio Upload Error: " << curl_easy_strerror(audio_error);
-        return 1;
-      }
+    if (code != "0") {
+      BOOST_LOG_TRIVIAL(error) << loghdr << this->plugin_name << " Metadata Upload Error: " << message;
+      return 1;
+    }
 
-      struct stat file_info;
-      stat(call_info.converted.c_str(), &file_info);
+    CURLcode audio_error = this->upload_audio_file(call_info.converted, message);
 
-      BOOST_LOG_TRIVIAL(info) << loghdr << this->plugin_name << " Upload Success - file size: " << file_info.st_size;
-      return 0;
-    } else {
+    if (audio_error) {
+      BOOST_LOG_TRIVIAL(error) << loghdr << this->plugin_name << " Audio Upload Error: " << curl_easy_strerror(audio_error);
       return 1;
     }
+
+    struct stat file_info;
+    stat(call_info.converted.c_str(), &file_info);
+
+    BOOST_LOG_TRIVIAL(info) << loghdr << this->plugin_name << " Upload Success - file size: " << file_info.st_size;
+    return 0;
   }
 
   int call_end(Call_Data_t call_info) {
@@ -573,23 +458,16 @@ public:
       return 1;
     }
 
-    // Initialize shared curl cache to reduce DNS lookups (5 min TTL)
-    curl_share = curl_share_init();
-    curl_share_setopt(curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
-    curl_share_setopt(curl_share, CURLSHOPT_LOCKFUNC, curl_lock_cb);
-    curl_share_setopt(curl_share, CURLSHOPT_UNLOCKFUNC, curl_unlock_cb);
+    // Uploads share the upload engine's connections and DNS cache (5 min TTL)
     curl_dns_ttl = 300;
 
     return 0;
   }
 
-  // curl callbacks
-  static void curl_lock_cb(CURL *handle, curl_lock_data data, curl_lock_access access, void *userptr) {
-    curl_share_mutex.lock();
-  }
-
-  static void curl_unlock_cb(CURL *handle, curl_lock_data data, curl_lock_access access, void *userptr) {
-    curl_share_mutex.unlock();
+  int init(Config *config, std::vector<Source *> sources, std::vector<System *> systems) {
+    frequency_format = config->frequency_format;
+    upload_engine = config->upload_engine;
+    return 0;
   }
 
   /*
@@ -0,0 +1,171 @@
+#include "../../trunk-recorder/plugin_manager/plugin_api.h"
+#include "codec_archive_file.h"
+#include <boost/dll/alias.hpp> // for BOOST_DLL_ALIAS
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+// Archives closed if no frames arrive for this long, in case call_end never comes for them
+static const std::int64_t IDLE_CLOSE_MS = 5 * 60 * 1000;
+// How many closed calls are remembered, so frames that come after the close can not reopen their archive
+static const size_t CLOSED_CALLS_KEPT = 4096;
+
+static std::int64_t now_ms() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+class Codec_Archive : public Plugin_Api {
+  std::string archive_dir;
+  bool write_index = true;
+  std::vector<std::string> short_names;
+
+  // voice_codec_batch is called from the recorder threads and the main loop,
+  // call_end from the call concluder's workers, so the archives are guarded by
+  // one mutex.
+  std::mutex archives_mutex;
+  std::map<long, std::unique_ptr<vca_writer>> archives;
+  std::set<long> closed_calls;
+  std::deque<long> closed_order; // oldest first, to forget them in the order they closed
+
+  // Called with archives_mutex held
+  void remember_closed(long call_num) {
+    if (closed_calls.insert(call_num).second) {
+      closed_order.push_back(call_num);
+      if (closed_order.size() > CLOSED_CALLS_KEPT) {
+        closed_calls.erase(closed_order.front());
+        closed_order.pop_front();
+      }
+    }
+  }
+
+public:
+  bool archive_system(const std::string &short_name) {
+    if (short_names.empty()) {
+      return true;
+    }
+    return std::find(short_names.begin(), short_names.end(), short_name) != short_names.end();
+  }
+
+  // Same directory layout and base name as the call's audio
+  std::string archive_filename(Call *call) {
+    const std::int64_t start_ms = call->get_start_time_ms();
+    const time_t start_time = static_cast<time_t>(start_ms / 1000);
+    struct tm ltm {};
+    localtime_r(&start_time, &ltm);
+
+    boost::filesystem::path dir = boost::filesystem::path(archive_dir.empty() ? call->get_capture_dir() : archive_dir) /
+                                  call->get_short_name() /
+                                  std::to_string(1900 + ltm.tm_year) /
+                                  std::to_string(1 + ltm.tm_mon) /
+                                  std::to_string(ltm.tm_mday);
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(dir, ec);
+
+    std::ostringstream name;
+    name << call->get_talkgroup() << "-" << (start_ms / 1000) << '.' << std::setw(3) << std::setfill('0') << (start_ms % 1000)
+         << "_" << std::llround(call->get_freq());
+    if (call->get_tdma_slot() != -1) {
+      name << "." << call->get_tdma_slot();
+    }
+    name << ".vca";
+    return (dir / name.str()).string();
+  }
+
+  // Frames come a superframe at a time, each with the time it was decoded
+  int voice_codec_batch(Call *call, const Voice_Codec_Frame *frames, int frame_count) {
+    if (!call || !archive_system(call->get_short_name())) {
+      return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(archives_mutex);
+    // Opening it again would truncate the finished archive
+    if (closed_calls.count(call->get_call_num())) {
+      BOOST_LOG_TRIVIAL(debug) << "codec_archive: dropping " << frame_count << " frames that came after call " << call->get_call_num() << " was closed";
+      return 0;
+    }
+    std::unique_ptr<vca_writer> &writer = archives[call->get_call_num()];
+    if (!writer) {
+      writer.reset(new vca_writer());
+      vca_info info;
+      info.start_time_ms = call->get_start_time_ms();
+      info.talkgroup = call->get_talkgroup();
+      info.freq = call->get_freq();
+      info.short_name = call->get_short_name();
+      std::string filename = archive_filename(call);
+      if (!writer->open(filename, info, write_index)) {
+        BOOST_LOG_TRIVIAL(error) << "codec_archive: unable to open " << filename;
+      }
+    }
+    uint32_t call_src_id = call->get_current_source_id() > 0 ? call->get_current_source_id() : 0;
+    for (int i = 0; i < frame_count; i++) {
+      const Voice_Codec_Frame &frame = frames[i];
+      uint32_t src_id = (frame.src_id == 0) ? call_src_id : frame.src_id;
+      writer->write_frame(frame.time_ms, frame.codec_type, src_id, frame.params, frame.param_count, frame.e0, frame.e1, frame.encrypted);
+    }
+    return 0;
+  }
+
+  int call_end(Call_Data_t call_info) {
+    std::lock_guard<std::mutex> lock(archives_mutex);
+    auto it = archives.find(call_info.call_num);
+    if (it != archives.end()) {
+      BOOST_LOG_TRIVIAL(debug) << "codec_archive: closing " << it->second->get_filename();
+      it->second->close();
+      archives.erase(it);
+    }
+    remember_closed(call_info.call_num);
+    return 0;
+  }
+
+  int poll_one() {
+    std::lock_guard<std::mutex> lock(archives_mutex);
+    std::int64_t now = now_ms();
+    for (auto it = archives.begin(); it != archives.end();) {
+      if (now - it->second->get_last_write_ms() > IDLE_CLOSE_MS) {
+        it->second->close();
+        remember_closed(it->first);
+        it = archives.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    return 0;
+  }
+
+  int parse_config(json config_data) {
+    archive_dir = config_data.value("archiveDir", "");
+    write_index = config_data.value("index", true);
+    for (const auto &short_name : config_data.value("shortNames", std::vector<std::string>())) {
+      short_names.push_back(short_name);
+    }
+    BOOST_LOG_TRIVIAL(info) << "codec_archive: archiving voice codec frames to " << (archive_dir.empty() ? "the capture directory" : archive_dir) << ", index: " << write_index;
+    return 0;
+  }
+
+  int stop() {
+    std::lock_guard<std::mutex> lock(archives_mutex);
+    archives.clear();
+    return 0;
+  }
+
+  static boost::shared_ptr<Codec_Archive> create() {
+    return boost::shared_ptr<Codec_Archive>(
+        new Codec_Archive());
+  }
+};
+
+BOOST_DLL_ALIAS(
+    Codec_Archive::create, // <-- this function is exported with...
+    create_plugin          // <-- ...this alias name
+)
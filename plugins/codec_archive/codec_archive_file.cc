@@ -0,0 +1,525 @@
+#include "codec_archive_file.h"
+#include "../../trunk-recorder/gr_blocks/wavfile_gr3.8.h"
+
+#include <op25_repeater/include/op25_repeater/codec_frame.h>
+
+#include <algorithm>
+#include <cstring>
+
+static const char VCA_MAGIC[4] = {'V', 'C', 'A', '2'};
+static const char VCA_INDEX_MAGIC[4] = {'V', 'C', 'A', 'I'};
+static const int VCA_INDEX_ENTRY_SIZE = 17;
+
+// Bits used by each codeword, as the decoders unpack them. IMBE u[7] is
+// shifted up one to leave room for the BOT bit.
+static const int IMBE_WIDTHS[8] = {12, 12, 12, 12, 11, 11, 11, 8};
+static const int AMBE_WIDTHS[4] = {12, 12, 11, 14};
+
+// Returns the codeword widths of a codec, or NULL if its frames are stored raw
+static const int *codec_widths(int codec_type, int &param_count) {
+  switch (codec_type) {
+  case 0: // CODEC_P25_IMBE
+  case 4: // CODEC_YSF_FULLRATE
+    param_count = 8;
+    return IMBE_WIDTHS;
+  case 1: // CODEC_P25_AMBE
+  case 2: // CODEC_DMR_AMBE
+    param_count = 4;
+    return AMBE_WIDTHS;
+  default:
+    param_count = 0;
+    return NULL;
+  }
+}
+
+static int packed_size(const int *widths, int param_count) {
+  int bits = 0;
+  for (int i = 0; i < param_count; i++) {
+    bits += widths[i];
+  }
+  return (bits + 7) / 8;
+}
+
+static void put_u8(std::vector<uint8_t> &buf, uint8_t v) {
+  buf.push_back(v);
+}
+
+static void put_u32(std::vector<uint8_t> &buf, uint32_t v) {
+  for (int i = 0; i < 4; i++) {
+    buf.push_back((v >> (8 * i)) & 0xff);
+  }
+}
+
+static void put_i64(std::vector<uint8_t> &buf, std::int64_t v) {
+  uint64_t u = (uint64_t)v;
+  for (int i = 0; i < 8; i++) {
+    buf.push_back((u >> (8 * i)) & 0xff);
+  }
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static std::int64_t get_i64(const uint8_t *p) {
+  uint64_t u = 0;
+  for (int i = 7; i >= 0; i--) {
+    u = (u << 8) | p[i];
+  }
+  return (std::int64_t)u;
+}
+
+static bool read_bytes(FILE *fp, uint8_t *buf, size_t n) {
+  return fread(buf, 1, n, fp) == n;
+}
+
+// vca_writer
+
+vca_writer::vca_writer() : d_fp(NULL),
+                           d_write_index(false),
+                           d_offset(0),
+                           d_codec_type(-1),
+                           d_src_id(0),
+                           d_next_frame_ms(0),
+                           d_last_write_ms(0),
+                           d_frames_since_time(0) {
+}
+
+vca_writer::~vca_writer() {
+  close();
+}
+
+bool vca_writer::open(const std::string &filename, const vca_info &info, bool write_index) {
+  close();
+  d_fp = fopen(filename.c_str(), "wb");
+  if (!d_fp) {
+    return false;
+  }
+  d_filename = filename;
+  d_write_index = write_index;
+  d_index.clear();
+  d_codec_type = -1;
+  d_src_id = 0;
+  d_next_frame_ms = 0;
+  d_last_write_ms = 0;
+  d_frames_since_time = 0;
+  d_offset = 0;
+
+  std::string short_name = info.short_name.substr(0, 255);
+  d_record.clear();
+  d_record.insert(d_record.end(), VCA_MAGIC, VCA_MAGIC + 4);
+  put_i64(d_record, info.start_time_ms);
+  put_i64(d_record, info.talkgroup);
+  put_i64(d_record, (std::int64_t)info.freq);
+  put_u8(d_record, short_name.size());
+  d_record.insert(d_record.end(), short_name.begin(), short_name.end());
+  flush_record();
+  return true;
+}
+
+void vca_writer::flush_record() {
+  if (d_record.empty()) {
+    return;
+  }
+  fwrite(d_record.data(), 1, d_record.size(), d_fp);
+  d_offset += d_record.size();
+  d_record.clear();
+}
+
+void vca_writer::write_time(std::int64_t time_ms) {
+  vca_index_entry entry;
+  entry.time_ms = time_ms;
+  entry.offset = d_offset + d_record.size();
+  entry.src_id = d_src_id;
+  entry.codec_type = (d_codec_type < 0) ? 0xff : d_codec_type;
+  if (d_write_index) {
+    d_index.push_back(entry);
+  }
+
+  put_u8(d_record, VCA_TIME);
+  put_i64(d_record, time_ms);
+  d_next_frame_ms = time_ms;
+  d_frames_since_time = 0;
+}
+
+void vca_writer::write_frame(std::int64_t now_ms, int codec_type, uint32_t src_id, const uint32_t *params, int param_count, int e0, int e1, bool encrypted) {
+  d_last_write_ms = now_ms;
+  if (!d_fp) {
+    return;
+  }
+
+  // Frames arrive in bursts as the DSP works through its buffers, so the
+  // time of a frame comes from the one before it unless there was a gap.
+  if ((d_next_frame_ms == 0) || (now_ms - d_next_frame_ms > VCA_GAP_MS)) {
+    write_time(now_ms);
+  } else if (d_frames_since_time >= VCA_TIME_INTERVAL) {
+    write_time(d_next_frame_ms);
+  }
+
+  if (codec_type != d_codec_type) {
+    put_u8(d_record, VCA_CODEC);
+    put_u8(d_record, codec_type);
+    d_codec_type = codec_type;
+  }
+
+  if ((src_id != 0) && (src_id != d_src_id)) {
+    put_u8(d_record, VCA_SOURCE);
+    put_u32(d_record, src_id);
+    d_src_id = src_id;
+  }
+
+  uint8_t flags = encrypted ? VCA_FLAG_ENCRYPTED : 0;
+  uint8_t e0_u8 = std::min(std::max(e0, 0), 255);
+  uint8_t e1_u8 = std::min(std::max(e1, 0), 255);
+  int widths_count;
+  const int *widths = codec_widths(codec_type, widths_count);
+  bool packable = widths && (param_count == widths_count);
+  for (int i = 0; packable && (i < param_count); i++) {
+    if (params[i] >> widths[i]) {
+      packable = false;
+    }
+  }
+
+  if (packable) {
+    put_u8(d_record, VCA_FRAME);
+    put_u8(d_record, flags);
+    put_u8(d_record, e0_u8);
+    put_u8(d_record, e1_u8);
+    uint32_t acc = 0;
+    int acc_bits = 0;
+    for (int i = 0; i < param_count; i++) {
+      for (int bit = widths[i] - 1; bit >= 0; bit--) {
+        acc = (acc << 1) | ((params[i] >> bit) & 1);
+        if (++acc_bits == 8) {
+          put_u8(d_record, acc);
+          acc = 0;
+          acc_bits = 0;
+        }
+      }
+    }
+    if (acc_bits) {
+      put_u8(d_record, acc << (8 - acc_bits));
+    }
+  } else {
+    param_count = std::min(std::max(param_count, 0), VCA_MAX_PARAMS);
+    put_u8(d_record, VCA_RAW);
+    put_u8(d_record, flags);
+    put_u8(d_record, e0_u8);
+    put_u8(d_record, e1_u8);
+    put_u8(d_record, param_count);
+    for (int i = 0; i < param_count; i++) {
+      put_u32(d_record, params[i]);
+    }
+  }
+  flush_record();
+
+  d_next_frame_ms += VCA_FRAME_MS;
+  d_frames_since_time++;
+}
+
+void vca_writer::close() {
+  if (!d_fp) {
+    return;
+  }
+  flush_record();
+  if (d_write_index && !d_index.empty()) {
+    for (const vca_index_entry &entry : d_index) {
+      put_i64(d_record, entry.time_ms);
+      put_u32(d_record, entry.offset);
+      put_u32(d_record, entry.src_id);
+      put_u8(d_record, entry.codec_type);
+    }
+    put_u32(d_record, d_index.size());
+    d_record.insert(d_record.end(), VCA_INDEX_MAGIC, VCA_INDEX_MAGIC + 4);
+    flush_record();
+  }
+  fclose(d_fp);
+  d_fp = NULL;
+  d_index.clear();
+}
+
+// vca_reader
+
+vca_reader::vca_reader() : d_fp(NULL),
+                           d_records_start(0),
+                           d_records_end(0),
+                           d_codec_type(-1),
+                           d_src_id(0),
+                           d_next_frame_ms(0) {
+}
+
+vca_reader::~vca_reader() {
+  close();
+}
+
+bool vca_reader::open(const std::string &filename) {
+  close();
+  d_fp = fopen(filename.c_str(), "rb");
+  if (!d_fp) {
+    return false;
+  }
+
+  uint8_t header[29];
+  if (!read_bytes(d_fp, header, sizeof(header)) || memcmp(header, VCA_MAGIC, 4)) {
+    close();
+    return false;
+  }
+  d_info.start_time_ms = get_i64(header + 4);
+  d_info.talkgroup = get_i64(header + 12);
+  d_info.freq = get_i64(header + 20);
+  char short_name[256];
+  if (!read_bytes(d_fp, (uint8_t *)short_name, header[28])) {
+    close();
+    return false;
+  }
+  d_info.short_name.assign(short_name, header[28]);
+  d_records_start = ftell(d_fp);
+
+  if (!read_index()) {
+    close();
+    return false;
+  }
+  return seek(0);
+}
+
+bool vca_reader::read_index() {
+  d_index.clear();
+  if (fseek(d_fp, 0, SEEK_END) != 0) {
+    return false;
+  }
+  d_records_end = ftell(d_fp);
+
+  uint8_t trailer[8];
+  if ((d_records_end - d_records_start < 8) || (fseek(d_fp, d_records_end - 8, SEEK_SET) != 0) ||
+      !read_bytes(d_fp, trailer, 8) || memcmp(trailer + 4, VCA_INDEX_MAGIC, 4)) {
+    return true; // no index
+  }
+
+  uint32_t count = get_u32(trailer);
+  long index_start = d_records_end - 8 - (long)count * VCA_INDEX_ENTRY_SIZE;
+  if (index_start < d_records_start) {
+    return true;
+  }
+  std::vector<uint8_t> buf((size_t)count * VCA_INDEX_ENTRY_SIZE);
+  if ((fseek(d_fp, index_start, SEEK_SET) != 0) || !read_bytes(d_fp, buf.data(), buf.size())) {
+    return false;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    const uint8_t *p = &buf[i * VCA_INDEX_ENTRY_SIZE];
+    vca_index_entry entry;
+    entry.time_ms = get_i64(p);
+    entry.offset = get_u32(p + 8);
+    entry.src_id = get_u32(p + 12);
+    entry.codec_type = p[16];
+    d_index.push_back(entry);
+  }
+  d_records_end = index_start;
+  return true;
+}
+
+void vca_reader::close() {
+  if (d_fp) {
+    fclose(d_fp);
+    d_fp = NULL;
+  }
+  d_index.clear();
+}
+
+bool vca_reader::seek(std::int64_t time_ms) {
+  if (!d_fp) {
+    return false;
+  }
+
+  if (!d_index.empty()) {
+    size_t i = 0;
+    while ((i + 1 < d_index.size()) && (d_index[i + 1].time_ms <= time_ms)) {
+      i++;
+    }
+    const vca_index_entry &entry = d_index[i];
+    d_codec_type = (entry.codec_type == 0xff) ? -1 : entry.codec_type;
+    d_src_id = entry.src_id;
+    d_next_frame_ms = entry.time_ms;
+    return fseek(d_fp, entry.offset, SEEK_SET) == 0;
+  }
+
+  d_codec_type = -1;
+  d_src_id = 0;
+  d_next_frame_ms = d_info.start_time_ms;
+  if (fseek(d_fp, d_records_start, SEEK_SET) != 0) {
+    return false;
+  }
+
+  // No index, so walk the records up to the frame that covers time_ms
+  vca_frame frame;
+  for (;;) {
+    long pos = ftell(d_fp);
+    int codec_type = d_codec_type;
+    uint32_t src_id = d_src_id;
+    std::int64_t next_frame_ms = d_next_frame_ms;
+    bool found = next(frame);
+    if (!found || (frame.time_ms + VCA_FRAME_MS > time_ms)) {
+      d_codec_type = codec_type;
+      d_src_id = src_id;
+      d_next_frame_ms = next_frame_ms;
+      return fseek(d_fp, pos, SEEK_SET) == 0;
+    }
+  }
+}
+
+bool vca_reader::next(vca_frame &frame) {
+  if (!d_fp) {
+    return false;
+  }
+
+  uint8_t buf[VCA_MAX_PARAMS * 4];
+  while (ftell(d_fp) < d_records_end) {
+    int type = fgetc(d_fp);
+    switch (type) {
+    case VCA_TIME:
+      if (!read_bytes(d_fp, buf, 8))
+        return false;
+      d_next_frame_ms = get_i64(buf);
+      break;
+
+    case VCA_CODEC:
+      if (!read_bytes(d_fp, buf, 1))
+        return false;
+      d_codec_type = buf[0];
+      break;
+
+    case VCA_SOURCE:
+      if (!read_bytes(d_fp, buf, 4))
+        return false;
+      d_src_id = get_u32(buf);
+      break;
+
+    case VCA_FRAME: {
+      int param_count;
+      const int *widths = codec_widths(d_codec_type, param_count);
+      if (!widths || !read_bytes(d_fp, buf, 3))
+        return false;
+      frame.encrypted = buf[0] & VCA_FLAG_ENCRYPTED;
+      frame.e0 = buf[1];
+      frame.e1 = buf[2];
+      int nbytes = packed_size(widths, param_count);
+      if (!read_bytes(d_fp, buf, nbytes))
+        return false;
+      int bit_pos = 0;
+      for (int i = 0; i < param_count; i++) {
+        uint32_t v = 0;
+        for (int bit = 0; bit < widths[i]; bit++, bit_pos++) {
+          v = (v << 1) | ((buf[bit_pos / 8] >> (7 - (bit_pos % 8))) & 1);
+        }
+        frame.params[i] = v;
+      }
+      frame.param_count = param_count;
+      frame.codec_type = d_codec_type;
+      frame.src_id = d_src_id;
+      frame.time_ms = d_next_frame_ms;
+      d_next_frame_ms += VCA_FRAME_MS;
+      return true;
+    }
+
+    case VCA_RAW: {
+      if (!read_bytes(d_fp, buf, 4) || (buf[3] > VCA_MAX_PARAMS))
+        return false;
+      frame.encrypted = buf[0] & VCA_FLAG_ENCRYPTED;
+      frame.e0 = buf[1];
+      frame.e1 = buf[2];
+      frame.param_count = buf[3];
+      if (!read_bytes(d_fp, buf, frame.param_count * 4))
+        return false;
+      for (int i = 0; i < frame.param_count; i++) {
+        frame.params[i] = get_u32(buf + i * 4);
+      }
+      frame.codec_type = d_codec_type;
+      frame.src_id = d_src_id;
+      frame.time_ms = d_next_frame_ms;
+      d_next_frame_ms += VCA_FRAME_MS;
+      return true;
+    }
+
+    default:
+      return false;
+    }
+  }
+  return false;
+}
+
+bool vca_render_wav(const std::string &vca_filename, const std::string &wav_filename, std::int64_t start_ms, std::int64_t end_ms, bool soft_vocoder, bool fast_vocoder) {
+  vca_reader reader;
+  if (!reader.open(vca_filename)) {
+    return false;
+  }
+  if ((start_ms > 0) && !reader.seek(start_ms)) {
+    return false;
+  }
+
+  FILE *fp = fopen(wav_filename.c_str(), "wb");
+  if (!fp) {
+    return false;
+  }
+  if (!gr::blocks::wavheader_write(fp, 8000, 1, 2)) {
+    fclose(fp);
+    return false;
+  }
+
+  // Frames from the seek point up to start_ms are decoded but not written,
+  // which brings the vocoder state up to date before the requested range.
+  gr::op25_repeater::codec_synth synth(soft_vocoder, fast_vocoder);
+  gr::op25_repeater::codec_frame codec_frame;
+  int16_t audio[gr::op25_repeater::CODEC_FRAME_SAMPLES];
+  static const int16_t silence[gr::op25_repeater::CODEC_FRAME_SAMPLES] = {0};
+  static const int SAMPLES_PER_MS = gr::op25_repeater::CODEC_FRAME_SAMPLES / VCA_FRAME_MS;
+  unsigned int sample_count = 0;
+  std::int64_t written_ms = 0; // where the audio written so far ends
+  vca_frame frame;
+
+  while (reader.next(frame)) {
+    if ((end_ms > 0) && (frame.time_ms >= end_ms)) {
+      break;
+    }
+
+    // Ciphertext would only put noise through the vocoder and upset its state
+    bool decoded = false;
+    if (!frame.encrypted && (frame.codec_type <= gr::op25_repeater::CODEC_DMR_AMBE) && (frame.param_count <= 8)) {
+      codec_frame.codec_type = frame.codec_type;
+      codec_frame.param_count = frame.param_count;
+      codec_frame.e0 = frame.e0;
+      codec_frame.e1 = frame.e1;
+      memset(codec_frame.params, 0, sizeof(codec_frame.params));
+      memcpy(codec_frame.params, frame.params, frame.param_count * sizeof(uint32_t));
+      decoded = synth.decode(codec_frame, audio);
+    }
+    if (!decoded) {
+      memset(audio, 0, sizeof(audio));
+    }
+
+    if (frame.time_ms + VCA_FRAME_MS <= start_ms) {
+      continue;
+    }
+
+    // The time between transmissions, so the audio lines up with the call
+    if (written_ms == 0) {
+      written_ms = frame.time_ms;
+    }
+    for (std::int64_t gap = (frame.time_ms - written_ms) * SAMPLES_PER_MS; gap > 0;) {
+      int count = std::min<std::int64_t>(gap, gr::op25_repeater::CODEC_FRAME_SAMPLES);
+      for (int i = 0; i < count; i++) {
+        gr::blocks::wav_write_sample(fp, silence[i], 2);
+      }
+      sample_count += count;
+      gap -= count;
+    }
+
+    for (int i = 0; i < gr::op25_repeater::CODEC_FRAME_SAMPLES; i++) {
+      gr::blocks::wav_write_sample(fp, audio[i], 2);
+    }
+    sample_count += gr::op25_repeater::CODEC_FRAME_SAMPLES;
+    written_ms = std::max(written_ms, frame.time_ms + VCA_FRAME_MS);
+  }
+
+  gr::blocks::wavheader_complete(fp, sample_count * 2);
+  fclose(fp);
+  return true;
+}
@@ -0,0 +1,148 @@
+#ifndef CODEC_ARCHIVE_FILE_H
+#define CODEC_ARCHIVE_FILE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/*
+ * Voice Codec Archive (.vca)
+ *
+ * Keeps the vocoder codewords of a call instead of decoded audio. All values
+ * are little endian.
+ *
+ * Header
+ *   char     magic[4]        "VCA2"
+ *   int64_t  start_time_ms   wall clock time of the first frame
+ *   int64_t  talkgroup
+ *   int64_t  freq            Hz
+ *   uint8_t  name_len
+ *   char     short_name[name_len]
+ *
+ * Records, each starting with a one byte type
+ *   VCA_TIME    int64_t time_ms      time of the next frame; each frame after it is 20ms later
+ *   VCA_CODEC   uint8_t codec_type   VoiceCodecType of the frames that follow
+ *   VCA_SOURCE  uint32_t src_id      radio ID of the frames that follow
+ *   VCA_FRAME   uint8_t flags, uint8_t e0, uint8_t e1, codewords bit packed to the widths of the current codec
+ *   VCA_RAW     uint8_t flags, uint8_t e0, uint8_t e1, uint8_t count, uint32_t params[count]
+ *
+ * e0 and e1 are the FEC errors of the first two codewords (IMBE: E0 and ET).
+ * Frames flagged VCA_FLAG_ENCRYPTED had no key and hold ciphertext.
+ *
+ * Optional index, after the last record
+ *   vca_index_entry entries[count]   one for each VCA_TIME record
+ *   uint32_t count
+ *   char     magic[4]        "VCAI"
+ */
+
+enum vca_record_type {
+  VCA_TIME = 1,
+  VCA_CODEC = 2,
+  VCA_SOURCE = 3,
+  VCA_FRAME = 4,
+  VCA_RAW = 5
+};
+
+enum vca_frame_flags {
+  VCA_FLAG_ENCRYPTED = 0x01
+};
+
+static const int VCA_FRAME_MS = 20;
+static const int VCA_MAX_PARAMS = 9;
+static const int VCA_TIME_INTERVAL = 250;  // frames between VCA_TIME records, so the index has a point every 5 seconds
+static const int VCA_GAP_MS = 500;         // a frame arriving this much later than expected starts a new VCA_TIME
+
+struct vca_info {
+  std::int64_t start_time_ms;
+  long talkgroup;
+  double freq;
+  std::string short_name;
+};
+
+// Where a reader can pick up decoding: the offset of a VCA_TIME record and
+// the codec and source in effect there.
+struct vca_index_entry {
+  std::int64_t time_ms;
+  uint32_t offset;
+  uint32_t src_id;
+  uint8_t codec_type;
+};
+
+struct vca_frame {
+  std::int64_t time_ms;
+  int codec_type;
+  uint32_t src_id;
+  int e0;
+  int e1;
+  bool encrypted;
+  int param_count;
+  uint32_t params[VCA_MAX_PARAMS];
+};
+
+class vca_writer {
+public:
+  vca_writer();
+  ~vca_writer();
+  bool open(const std::string &filename, const vca_info &info, bool write_index);
+  void write_frame(std::int64_t now_ms, int codec_type, uint32_t src_id, const uint32_t *params, int param_count, int e0, int e1, bool encrypted);
+  void close();
+  bool is_open() const { return d_fp != NULL; }
+  std::int64_t get_last_write_ms() const { return d_last_write_ms; } // when the last frame was given, written or not
+  const std::string &get_filename() const { return d_filename; }
+
+private:
+  void write_time(std::int64_t time_ms);
+  void flush_record();
+
+  FILE *d_fp;
+  std::string d_filename;
+  bool d_write_index;
+  std::vector<uint8_t> d_record;
+  std::vector<vca_index_entry> d_index;
+  uint32_t d_offset;
+  int d_codec_type;
+  uint32_t d_src_id;
+  std::int64_t d_next_frame_ms;
+  std::int64_t d_last_write_ms;
+  int d_frames_since_time;
+};
+
+class vca_reader {
+public:
+  vca_reader();
+  ~vca_reader();
+  bool open(const std::string &filename);
+  void close();
+  const vca_info &get_info() const { return d_info; }
+  bool has_index() const { return !d_index.empty(); }
+  const std::vector<vca_index_entry> &get_index() const { return d_index; }
+
+  // Positions the reader so the next frame is the last point at or before
+  // time_ms it can start from. Uses the index if there is one, otherwise
+  // scans from the start.
+  bool seek(std::int64_t time_ms);
+
+  // Returns false at the end of the records or if the file is damaged
+  bool next(vca_frame &frame);
+
+private:
+  bool read_index();
+
+  FILE *d_fp;
+  vca_info d_info;
+  std::vector<vca_index_entry> d_index;
+  long d_records_start;
+  long d_records_end;
+  int d_codec_type;
+  uint32_t d_src_id;
+  std::int64_t d_next_frame_ms;
+};
+
+// Decodes the frames between start_ms and end_ms (0 for the whole file) into
+// an 8 kHz, 16 bit mono wav. Encrypted frames, codecs the vocoder can not
+// synthesize and the gaps between transmissions come out as silence, so the
+// timing of the rest is kept.
+bool vca_render_wav(const std::string &vca_filename, const std::string &wav_filename, std::int64_t start_ms, std::int64_t end_ms, bool soft_vocoder, bool fast_vocoder = false);
+
+#endif
@@ -0,0 +1,98 @@
+// Renders a voice codec archive written by the codec_archive plugin to WAV
+//
+//   vca-render [--soft [--fast]] [--start seconds] [--end seconds] archive.vca output.wav
+//   vca-render --info archive.vca
+//
+// --start and --end are seconds from the start of the call.
+
+#include "codec_archive_file.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+static int usage() {
+  std::cerr << "usage: vca-render [--soft [--fast]] [--start seconds] [--end seconds] archive.vca output.wav" << std::endl;
+  std::cerr << "       vca-render --info archive.vca" << std::endl;
+  return 1;
+}
+
+static int print_info(const std::string &filename) {
+  vca_reader reader;
+  if (!reader.open(filename)) {
+    std::cerr << "Unable to read " << filename << std::endl;
+    return 1;
+  }
+  const vca_info &info = reader.get_info();
+  std::cout << "System:    " << info.short_name << std::endl;
+  std::cout << "Talkgroup: " << info.talkgroup << std::endl;
+  std::cout << "Freq:      " << (long)info.freq << std::endl;
+  std::cout << "Start:     " << info.start_time_ms << std::endl;
+  std::cout << "Index:     " << reader.get_index().size() << " entries" << std::endl;
+
+  vca_frame frame;
+  long frames = 0;
+  long encrypted = 0;
+  std::int64_t last_ms = info.start_time_ms;
+  uint32_t src_id = 0;
+  while (reader.next(frame)) {
+    if (frame.src_id != src_id) {
+      std::cout << "  " << (frame.time_ms - info.start_time_ms) / 1000.0 << "s source " << frame.src_id << std::endl;
+      src_id = frame.src_id;
+    }
+    last_ms = frame.time_ms + VCA_FRAME_MS;
+    frames++;
+    if (frame.encrypted) {
+      encrypted++;
+    }
+  }
+  std::cout << "Frames:    " << frames << " (" << frames * VCA_FRAME_MS / 1000.0 << "s of audio, last ends at "
+            << (last_ms - info.start_time_ms) / 1000.0 << "s)" << std::endl;
+  std::cout << "Encrypted: " << encrypted << " frames" << std::endl;
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  bool soft_vocoder = false;
+  bool fast_vocoder = false;
+  double start_s = -1;
+  double end_s = -1;
+  std::vector<std::string> files;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--info") && (i + 1 < argc)) {
+      return print_info(argv[i + 1]);
+    } else if (!strcmp(argv[i], "--soft")) {
+      soft_vocoder = true;
+    } else if (!strcmp(argv[i], "--fast")) {
+      fast_vocoder = true;
+    } else if (!strcmp(argv[i], "--start") && (i + 1 < argc)) {
+      start_s = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--end") && (i + 1 < argc)) {
+      end_s = atof(argv[++i]);
+    } else if (argv[i][0] == '-') {
+      return usage();
+    } else {
+      files.push_back(argv[i]);
+    }
+  }
+  if (files.size() != 2) {
+    return usage();
+  }
+
+  vca_reader reader;
+  if (!reader.open(files[0])) {
+    std::cerr << "Unable to read " << files[0] << std::endl;
+    return 1;
+  }
+  std::int64_t call_start_ms = reader.get_info().start_time_ms;
+  reader.close();
+
+  std::int64_t start_ms = (start_s >= 0) ? call_start_ms + (std::int64_t)(start_s * 1000) : 0;
+  std::int64_t end_ms = (end_s >= 0) ? call_start_ms + (std::int64_t)(end_s * 1000) : 0;
+  if (!vca_render_wav(files[0], files[1], start_ms, end_ms, soft_vocoder, fast_vocoder)) {
+    std::cerr << "Unable to render " << files[0] << " to " << files[1] << std::endl;
+    return 1;
+  }
+  return 0;
+}
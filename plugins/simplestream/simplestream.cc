@@ -5,8 +5,18 @@
 #include <boost/asio.hpp>
 #include <boost/array.hpp>
 
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <sys/socket.h>
+
 using namespace boost::asio;
 
+static const size_t BATCH_MAX_PACKETS = 256;   // a batch is sent early once it holds this many packets
+static const size_t PACKET_RESERVE = 2048;     // bytes set aside for each batched packet, enough for 512 samples and a JSON header
+
 typedef struct plugin_t plugin_t;
 typedef struct stream_t stream_t;
 std::vector<stream_t> streams;
@@ -17,6 +27,20 @@ struct plugin_t {
   Config* config;
 };
 
+// The length prefixed JSON header sent with a call's audio for one talkgroup.
+// It only changes when the source or the patches do, so it is kept between packets.
+struct audio_header_t {
+  int32_t src;
+  std::vector<long> patched_talkgroups;
+  std::string data;
+};
+
+// A UDP packet waiting to go out with the next batch
+struct udp_packet_t {
+  ip::udp::endpoint endpoint;
+  std::vector<uint8_t> data;
+};
+
 struct stream_t {
   long TGID;
   long tcp_index;
@@ -37,13 +61,112 @@ class Simple_Stream : public Plugin_Api {
   io_service my_io_service;
   ip::udp::endpoint remote_endpoint;
   ip::udp::socket my_socket{my_io_service};
+
+  int batch_ms = 0;
+  int multicast_ttl = 1;
+  std::string multicast_interface;
+
+  // audio_stream runs on the plugin's audio thread, call_start and call_end do
+  // not, so the batch and the headers are guarded by one mutex.
+  std::mutex egress_mutex;
+  // By call number, then talkgroup. A call's entry is only made by call_start
+  // and removed by call_end, so audio that comes late can not bring it back.
+  std::map<long, std::map<long, audio_header_t>> audio_headers;
+  audio_header_t uncached_header; // for audio from a call without an entry
+  std::vector<udp_packet_t> batch;
+  size_t batch_count = 0;
+  std::chrono::steady_clock::time_point last_flush;
+#ifdef __linux__
+  std::vector<struct mmsghdr> batch_msgs;
+  std::vector<struct iovec> batch_iovs;
+#endif
   public:
   
   Simple_Stream(){
       
   }
 
+  // Sends the queued packets with as few system calls as the platform allows
+  void flush_batch() {
+    last_flush = std::chrono::steady_clock::now();
+    if (batch_count == 0) {
+      return;
+    }
+#ifdef __linux__
+    for (size_t i = 0; i < batch_count; i++) {
+      batch_iovs[i].iov_base = batch[i].data.data();
+      batch_iovs[i].iov_len = batch[i].data.size();
+      memset(&batch_msgs[i], 0, sizeof(struct mmsghdr));
+      batch_msgs[i].msg_hdr.msg_name = batch[i].endpoint.data();
+      batch_msgs[i].msg_hdr.msg_namelen = batch[i].endpoint.size();
+      batch_msgs[i].msg_hdr.msg_iov = &batch_iovs[i];
+      batch_msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    size_t sent = 0;
+    while (sent < batch_count) {
+      int ret = sendmmsg(my_socket.native_handle(), &batch_msgs[sent], batch_count - sent, 0);
+      if (ret < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        // Drop the one that failed, as send_to would have
+        BOOST_LOG_TRIVIAL(debug) << "simplestreamer: sendmmsg failed: " << strerror(errno);
+        ret = 1;
+      }
+      sent += ret;
+    }
+#else
+    boost::system::error_code error;
+    for (size_t i = 0; i < batch_count; i++) {
+      my_socket.send_to(buffer(batch[i].data), batch[i].endpoint, 0, error);
+    }
+#endif
+    batch_count = 0;
+  }
+
+  // Takes the next free packet in the batch, sending the batch first if it is full
+  udp_packet_t &next_packet(const ip::udp::endpoint &endpoint) {
+    if (batch_count == batch.size()) {
+      flush_batch();
+    }
+    udp_packet_t &packet = batch[batch_count++];
+    packet.endpoint = endpoint;
+    packet.data.clear();
+    return packet;
+  }
+
+  const std::string &audio_header(Call *call, long TGID, int32_t call_src, const std::vector<long> &patched_talkgroups, long wav_hz) {
+    std::map<long, std::map<long, audio_header_t>>::iterator call_headers = audio_headers.find(call->get_call_num());
+    bool cached = (call_headers != audio_headers.end());
+    audio_header_t &header = cached ? call_headers->second[TGID] : uncached_header;
+    if (!cached || header.data.empty() || (header.src != call_src) || (header.patched_talkgroups != patched_talkgroups)) {
+      json json_object = {
+         {"src", call_src},
+         {"src_tag", call->get_system()->find_unit_tag(call_src)},
+         {"talkgroup", TGID},
+         {"patched_talkgroups", patched_talkgroups},
+         {"freq", (uint32_t)call->get_freq()},
+         {"short_name", call->get_short_name()},
+         {"audio_sample_rate", wav_hz},
+         {"event", "audio"},
+      };
+      std::string json_string = json_object.dump();
+      uint32_t json_length = json_string.length();
+      header.src = call_src;
+      header.patched_talkgroups = patched_talkgroups;
+      header.data.assign((const char *)&json_length, 4);  //prepend length of the json data
+      header.data.append(json_string);
+    }
+    return header.data;
+  }
+
  int parse_config(json config_data) {
+    batch_ms = config_data.value("batchMs", 0);
+    multicast_ttl = config_data.value("multicastTTL", 1);
+    multicast_interface = config_data.value("multicastInterface", "");
+    if (batch_ms > 0) {
+      BOOST_LOG_TRIVIAL(info) << "simplestreamer will send UDP audio in batches every " << batch_ms << " ms";
+    }
     for (json element : config_data["streams"]) {
       stream_t stream;
       stream.TGID = element["TGID"];
@@ -62,14 +185,16 @@ class Simple_Stream : public Plugin_Api {
     return 0;
   }
   
+  bool wants_audio() {
+    return true;
+  }
+
   int audio_stream(Call *call, Recorder *recorder, int16_t *samples, int sampleCount){
     //Call local_call = *call;
     System *call_system = call->get_system();
     int32_t call_tgid = call->get_talkgroup();
     int32_t call_src = call->get_current_source_id();
-    uint32_t call_freq = call->get_freq();
     std::string call_short_name = call->get_short_name();
-    std::string call_src_tag = call_system->find_unit_tag(call_src);
     std::vector<unsigned long> unsigned_patched_talkgroups = call_system->get_talkgroup_patch(call_tgid);
     std::vector<long> patched_talkgroups;
     // Convert unsigned long to signed long, preserving negative values
@@ -93,7 +218,8 @@ class Simple_Stream : public Plugin_Api {
     int recorder_id = local_recorder.get_num();
     long wav_hz = local_recorder.get_wav_hz();
     boost::system::error_code error;
-    BOOST_FOREACH (auto stream, streams){
+    std::lock_guard<std::mutex> lock(egress_mutex);
+    BOOST_FOREACH (auto& stream, streams){
       if (0==stream.short_name.compare(call_short_name) || (0==stream.short_name.compare(""))){ //Check if shortName matches or is not specified
         if (patched_talkgroups.size() == 0){
           patched_talkgroups.push_back(call_tgid);  //call_info.talkgroup may be negative - we cast stream.TGID to signed for comparison
@@ -101,28 +227,25 @@ class Simple_Stream : public Plugin_Api {
         BOOST_FOREACH (auto TGID, patched_talkgroups){
           if ((TGID==static_cast<long>(stream.TGID)) || stream.TGID==0){  //setting TGID to 0 in the config file will stream everything
             BOOST_LOG_TRIVIAL(debug) << "got " <<sampleCount <<" samples - " <<sampleCount*2<<" bytes from recorder "<<recorder_id<<" for TGID "<<TGID;
-            json json_object;
-            std::string json_string;
-            std::vector<boost::asio::const_buffer> send_buffer;
-            uint32_t json_length = 0;
+            const std::string *header = NULL;
             if (stream.sendJSON==true){
-              //create JSON metadata
-              json_object = {
-                 {"src", call_src},
-                 {"src_tag",call_src_tag},
-                 {"talkgroup", TGID},
-                 {"patched_talkgroups",patched_talkgroups},
-                 {"freq", call_freq},
-                 {"short_name", call_short_name},
-                 {"audio_sample_rate",wav_hz},
-                 {"event","audio"},
-              };
-              json_string = json_object.dump();
-              json_length = json_string.length();  //determine length in bytes
-              //BOOST_LOG_TRIVIAL(debug) << "json_length is " <<json_length <<" bytes";
-              send_buffer.push_back(buffer(&json_length,4));  //prepend length of the json data
-              send_buffer.push_back(buffer(json_string));  //prepend json data
-              //BOOST_LOG_TRIVIAL(debug) << "json_string is " <<json_string;
+              header = &audio_header(call, TGID, call_src, patched_talkgroups, wav_hz);
+            }
+            if ((batch_ms > 0) && (stream.tcp == false)){
+              udp_packet_t &packet = next_packet(stream.remote_endpoint);
+              if (header){
+                packet.data.insert(packet.data.end(), header->begin(), header->end());
+              }
+              else if (stream.sendTGID==true){
+                int32_t tgid = TGID;
+                packet.data.insert(packet.data.end(), (const uint8_t *)&tgid, (const uint8_t *)&tgid + 4);  //prepend 4 byte long tgid to the audio data
+              }
+              packet.data.insert(packet.data.end(), (const uint8_t *)samples, (const uint8_t *)(samples + sampleCount));
+              continue;
+            }
+            std::vector<boost::asio::const_buffer> send_buffer;
+            if (header){
+              send_buffer.push_back(buffer(*header));  //prepend length and json data
             }
             else if (stream.sendTGID==true){
               send_buffer.push_back(buffer(&TGID,4));  //prepend 4 byte long tgid to the audio data
@@ -138,6 +261,19 @@ class Simple_Stream : public Plugin_Api {
         }
       }
     }
+    if ((batch_count > 0) && (std::chrono::steady_clock::now() - last_flush >= std::chrono::milliseconds(batch_ms))) {
+      flush_batch();
+    }
+    return 0;
+  }
+
+  int poll_one() {
+    if (batch_ms > 0) {
+      std::lock_guard<std::mutex> lock(egress_mutex);
+      if ((batch_count > 0) && (std::chrono::steady_clock::now() - last_flush >= std::chrono::milliseconds(batch_ms))) {
+        flush_batch();
+      }
+    }
     return 0;
   }
 
@@ -164,6 +300,11 @@ class Simple_Stream : public Plugin_Api {
         call_src = transmissions.back().source;
       }
     }
+
+    {
+      std::lock_guard<std::mutex> lock(egress_mutex);
+      audio_headers[call->get_call_num()];
+    }
     
     BOOST_FOREACH (auto stream, streams){
       if (stream.sendJSON == true && stream.sendCallStart == true){
@@ -216,6 +357,12 @@ class Simple_Stream : public Plugin_Api {
 
   int call_end(Call_Data_t call_info) {
     boost::system::error_code error;
+    {
+      std::lock_guard<std::mutex> lock(egress_mutex);
+      // The call's audio goes out before its call_end message
+      flush_batch();
+      audio_headers.erase(call_info.call_num);
+    }
     BOOST_FOREACH (auto stream, streams){
       if (stream.sendJSON == true && stream.sendCallEnd == true){
         if (0==stream.short_name.compare(call_info.short_name) || (0==stream.short_name.compare(""))){ //Check if shortName matches or is not specified
@@ -271,10 +418,39 @@ class Simple_Stream : public Plugin_Api {
       }
     }
     my_socket.open(ip::udp::v4());
+
+    BOOST_FOREACH (auto& stream, streams){
+      if ((stream.tcp == false) && stream.remote_endpoint.address().is_multicast()){
+        // One packet to the group reaches every listener that has joined it
+        boost::system::error_code error;
+        my_socket.set_option(ip::multicast::hops(multicast_ttl), error);
+        if (!multicast_interface.empty()){
+          my_socket.set_option(ip::multicast::outbound_interface(ip::address_v4::from_string(multicast_interface)), error);
+        }
+        if (error){
+          BOOST_LOG_TRIVIAL(error) << "simplestreamer: unable to set multicast options: " << error.message();
+        }
+        BOOST_LOG_TRIVIAL(info) << "simplestreamer will multicast to " << stream.address << " on port " << stream.port << " with a TTL of " << multicast_ttl;
+      }
+    }
+
+    batch.resize(BATCH_MAX_PACKETS);
+    BOOST_FOREACH (auto& packet, batch){
+      packet.data.reserve(PACKET_RESERVE);
+    }
+#ifdef __linux__
+    batch_msgs.resize(BATCH_MAX_PACKETS);
+    batch_iovs.resize(BATCH_MAX_PACKETS);
+#endif
+    last_flush = std::chrono::steady_clock::now();
     return 0;
   }
   
   int stop(){
+    {
+      std::lock_guard<std::mutex> lock(egress_mutex);
+      flush_batch();
+    }
     BOOST_FOREACH (auto& stream, streams){
       if (stream.tcp == true){
         stream.tcp_socket->shutdown(boost::asio::ip::tcp::socket::shutdown_both);
@@ -1,3 +1,5 @@
+#include <chrono>
+#include <map>
 #include <time.h>
 #include <vector>
 #include <websocketpp/client.hpp>
@@ -13,6 +15,8 @@
 
 #include <json.hpp>
 
+#include "status_delta.h"
+
 typedef struct stat_plugin_t stat_plugin_t;
 
 struct stat_plugin_t {
@@ -22,6 +26,17 @@ struct stat_plugin_t {
   Config* config;
 };
 
+// The fields of each kind of entity in delta mode, in the same order as the
+// rows built for them. They match the names get_stats() uses.
+static const std::vector<std::string> CALL_FIELDS = {
+    "callNum", "freq", "sysNum", "shortName", "talkgroup", "talkgrouptag", "elapsed", "length",
+    "state", "monState", "phase2", "conventional", "encrypted", "emergency", "priority", "mode",
+    "duplex", "startTime", "stopTime", "startTimeMs", "stopTimeMs", "srcId", "recNum", "srcNum",
+    "recState", "analog"};
+static const std::vector<std::string> RECORDER_FIELDS = {"type", "srcNum", "recNum", "count", "duration", "state"};
+static const std::vector<std::string> SYSTEM_FIELDS = {"name", "type", "sysid", "wacn", "nac"};
+static const std::vector<std::string> RATE_FIELDS = {"decoderate"};
+
 
 class Stat_Socket : public Plugin_Api {
 
@@ -43,6 +58,20 @@ class Stat_Socket : public Plugin_Api {
   std::vector<Call *> calls;
   Config* config;
 
+  // Delta mode: the status is kept in tables and only what changed is sent,
+  // at most max_update_rate times a second, with a full snapshot every
+  // snapshot_interval seconds so a client can catch up.
+  bool delta_updates;
+  double max_update_rate;
+  int snapshot_interval;
+  unsigned long sequence;
+  std::chrono::steady_clock::time_point next_update;
+  std::chrono::steady_clock::time_point next_snapshot;
+  Status_Table call_table;
+  Status_Table recorder_table;
+  Status_Table system_table;
+  Status_Table rate_table;
+
 public:
   /**
  * The telemetry client connects to a WebSocket server and sends a message every
@@ -54,7 +83,17 @@ public:
     this->systems = systems;
     if (m_open == false)
       return 0;
-      
+
+    if (delta_updates) {
+      std::map<std::string, Status_Table::row_t> rows;
+      for (std::vector<System *>::iterator it = systems.begin(); it != systems.end(); it++) {
+        System *system = *it;
+        rows[std::to_string(system->get_sys_num())].push_back(Json_Writer::encode_number(system->get_message_count() / timeDiff));
+      }
+      rate_table.replace(rows);
+      return 0;
+    }
+
     boost::property_tree::ptree nodes;
 
     for (std::vector<System *>::iterator it = systems.begin(); it != systems.end(); it++) {
@@ -64,7 +103,12 @@ public:
     return send_object(nodes, "rates", "rates");
   }
 
-  Stat_Socket() : m_open(false), m_done(false), m_config_sent(false) {
+  Stat_Socket() : m_open(false), m_done(false), m_config_sent(false),
+                  delta_updates(false), max_update_rate(2), snapshot_interval(60), sequence(0),
+                  call_table("calls", CALL_FIELDS),
+                  recorder_table("recorders", RECORDER_FIELDS),
+                  system_table("systems", SYSTEM_FIELDS),
+                  rate_table("rates", RATE_FIELDS) {
     // set up access channels to only log interesting things
     m_client.clear_access_channels(websocketpp::log::alevel::all);
     m_client.set_access_channels(websocketpp::log::alevel::connect);
@@ -199,9 +243,149 @@ public:
     m_config_sent = true;
   }
 
+  static Status_Table::row_t system_row(System *system) {
+    Status_Table::row_t row;
+    row.reserve(SYSTEM_FIELDS.size());
+    row.push_back(Json_Writer::encode_string(system->get_short_name()));
+    row.push_back(Json_Writer::encode_string(system->get_system_type()));
+    row.push_back(Json_Writer::encode_int(system->get_sys_id()));
+    row.push_back(Json_Writer::encode_int(system->get_wacn()));
+    row.push_back(Json_Writer::encode_int(system->get_nac()));
+    return row;
+  }
+
+  static Status_Table::row_t recorder_row(Recorder *recorder) {
+    Status_Table::row_t row;
+    row.reserve(RECORDER_FIELDS.size());
+    row.push_back(Json_Writer::encode_string(recorder->get_type_string()));
+    row.push_back(Json_Writer::encode_int(recorder->get_source()->get_num()));
+    row.push_back(Json_Writer::encode_int(recorder->get_num()));
+    row.push_back(Json_Writer::encode_int(recorder->get_recording_count()));
+    row.push_back(Json_Writer::encode_number(recorder->get_recording_duration()));
+    row.push_back(Json_Writer::encode_int(recorder->get_state()));
+    return row;
+  }
+
+  static std::string recorder_id(Recorder *recorder) {
+    return std::to_string(recorder->get_source()->get_num()) + "_" + std::to_string(recorder->get_num());
+  }
+
+  // Calls are freed once they end, so everything needed is copied out now
+  static Status_Table::row_t call_row(Call *call) {
+    Status_Table::row_t row;
+    row.reserve(CALL_FIELDS.size());
+    row.push_back(Json_Writer::encode_int(call->get_call_num()));
+    row.push_back(Json_Writer::encode_number(call->get_freq()));
+    row.push_back(Json_Writer::encode_int(call->get_sys_num()));
+    row.push_back(Json_Writer::encode_string(call->get_short_name()));
+    row.push_back(Json_Writer::encode_int(call->get_talkgroup()));
+    row.push_back(Json_Writer::encode_string(call->get_talkgroup_tag()));
+    row.push_back(Json_Writer::encode_int(call->elapsed()));
+    row.push_back(Json_Writer::encode_number((call->get_state() == RECORDING) ? call->get_current_length() : call->get_final_length()));
+    row.push_back(Json_Writer::encode_int(call->get_state()));
+    row.push_back(Json_Writer::encode_int(call->get_monitoring_state()));
+    row.push_back(Json_Writer::encode_bool(call->get_phase2_tdma()));
+    row.push_back(Json_Writer::encode_bool(call->is_conventional()));
+    row.push_back(Json_Writer::encode_bool(call->get_encrypted()));
+    row.push_back(Json_Writer::encode_bool(call->get_emergency()));
+    row.push_back(Json_Writer::encode_int(call->get_priority()));
+    row.push_back(Json_Writer::encode_bool(call->get_mode()));
+    row.push_back(Json_Writer::encode_bool(call->get_duplex()));
+    row.push_back(Json_Writer::encode_int(call->get_start_time()));
+    row.push_back(Json_Writer::encode_int(call->get_stop_time()));
+    row.push_back(Json_Writer::encode_int(call->get_start_time_ms()));
+    row.push_back(Json_Writer::encode_int(call->get_stop_time_ms()));
+    row.push_back(Json_Writer::encode_int(call->get_current_source_id()));
+
+    Recorder *recorder = call->get_recorder();
+    if (recorder) {
+      row.push_back(Json_Writer::encode_int(recorder->get_num()));
+      row.push_back(Json_Writer::encode_int(recorder->get_source()->get_num()));
+      row.push_back(Json_Writer::encode_int(recorder->get_state()));
+      row.push_back(Json_Writer::encode_bool(recorder->is_analog()));
+    } else {
+      row.resize(CALL_FIELDS.size());
+    }
+    return row;
+  }
+
+  static std::string call_id(Call *call) {
+    return std::to_string(call->get_sys_num()) + "_" + std::to_string(call->get_talkgroup()) + "_" + std::to_string(call->get_start_time());
+  }
+
+  // Sends what changed in the tables since the last update, if anything did
+  int send_delta() {
+    Json_Writer out;
+    out.begin_object();
+    out.key("type");
+    out.value(std::string("status_delta"));
+    out.key("seq");
+    out.value((long long)(sequence + 1));
+    out.key("instanceId");
+    out.value(this->config->instance_id);
+    out.key("instanceKey");
+    out.value(this->config->instance_key);
+    // Every table has to be written, so each one's sent state is brought up to date
+    bool changed = call_table.write_delta(out);
+    changed = recorder_table.write_delta(out) || changed;
+    changed = system_table.write_delta(out) || changed;
+    changed = rate_table.write_delta(out) || changed;
+    out.end_object();
+
+    if (!changed) {
+      return 0;
+    }
+    sequence++;
+    return send_stat(out.str());
+  }
+
+  // Sends every table in full
+  int send_snapshot() {
+    Json_Writer out;
+    sequence++;
+    out.begin_object();
+    out.key("type");
+    out.value(std::string("status_snapshot"));
+    out.key("seq");
+    out.value((long long)sequence);
+    out.key("instanceId");
+    out.value(this->config->instance_id);
+    out.key("instanceKey");
+    out.value(this->config->instance_key);
+    call_table.write_snapshot(out);
+    recorder_table.write_snapshot(out);
+    system_table.write_snapshot(out);
+    rate_table.write_snapshot(out);
+    out.end_object();
+
+    next_snapshot = std::chrono::steady_clock::now() + std::chrono::seconds(snapshot_interval);
+    return send_stat(out.str());
+  }
+
+  void flush_tables() {
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (now >= next_snapshot) {
+      send_snapshot();
+      next_update = now + std::chrono::microseconds((long)(1000000 / max_update_rate));
+    } else if ((now >= next_update) && (call_table.is_dirty() || recorder_table.is_dirty() || system_table.is_dirty() || rate_table.is_dirty())) {
+      send_delta();
+      next_update = now + std::chrono::microseconds((long)(1000000 / max_update_rate));
+    }
+  }
+
   int send_systems(std::vector<System *> systems) {
     if (m_open == false)
       return 0;
+
+    if (delta_updates) {
+      std::map<std::string, Status_Table::row_t> rows;
+      for (std::vector<System *>::iterator it = systems.begin(); it != systems.end(); it++) {
+        rows[std::to_string((*it)->get_sys_num())] = system_row(*it);
+      }
+      system_table.replace(rows);
+      return 0;
+    }
+
     boost::property_tree::ptree node;
 
     for (std::vector<System *>::iterator it = systems.begin(); it != systems.end(); it++) {
@@ -215,6 +399,11 @@ public:
     if (m_open == false)
       return 0;
 
+    if (delta_updates) {
+      system_table.set(std::to_string(system->get_sys_num()), system_row(system));
+      return 0;
+    }
+
     return send_object(system->get_stats(), "system", "system");
 
   }
@@ -222,6 +411,16 @@ public:
   int calls_active(std::vector<Call *> calls) {
     if (m_open == false)
       return 0;
+
+    if (delta_updates) {
+      std::map<std::string, Status_Table::row_t> rows;
+      for (std::vector<Call *>::iterator it = calls.begin(); it != calls.end(); it++) {
+        rows[call_id(*it)] = call_row(*it);
+      }
+      call_table.replace(rows);
+      return 0;
+    }
+
     boost::property_tree::ptree node;
 
     for (std::vector<Call *>::iterator it = calls.begin(); it != calls.end(); it++) {
@@ -238,6 +437,16 @@ public:
 
     if (m_open == false)
       return 0;
+
+    if (delta_updates) {
+      std::map<std::string, Status_Table::row_t> rows;
+      for (std::vector<Recorder *>::iterator it = recorders.begin(); it != recorders.end(); it++) {
+        rows[recorder_id(*it)] = recorder_row(*it);
+      }
+      recorder_table.replace(rows);
+      return 0;
+    }
+
     boost::property_tree::ptree node;
 
     for (std::vector<Recorder *>::iterator it = recorders.begin(); it != recorders.end(); it++) {
@@ -252,6 +461,11 @@ public:
     if (m_open == false)
       return 0;
 
+    if (delta_updates) {
+      call_table.set(call_id(call), call_row(call));
+      return 0;
+    }
+
     return send_object(call->get_stats(), "call", "call_start");
 
   }
@@ -267,6 +481,11 @@ public:
     if (m_open == false)
       return 0;
 
+    if (delta_updates) {
+      recorder_table.set(recorder_id(recorder), recorder_row(recorder));
+      return 0;
+    }
+
     return send_object(recorder->get_stats(), "recorder", "recorder");
   }
 
@@ -332,6 +551,9 @@ public:
       reopen_stat();
     }
     m_client.poll_one();
+    if (delta_updates && m_open) {
+      flush_tables();
+    }
     return 0;
   }
 
@@ -357,6 +579,14 @@ public:
       m_open = true;
       retry_attempt = 0;
     }
+    if (delta_updates) {
+      // The new connection starts from a snapshot. The calls and rates come back with their next update.
+      call_table.clear();
+      recorder_table.clear();
+      system_table.clear();
+      rate_table.clear();
+      next_snapshot = std::chrono::steady_clock::now();
+    }
     send_config(this->sources, this->systems);
     send_systems(this->systems);
     std::vector<Recorder *> recorders;
@@ -509,7 +739,21 @@ public:
         );
     }
 
- int parse_config(json config_data ){ return 0; }
+ int parse_config(json config_data) {
+    delta_updates = config_data.value("deltaUpdates", false);
+    max_update_rate = config_data.value("maxUpdateRate", 2.0);
+    snapshot_interval = config_data.value("snapshotInterval", 60);
+    if (max_update_rate <= 0) {
+      max_update_rate = 2;
+    }
+    if (snapshot_interval < 1) {
+      snapshot_interval = 1;
+    }
+    if (delta_updates) {
+      BOOST_LOG_TRIVIAL(info) << "Stat Socket: sending delta updates, at most " << max_update_rate << " a second, with a snapshot every " << snapshot_interval << " seconds";
+    }
+    return 0;
+  }
    int stop() { return 0; }
    int setup_sources(std::vector<Source *> sources) { return 0; }
 
@@ -0,0 +1,214 @@
+#include "status_delta.h"
+
+#include <cmath>
+#include <stdio.h>
+
+Json_Writer::Json_Writer() : m_after_key(false) {
+  m_out.reserve(4096);
+}
+
+void Json_Writer::separate() {
+  if (m_after_key) {
+    m_after_key = false;
+    return;
+  }
+  if (!m_first.empty()) {
+    if (!m_first.back()) {
+      m_out += ',';
+    }
+    m_first.back() = false;
+  }
+}
+
+void Json_Writer::begin_object() {
+  separate();
+  m_out += '{';
+  m_first.push_back(true);
+}
+
+void Json_Writer::end_object() {
+  m_out += '}';
+  m_first.pop_back();
+}
+
+void Json_Writer::begin_array() {
+  separate();
+  m_out += '[';
+  m_first.push_back(true);
+}
+
+void Json_Writer::end_array() {
+  m_out += ']';
+  m_first.pop_back();
+}
+
+void Json_Writer::key(const std::string &name) {
+  separate();
+  m_out += encode_string(name);
+  m_out += ':';
+  m_after_key = true;
+}
+
+void Json_Writer::raw(const std::string &encoded) {
+  separate();
+  m_out += encoded;
+}
+
+std::string Json_Writer::encode_string(const std::string &s) {
+  std::string out;
+  out.reserve(s.size() + 2);
+  out += '"';
+  for (std::string::const_iterator it = s.begin(); it != s.end(); ++it) {
+    unsigned char c = *it;
+    switch (c) {
+    case '"':
+      out += "\\\"";
+      break;
+    case '\\':
+      out += "\\\\";
+      break;
+    case '\n':
+      out += "\\n";
+      break;
+    case '\r':
+      out += "\\r";
+      break;
+    case '\t':
+      out += "\\t";
+      break;
+    default:
+      if (c < 0x20) {
+        char escaped[8];
+        snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+        out += escaped;
+      } else {
+        out += c;
+      }
+    }
+  }
+  out += '"';
+  return out;
+}
+
+std::string Json_Writer::encode_number(double d) {
+  if (!std::isfinite(d)) {
+    return "null";
+  }
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.15g", d);
+  return buf;
+}
+
+std::string Json_Writer::encode_int(long long n) {
+  return std::to_string(n);
+}
+
+std::string Json_Writer::encode_bool(bool b) {
+  return b ? "true" : "false";
+}
+
+Status_Table::Status_Table(std::string name, std::vector<std::string> fields)
+    : m_name(name),
+      m_fields(fields),
+      m_dirty(false) {}
+
+void Status_Table::set(const std::string &id, const row_t &row) {
+  m_current[id] = row;
+  m_dirty = true;
+}
+
+void Status_Table::replace(std::map<std::string, row_t> &rows) {
+  m_current.swap(rows);
+  m_dirty = true;
+}
+
+void Status_Table::clear() {
+  m_current.clear();
+  m_sent.clear();
+  m_dirty = false;
+}
+
+bool Status_Table::write_delta(Json_Writer &out) {
+  if (!m_dirty) {
+    return false;
+  }
+  m_dirty = false;
+
+  // Find what changed first, so nothing is written when nothing did
+  std::vector<std::pair<const std::string *, std::vector<size_t>>> changed;
+  for (std::map<std::string, row_t>::const_iterator it = m_current.begin(); it != m_current.end(); ++it) {
+    std::map<std::string, row_t>::const_iterator sent = m_sent.find(it->first);
+    std::vector<size_t> fields;
+    for (size_t i = 0; i < m_fields.size(); i++) {
+      if ((sent == m_sent.end()) ? !it->second[i].empty() : (it->second[i] != sent->second[i])) {
+        fields.push_back(i);
+      }
+    }
+    if (!fields.empty() || (sent == m_sent.end())) {
+      changed.push_back(std::make_pair(&it->first, fields));
+    }
+  }
+  std::vector<const std::string *> removed;
+  for (std::map<std::string, row_t>::const_iterator it = m_sent.begin(); it != m_sent.end(); ++it) {
+    if (m_current.find(it->first) == m_current.end()) {
+      removed.push_back(&it->first);
+    }
+  }
+  if (changed.empty() && removed.empty()) {
+    return false;
+  }
+
+  out.key(m_name);
+  out.begin_object();
+  if (!changed.empty()) {
+    out.key("changed");
+    out.begin_array();
+    for (size_t i = 0; i < changed.size(); i++) {
+      const row_t &row = m_current[*changed[i].first];
+      out.begin_object();
+      out.key("id");
+      out.value(*changed[i].first);
+      for (size_t j = 0; j < changed[i].second.size(); j++) {
+        size_t field = changed[i].second[j];
+        out.key(m_fields[field]);
+        // A field that has gone is sent as null
+        out.raw(row[field].empty() ? "null" : row[field]);
+      }
+      out.end_object();
+    }
+    out.end_array();
+  }
+  if (!removed.empty()) {
+    out.key("removed");
+    out.begin_array();
+    for (size_t i = 0; i < removed.size(); i++) {
+      out.value(*removed[i]);
+    }
+    out.end_array();
+  }
+  out.end_object();
+
+  m_sent = m_current;
+  return true;
+}
+
+void Status_Table::write_snapshot(Json_Writer &out) {
+  out.key(m_name);
+  out.begin_array();
+  for (std::map<std::string, row_t>::const_iterator it = m_current.begin(); it != m_current.end(); ++it) {
+    out.begin_object();
+    out.key("id");
+    out.value(it->first);
+    for (size_t i = 0; i < m_fields.size(); i++) {
+      if (!it->second[i].empty()) {
+        out.key(m_fields[i]);
+        out.raw(it->second[i]);
+      }
+    }
+    out.end_object();
+  }
+  out.end_array();
+
+  m_sent = m_current;
+  m_dirty = false;
+}
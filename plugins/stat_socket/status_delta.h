@@ -0,0 +1,70 @@
+#ifndef STATUS_DELTA_H
+#define STATUS_DELTA_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Writes JSON text straight into a string, without building a tree first.
+// Values are either written directly or passed in already encoded.
+class Json_Writer {
+public:
+  Json_Writer();
+
+  void begin_object();
+  void end_object();
+  void begin_array();
+  void end_array();
+  void key(const std::string &name);
+  void raw(const std::string &encoded);
+  void value(const std::string &s) { raw(encode_string(s)); }
+  void value(long long n) { raw(encode_int(n)); }
+  const std::string &str() const { return m_out; }
+
+  static std::string encode_string(const std::string &s);
+  static std::string encode_number(double d);
+  static std::string encode_int(long long n);
+  static std::string encode_bool(bool b);
+
+private:
+  void separate();
+
+  std::string m_out;
+  std::vector<bool> m_first; // for each open object or array, whether nothing has been written to it yet
+  bool m_after_key;
+};
+
+// The latest state of one kind of entity, such as the active calls, and the
+// state the status server was last sent. Each entity is a row of encoded
+// values in the order of the table's fields; an empty value leaves that field
+// out. Changes pile up until the next write, so only the net change since the
+// last one goes out.
+class Status_Table {
+public:
+  typedef std::vector<std::string> row_t;
+
+  Status_Table(std::string name, std::vector<std::string> fields);
+
+  size_t field_count() const { return m_fields.size(); }
+  void set(const std::string &id, const row_t &row);
+  // Every entity not in rows is gone. Takes the contents of rows.
+  void replace(std::map<std::string, row_t> &rows);
+  // Forgets everything, as for a new connection
+  void clear();
+  bool is_dirty() const { return m_dirty; }
+
+  // Writes "name":{"changed":[...],"removed":[...]} with the fields that
+  // changed since the last write. Returns false, writing nothing, if none did.
+  bool write_delta(Json_Writer &out);
+  // Writes "name":[...] with every entity in full
+  void write_snapshot(Json_Writer &out);
+
+private:
+  std::string m_name;
+  std::vector<std::string> m_fields;
+  std::map<std::string, row_t> m_current;
+  std::map<std::string, row_t> m_sent;
+  bool m_dirty;
+};
+
+#endif // STATUS_DELTA_H
@@ -1,69 +1,375 @@
 #include "StreamerClient.h"
 
+#include <boost/log/trivial.hpp>
+
 using grpc::Channel;
 using grpc::ChannelArguments;
 using grpc::ClientContext;
 using grpc::Status;
 using streamer::TrunkRecorderStreamer;
 
-StreamerClient::StreamerClient(){}
+static const size_t MAX_BATCH_BYTES = 64 * 1024;   // a batch is sent early once it holds this much audio
+static const size_t MAX_PENDING_EVENTS = 1000;     // signals and call starts and ends waiting for the writer
+static const int64_t AUDIO_GAP_US = 250000;        // a recorder that falls this far behind the wall clock was silent, so its clock restarts
+static const int RECONNECT_MS = 1000;              // how long audio is dropped for after the stream fails
+static const int STOP_TIMEOUT_MS = 2000;           // how long Done() waits for queued audio and events before cancelling the streams
+
+StreamerClient::StreamerClient()
+    : m_enable_audio_streams(false),
+      m_batch_ms(100),
+      m_max_pending_batches(50),
+      m_rpc_timeout_ms(1000),
+      m_batch_bytes(0),
+      m_pending_batches(0),
+      m_pending_events(0),
+      m_stopping(false),
+      m_writer_done(true),
+      m_sent_batches(0),
+      m_dropped_samples(0),
+      m_dropped_events(0),
+      m_audio_failed(false) {}
 
-void StreamerClient::Init(std::shared_ptr<::grpc::Channel> channel, bool enable_audio_streams) {
+StreamerClient::~StreamerClient() {
+    Done();
+}
+
+void StreamerClient::Init(std::shared_ptr<::grpc::Channel> channel, bool enable_audio_streams, int batch_ms, size_t max_pending_batches, int rpc_timeout_ms) {
     stub_ = streamer::TrunkRecorderStreamer::NewStub(channel);
     m_enable_audio_streams = enable_audio_streams;
-    signal_writer_ = stub_->SendSignal(&signal_context_, &signal_response_);
-    if(m_enable_audio_streams) {
-        audio_writer_ = stub_->SendStream(&audio_context_, &audio_response_);
-    }
+    m_batch_ms = batch_ms;
+    m_max_pending_batches = max_pending_batches > 0 ? max_pending_batches : 1;
+    m_rpc_timeout_ms = rpc_timeout_ms;
+    m_stopping = false;
+    m_writer_done = false;
+    m_batch_started = std::chrono::steady_clock::now();
+    m_writer_thread = std::thread(&StreamerClient::Writer, this);
 }
 
 void StreamerClient::Done() {
-    signal_writer_->WritesDone();
-    if(m_enable_audio_streams) {
-        audio_writer_->WritesDone();
+    if(!m_writer_thread.joinable()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    m_stopping = true;
+    m_queue_cond.notify_all();
+    if(!m_queue_cond.wait_for(lock, std::chrono::milliseconds(STOP_TIMEOUT_MS), [this] { return m_writer_done; })) {
+        // The server is not keeping up, so give up on what is left
+        std::lock_guard<std::mutex> context_lock(m_context_mutex);
+        if(audio_context_) {
+            audio_context_->TryCancel();
+        }
+        if(signal_context_) {
+            signal_context_->TryCancel();
+        }
     }
+    lock.unlock();
+    m_writer_thread.join();
+    BOOST_LOG_TRIVIAL(info) << "streamer: sent " << m_sent_batches << " audio batches, dropped " << m_dropped_samples << " samples and " << m_dropped_events << " events";
 }
 
-void StreamerClient::SendAudio(const ::streamer::AudioSample& request) {
-    audio_writer_->Write(request);
+void StreamerClient::QueueAudio(int recorder_num, long call_num, long talkgroup, int sample_rate, uint64_t sample_clock, const int16_t *samples, int sample_count) {
+    if(!m_enable_audio_streams || (sample_count <= 0) || (sample_rate <= 0)) {
+        return;
+    }
+
+    // Sample time runs on from the recorder's last chunk, so batches can be
+    // played back gap free however they were delayed on the way. Audio the
+    // recorder dropped before it got here still moves the time on, as the
+    // recorder's sample clock counts it. The time restarts from the wall clock
+    // for a new call or after a silence.
+    int64_t now_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    int64_t duration_us = (int64_t)sample_count * 1000000 / sample_rate;
+    RecorderClock &clock = m_clocks[recorder_num];
+    bool same_call = (clock.next_us != 0) && (clock.call_num == call_num) && (sample_clock >= clock.next_sample);
+    int64_t sample_time_us = 0;
+    if(same_call) {
+        sample_time_us = clock.next_us + (int64_t)(sample_clock - clock.next_sample) * 1000000 / sample_rate;
+    }
+    if(!same_call || (sample_time_us + duration_us < now_us - AUDIO_GAP_US)) {
+        clock.call_num = call_num;
+        sample_time_us = now_us - duration_us;
+    }
+    bool contiguous = (sample_time_us == clock.next_us);
+    clock.next_us = sample_time_us + duration_us;
+    clock.next_sample = sample_clock + sample_count;
+
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    if(m_stopping) {
+        return;
+    }
+
+    ::streamer::AudioSample *sample = NULL;
+    std::map<int, int>::iterator index = m_batch_index.find(recorder_num);
+    if(contiguous && (index != m_batch_index.end())) {
+        ::streamer::AudioSample *last = m_batch.mutable_samples(index->second);
+        if(last->call_num() == call_num) {
+            sample = last;
+        }
+    }
+    if(sample == NULL) {
+        sample = m_batch.add_samples();
+        sample->set_recorder_num(recorder_num);
+        sample->set_call_num(call_num);
+        sample->set_talkgroup(talkgroup);
+        sample->set_audio_sample_rate(sample_rate);
+        sample->mutable_sample_time()->set_seconds(sample_time_us / 1000000);
+        sample->mutable_sample_time()->set_nanos((sample_time_us % 1000000) * 1000);
+        m_batch_index[recorder_num] = m_batch.samples_size() - 1;
+    }
+    sample->mutable_sample()->append((const char *)samples, sample_count * sizeof(int16_t));
+    m_batch_bytes += sample_count * sizeof(int16_t);
+
+    if((m_batch_bytes >= MAX_BATCH_BYTES) || (std::chrono::steady_clock::now() - m_batch_started >= std::chrono::milliseconds(m_batch_ms))) {
+        CloseBatch();
+        m_queue_cond.notify_all();
+    }
 }
 
 void StreamerClient::SendSignal(const ::streamer::SignalInfo& request) {
-    signal_writer_->Write(request);
+    Outgoing event;
+    event.kind = Outgoing::SIGNAL;
+    event.signal = request;
+    QueueEvent(event);
 }
 
 void StreamerClient::CallStarted(const ::streamer::CallInfo& request) {
-    ::google::protobuf::Empty reply;
-    ClientContext context;
-    stub_->CallStarted(&context, request, &reply);
+    Outgoing event;
+    event.kind = Outgoing::CALL_STARTED;
+    event.call = request;
+    QueueEvent(event);
 }
 
 void StreamerClient::CallEnded(const ::streamer::CallInfo& request) {
+    Outgoing event;
+    event.kind = Outgoing::CALL_ENDED;
+    event.call = request;
+    QueueEvent(event);
+}
+
+void StreamerClient::QueueEvent(Outgoing &event) {
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    if(m_stopping) {
+        return;
+    }
+    // A call's audio so far goes out before its start or end
+    if(event.kind != Outgoing::SIGNAL) {
+        CloseBatch();
+    }
+    if(m_pending_events >= MAX_PENDING_EVENTS) {
+        for(std::deque<Outgoing>::iterator it = m_pending.begin(); it != m_pending.end(); it++) {
+            if(it->kind != Outgoing::AUDIO) {
+                m_pending.erase(it);
+                m_pending_events--;
+                m_dropped_events++;
+                break;
+            }
+        }
+    }
+    m_pending.push_back(std::move(event));
+    m_pending_events++;
+    m_queue_cond.notify_all();
+}
+
+// Moves the batch being filled onto the queue for the writer. Called with m_queue_mutex held.
+void StreamerClient::CloseBatch() {
+    m_batch_started = std::chrono::steady_clock::now();
+    if(m_batch.samples_size() == 0) {
+        return;
+    }
+    if(m_pending_batches >= m_max_pending_batches) {
+        for(std::deque<Outgoing>::iterator it = m_pending.begin(); it != m_pending.end(); it++) {
+            if(it->kind == Outgoing::AUDIO) {
+                for(int i = 0; i < it->batch.samples_size(); i++) {
+                    m_dropped_samples += it->batch.samples(i).sample().size() / sizeof(int16_t);
+                }
+                m_pending.erase(it);
+                m_pending_batches--;
+                break;
+            }
+        }
+    }
+    m_pending.push_back(Outgoing());
+    m_pending.back().kind = Outgoing::AUDIO;
+    m_pending.back().batch.Swap(&m_batch);
+    m_pending_batches++;
+    m_batch.Clear();
+    m_batch_index.clear();
+    m_batch_bytes = 0;
+}
+
+void StreamerClient::Writer() {
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    while(true) {
+        m_queue_cond.wait_for(lock, std::chrono::milliseconds(m_batch_ms), [this] { return m_stopping || !m_pending.empty(); });
+
+        // Audio that stops mid batch still goes out on time
+        if(m_pending.empty() && (m_stopping || (std::chrono::steady_clock::now() - m_batch_started >= std::chrono::milliseconds(m_batch_ms)))) {
+            CloseBatch();
+        }
+        if(m_pending.empty()) {
+            if(m_stopping) {
+                break;
+            }
+            continue;
+        }
+
+        Outgoing item = std::move(m_pending.front());
+        m_pending.pop_front();
+        if(item.kind == Outgoing::AUDIO) {
+            m_pending_batches--;
+        } else {
+            m_pending_events--;
+        }
+        lock.unlock();
+
+        bool sent = Send(item);
+
+        lock.lock();
+        if(item.kind != Outgoing::AUDIO) {
+            continue;
+        }
+        if(sent) {
+            m_sent_batches++;
+        } else {
+            for(int i = 0; i < item.batch.samples_size(); i++) {
+                m_dropped_samples += item.batch.samples(i).sample().size() / sizeof(int16_t);
+            }
+        }
+    }
+    lock.unlock();
+
+    CloseAudioStream();
+    CloseSignalStream();
+
+    lock.lock();
+    m_writer_done = true;
+    m_queue_cond.notify_all();
+}
+
+bool StreamerClient::Send(Outgoing &item) {
+    if(item.kind == Outgoing::AUDIO) {
+        return SendAudio(item.batch);
+    }
+    if(item.kind == Outgoing::SIGNAL) {
+        return SendSignalInfo(item.signal);
+    }
+
     ::google::protobuf::Empty reply;
     ClientContext context;
-    stub_->CallEnded(&context, request, &reply);
+    SetDeadline(context);
+    bool started = (item.kind == Outgoing::CALL_STARTED);
+    Status status = started ? stub_->CallStarted(&context, item.call, &reply) : stub_->CallEnded(&context, item.call, &reply);
+    if(!status.ok()) LogStatus(started ? "CallStarted" : "CallEnded", status);
+    return status.ok();
+}
+
+bool StreamerClient::SendAudio(const ::streamer::AudioBatch &batch) {
+    if(!audio_writer_ && !OpenAudioStream()) {
+        return false;
+    }
+    // Blocks while the server's flow control window is full
+    if(!audio_writer_->Write(batch)) {
+        CloseAudioStream();
+        return false;
+    }
+    if(m_audio_failed) {
+        BOOST_LOG_TRIVIAL(info) << "streamer: audio stream reconnected";
+        m_audio_failed = false;
+    }
+    return true;
+}
+
+bool StreamerClient::OpenAudioStream() {
+    if(std::chrono::steady_clock::now() < m_audio_retry) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_context_mutex);
+    audio_context_.reset(new ClientContext());
+    audio_writer_ = stub_->SendStream(audio_context_.get(), &audio_response_);
+    return true;
+}
+
+void StreamerClient::CloseAudioStream() {
+    if(!audio_writer_) {
+        return;
+    }
+    audio_writer_->WritesDone();
+    Status status = audio_writer_->Finish();
+    if(!status.ok()) {
+        if(!m_audio_failed) {
+            LogStatus("SendStream", status);
+        }
+        m_audio_failed = true;
+        m_audio_retry = std::chrono::steady_clock::now() + std::chrono::milliseconds(RECONNECT_MS);
+    }
+    std::lock_guard<std::mutex> lock(m_context_mutex);
+    audio_writer_.reset();
+    audio_context_.reset();
+}
+
+bool StreamerClient::SendSignalInfo(const ::streamer::SignalInfo &signal) {
+    if(!signal_writer_) {
+        std::lock_guard<std::mutex> lock(m_context_mutex);
+        signal_context_.reset(new ClientContext());
+        signal_writer_ = stub_->SendSignal(signal_context_.get(), &signal_response_);
+    }
+    if(!signal_writer_->Write(signal)) {
+        LogStatus("SendSignal", signal_writer_->Finish());
+        std::lock_guard<std::mutex> lock(m_context_mutex);
+        signal_writer_.reset();
+        signal_context_.reset();
+        return false;
+    }
+    return true;
+}
+
+void StreamerClient::CloseSignalStream() {
+    if(!signal_writer_) {
+        return;
+    }
+    signal_writer_->WritesDone();
+    signal_writer_->Finish();
+    std::lock_guard<std::mutex> lock(m_context_mutex);
+    signal_writer_.reset();
+    signal_context_.reset();
+}
+
+void StreamerClient::SetDeadline(ClientContext &context) {
+    context.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(m_rpc_timeout_ms));
+}
+
+void StreamerClient::LogStatus(const char *rpc, const Status &status) {
+    BOOST_LOG_TRIVIAL(error) << "streamer: " << rpc << " failed: " << status.error_message() << " (" << status.error_code() << ")";
 }
 
 void StreamerClient::SetupRecorder(const ::streamer::RecorderInfo& request) {
     ::google::protobuf::Empty reply;
     ClientContext context;
-    stub_->SetupRecorder(&context, request, &reply);
+    SetDeadline(context);
+    Status status = stub_->SetupRecorder(&context, request, &reply);
+    if(!status.ok()) LogStatus("SetupRecorder", status);
 }
 
 void StreamerClient::SetupSystem(const ::streamer::SystemInfo& request) {
     ::google::protobuf::Empty reply;
     ClientContext context;
-    stub_->SetupSystem(&context, request, &reply);
+    SetDeadline(context);
+    Status status = stub_->SetupSystem(&context, request, &reply);
+    if(!status.ok()) LogStatus("SetupSystem", status);
 }
 
 void StreamerClient::SetupSource(const ::streamer::SourceInfo& request) {
     ::google::protobuf::Empty reply;
     ClientContext context;
-    stub_->SetupSource(&context, request, &reply);
+    SetDeadline(context);
+    Status status = stub_->SetupSource(&context, request, &reply);
+    if(!status.ok()) LogStatus("SetupSource", status);
 }
 
 void StreamerClient::SetupConfig(const ::streamer::ConfigInfo& request) {
     ::google::protobuf::Empty reply;
     ClientContext context;
-    stub_->SetupConfig(&context, request, &reply);
+    SetDeadline(context);
+    Status status = stub_->SetupConfig(&context, request, &reply);
+    if(!status.ok()) LogStatus("SetupConfig", status);
 }
@@ -1,40 +1,110 @@
 #ifndef STREAMERCLIENT_H
 #define STREAMERCLIENT_H
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <stdbool.h>
 
 #include <grpcpp/grpcpp.h>
 #include "streamer.grpc.pb.h"
 #include "streamer.pb.h"
 
+// Keeps one long lived SendStream call open and feeds it batches of audio from
+// every recorder. Audio, signals and call starts and ends are queued by the
+// caller and sent in that order by a thread of the client's own, so neither
+// gRPC flow control nor a slow server ever holds up a recorder. Batches and
+// events that pile up behind it past their limits are dropped, oldest first.
 class StreamerClient {
     public:
         StreamerClient();
+        ~StreamerClient();
 
-        void Init(std::shared_ptr<::grpc::Channel> channel, bool enable_audio_streams);
+        void Init(std::shared_ptr<::grpc::Channel> channel, bool enable_audio_streams, int batch_ms, size_t max_pending_batches, int rpc_timeout_ms);
         void Done();
 
-        void SendAudio(const ::streamer::AudioSample& request);
+        // These never wait on the network. sample_clock is the recorder's count of samples output before these.
+        void QueueAudio(int recorder_num, long call_num, long talkgroup, int sample_rate, uint64_t sample_clock, const int16_t *samples, int sample_count);
         void SendSignal(const ::streamer::SignalInfo& request);
         void CallStarted(const ::streamer::CallInfo& request);
         void CallEnded(const ::streamer::CallInfo& request);
+
         void SetupRecorder(const ::streamer::RecorderInfo& request);
         void SetupSystem(const ::streamer::SystemInfo& request);
         void SetupSource(const ::streamer::SourceInfo& request);
         void SetupConfig(const ::streamer::ConfigInfo& request);
 
     private:
+        // Where each recorder's audio clock has got to
+        struct RecorderClock {
+            long call_num;
+            int64_t next_us;        // sample time of the next sample, microseconds since the epoch
+            uint64_t next_sample;   // the recorder's sample clock at the next sample
+        };
+
+        // What the writer thread sends, in the order it was queued
+        struct Outgoing {
+            enum Kind { AUDIO, SIGNAL, CALL_STARTED, CALL_ENDED } kind;
+            ::streamer::AudioBatch batch;
+            ::streamer::SignalInfo signal;
+            ::streamer::CallInfo call;
+        };
+
+        void Writer();
+        void QueueEvent(Outgoing &event);
+        void CloseBatch();
+        bool Send(Outgoing &item);
+        bool SendAudio(const ::streamer::AudioBatch &batch);
+        bool SendSignalInfo(const ::streamer::SignalInfo &signal);
+        bool OpenAudioStream();
+        void CloseAudioStream();
+        void CloseSignalStream();
+        void SetDeadline(::grpc::ClientContext &context);
+        void LogStatus(const char *rpc, const ::grpc::Status &status);
+
         bool m_enable_audio_streams;
+        int m_batch_ms;
+        size_t m_max_pending_batches;
+        int m_rpc_timeout_ms;
         std::unique_ptr< ::streamer::TrunkRecorderStreamer::Stub> stub_;
-        std::unique_ptr< ::grpc::ClientWriter< ::streamer::SignalInfo>> signal_writer_;
-        std::unique_ptr< ::grpc::ClientWriter< ::streamer::AudioSample>> audio_writer_;
-        ::grpc::ClientContext signal_context_;
-        ::grpc::ClientContext audio_context_;
-        ::google::protobuf::Empty signal_response_;
+
+        // Only touched from QueueAudio
+        std::map<int, RecorderClock> m_clocks;
+
+        // The batch being filled and what is waiting for the writer
+        std::mutex m_queue_mutex;
+        std::condition_variable m_queue_cond;
+        ::streamer::AudioBatch m_batch;
+        std::map<int, int> m_batch_index;    // recorder number to its last entry in m_batch
+        size_t m_batch_bytes;
+        std::chrono::steady_clock::time_point m_batch_started;
+        std::deque<Outgoing> m_pending;
+        size_t m_pending_batches;
+        size_t m_pending_events;
+        bool m_stopping;
+        bool m_writer_done;
+        unsigned long m_sent_batches;
+        unsigned long m_dropped_samples;
+        unsigned long m_dropped_events;
+        std::thread m_writer_thread;
+
+        // Owned by the writer thread. The mutex only lets Done() cancel a stuck call.
+        std::mutex m_context_mutex;
+        std::unique_ptr< ::grpc::ClientContext> audio_context_;
+        std::unique_ptr< ::grpc::ClientWriterInterface< ::streamer::AudioBatch>> audio_writer_;
         ::google::protobuf::Empty audio_response_;
+        std::chrono::steady_clock::time_point m_audio_retry;
+        bool m_audio_failed;
+        std::unique_ptr< ::grpc::ClientContext> signal_context_;
+        std::unique_ptr< ::grpc::ClientWriterInterface< ::streamer::SignalInfo>> signal_writer_;
+        ::google::protobuf::Empty signal_response_;
 };
 
-#endif // STREAMERCLIENT_H
\ No newline at end of file
+#endif // STREAMERCLIENT_H
@@ -0,0 +1,135 @@
+#include "../../trunk-recorder/plugin_manager/plugin_api.h"
+#include "../../trunk-recorder/recorders/recorder.h"
+#include "StreamerClient.h"
+#include "streamer_proto_helper.h"
+#include <boost/dll/alias.hpp> // for BOOST_DLL_ALIAS
+#include <boost/foreach.hpp>
+#include <grpcpp/grpcpp.h>
+
+class Streamer : public Plugin_Api {
+  std::string server_addr;
+  bool enable_audio_streaming = false;
+  int batch_ms = 100;
+  int max_pending_batches = 50;
+  int rpc_timeout_ms = 1000;
+  Config *config = NULL;
+  std::vector<Source *> sources;
+  std::vector<System *> systems;
+  StreamerClient client;
+
+public:
+  Streamer() {}
+
+  int init(Config *config, std::vector<Source *> sources, std::vector<System *> systems) {
+    this->config = config;
+    this->sources = sources;
+    this->systems = systems;
+    frequency_format = config->frequency_format;
+    return 0;
+  }
+
+  int parse_config(json config_data) {
+    server_addr = config_data.value("server", "");
+    enable_audio_streaming = config_data.value("streamAudio", false);
+    batch_ms = config_data.value("batchMs", 100);
+    max_pending_batches = config_data.value("maxPendingBatches", 50);
+    rpc_timeout_ms = config_data.value("rpcTimeoutMs", 1000);
+    if (server_addr.empty()) {
+      BOOST_LOG_TRIVIAL(error) << "streamer: server is required";
+      return 1;
+    }
+    BOOST_LOG_TRIVIAL(info) << "streamer: sending to " << server_addr << (enable_audio_streaming ? " with audio in batches every " + std::to_string(batch_ms) + " ms" : " without audio");
+    return 0;
+  }
+
+  int start() {
+    // Without a server there is nothing to connect to, and failing here keeps
+    // the plugin manager from calling the plugin again
+    if (server_addr.empty()) {
+      BOOST_LOG_TRIVIAL(error) << "streamer: not started, as no server is set";
+      return 1;
+    }
+    client.Init(grpc::CreateChannel(server_addr, grpc::InsecureChannelCredentials()), enable_audio_streaming, batch_ms, max_pending_batches, rpc_timeout_ms);
+    return 0;
+  }
+
+  int stop() {
+    client.Done();
+    return 0;
+  }
+
+  int signal(long unitId, const char *signaling_type, gr::blocks::SignalType sig_type, Call *call, System *system, Recorder *recorder) {
+    streamer::SignalInfo sig;
+    ToSignalInfo(unitId, signaling_type, sig_type, call, system, recorder, &sig);
+    client.SendSignal(sig);
+    return 0;
+  }
+
+  bool wants_audio() {
+    return enable_audio_streaming;
+  }
+
+  // Called on the plugin's audio thread, which the recorders never wait on
+  int audio_frame(Call *call, Recorder *recorder, Audio_Frame *frame) {
+    if (!enable_audio_streaming) {
+      return 0;
+    }
+    long talkgroup = (call != NULL) ? call->get_talkgroup() : 0;
+    client.QueueAudio(frame->rec_num, frame->call_num, talkgroup, frame->sample_rate, frame->sample_time, frame->samples, frame->count);
+    return 0;
+  }
+
+  int call_start(Call *call) {
+    streamer::CallInfo c;
+    ToCallInfo(call, &c);
+    client.CallStarted(c);
+    return 0;
+  }
+
+  int call_end(Call_Data_t call_info) {
+    streamer::CallInfo c;
+    ToCallInfo(call_info, &c);
+    client.CallEnded(c);
+    return 0;
+  }
+
+  int setup_recorder(Recorder *recorder) {
+    streamer::RecorderInfo r;
+    ToRecorderInfo(recorder, &r);
+    client.SetupRecorder(r);
+    return 0;
+  }
+
+  int setup_system(System *system) {
+    streamer::SystemInfo s;
+    ToSystemInfo(system, &s);
+    client.SetupSystem(s);
+    return 0;
+  }
+
+  int setup_sources(std::vector<Source *> sources) {
+    BOOST_FOREACH (auto source, sources) {
+      streamer::SourceInfo s;
+      ToSourceInfo(source, &s);
+      client.SetupSource(s);
+    }
+    return 0;
+  }
+
+  int setup_config(std::vector<Source *> sources, std::vector<System *> systems) {
+    streamer::ConfigInfo c;
+    ToConfigInfo(config, sources, systems, &c);
+    client.SetupConfig(c);
+    return 0;
+  }
+
+  static boost::shared_ptr<Streamer> create() {
+    return boost::shared_ptr<Streamer>(
+        new Streamer());
+  }
+};
+
+BOOST_DLL_ALIAS(
+    Streamer::create, // <-- this function is exported with...
+    create_plugin     // <-- ...this alias name
+)
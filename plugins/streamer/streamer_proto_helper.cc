@@ -1,36 +1,25 @@
 #include "streamer_proto_helper.h"
-#include "../../state.h"
+#include "../../trunk-recorder/state.h"
 #include <vector>
-#include <boost/algorithm/string.hpp>
-#include <boost/foreach.hpp>
-#include <google/protobuf/util/time_util.h>
+#include <boost/lexical_cast.hpp>
 
-streamer::AudioSample* ToAudioSample(Recorder *recorder, float *samples, int sampleCount) {
-    streamer::AudioSample* a;
-    //a->set_sample_time(google::protobuf::util::TimeUtil::GetCurrentTime());
-    a->set_sample(samples, sampleCount);
-    if(recorder != NULL) {
-        a->set_recorder_num(recorder->get_num());
+void ToCallInfo(Call *call, streamer::CallInfo *ci) {
+    ci->set_call_active(call->get_state() != INACTIVE);
+    if(call->get_recorder() != NULL) {
+        ci->set_recorder_num(call->get_recorder()->get_num());
     }
-
-    return a;
-}
-
-streamer::CallInfo* ToCallInfo(Call *call) {
-    if(call == NULL) return NULL;
-
-    streamer::CallInfo* ci;
-    ci->set_call_active(call->get_state() == INACTIVE);
-    ci->set_recorder_num(call->get_recorder()->get_num());
     ci->set_system_num(call->get_sys_num());
     ci->set_curr_freq(call->get_freq());
-    //
-    return ci;
 }
 
-streamer::SystemInfo* ToSystemInfo(System *system) {
-    if(system == NULL) return NULL;
-    streamer::SystemInfo* si;
+void ToCallInfo(const Call_Data_t &call_info, streamer::CallInfo *ci) {
+    ci->set_call_active(false);
+    ci->set_recorder_num(call_info.recorder_num);
+    ci->set_system_num(call_info.sys_num);
+    ci->set_curr_freq(call_info.freq);
+}
+
+void ToSystemInfo(System *system, streamer::SystemInfo *si) {
     si->set_system_num(system->get_sys_num());
     si->set_system_type(system->get_system_type());
     si->set_system_name(system->get_short_name());
@@ -46,7 +35,7 @@ streamer::SystemInfo* ToSystemInfo(System *system) {
 
     std::vector<double> channels;
 
-    if ((system->get_system_type() == "conventional") || (system->get_system_type() == "conventionalP25") || (sys->get_system_type() == "conventionalDMR") || (sys->get_system_type() == "conventionalSIGMF")) {
+    if ((system->get_system_type() == "conventional") || (system->get_system_type() == "conventionalP25") || (system->get_system_type() == "conventionalDMR") || (system->get_system_type() == "conventionalSIGMF")) {
       channels = system->get_channels();
     } else {
       channels = system->get_control_channels();
@@ -63,12 +52,9 @@ streamer::SystemInfo* ToSystemInfo(System *system) {
     si->set_bandplan_high(system->get_bandplan_high());
     si->set_bandplan_spacing(system->get_bandplan_spacing());
     si->set_bandplan_offset(system->get_bandplan_offset());
-    return si;
 }
 
-streamer::SourceInfo* ToSourceInfo(Source *source) { 
-    if(source == NULL) return NULL;
-    streamer::SourceInfo* si;
+void ToSourceInfo(Source *source, streamer::SourceInfo *si) {
     si->set_source_num(source->get_num());
     si->set_min_hz(source->get_min_hz());
     si->set_max_hz(source->get_max_hz());
@@ -89,25 +75,39 @@ streamer::SourceInfo* ToSourceInfo(Source *source) {
     si->set_digital_recorders(source->digital_recorder_count());
     si->set_debug_recorders(source->debug_recorder_count());
     si->set_sigmf_recorders(source->sigmf_recorder_count());
-    //
-    return si;
 }
 
-streamer::RecorderInfo* ToRecorderInfo(Recorder *recorder) {
-    if(recorder == NULL) return NULL;
-
-    streamer::RecorderInfo* ri;
+void ToRecorderInfo(Recorder *recorder, streamer::RecorderInfo *ri) {
     ri->set_recorder_num(recorder->get_num());
     ri->set_recorder_type(recorder->get_type_string());
     ri->set_source_num(recorder->get_source()->get_num());
     ri->set_id(boost::lexical_cast<std::string>(recorder->get_source()->get_num()) + "_" + boost::lexical_cast<std::string>(recorder->get_num()));
     ri->set_recorder_count(recorder->get_recording_count());
     ri->set_recorder_duration(recorder->get_recording_duration());
-    ri->set_audio_sample_rate(recorder->get_output_sample_rate());
+    State state = recorder->get_state();
+    if (state <= ACTIVE) {
+        ri->set_recorder_state((::streamer::RecorderInfo_RecorderState)state);
+    }
+    // Plugins are handed 16 bit audio at the recorder's WAV rate
+    ri->set_audio_sample_rate(recorder->get_wav_hz());
     ri->set_audio_channels(recorder->get_output_channels());
-    ri->set_audio_format(::streamer::RecorderInfo_AudioFormat_Float32);
-    //
-    return ri;
+    ri->set_audio_format(::streamer::RecorderInfo_AudioFormat_Signed16);
+}
+
+void ToConfigInfo(Config *config, std::vector<Source *> sources, std::vector<System *> systems, streamer::ConfigInfo *ci) {
+    for(std::vector<Source *>::iterator it = sources.begin(); it != sources.end(); it++) {
+        ToSourceInfo(*it, ci->add_sources());
+    }
+    for(std::vector<System *>::iterator it = systems.begin(); it != systems.end(); it++) {
+        ToSystemInfo(*it, ci->add_systems());
+    }
+    ci->set_capture_dir(config->capture_dir);
+    ci->set_upload_server(config->upload_server);
+    ci->set_call_timeout(config->call_timeout);
+    ci->set_log_file(config->log_file);
+    ci->set_instance_id(config->instance_id);
+    ci->set_instance_key(config->instance_key);
+    ci->set_broadcast_signals(config->broadcast_signals);
 }
 
 ::streamer::SignalInfo_SignalType ToSignalType(gr::blocks::SignalType sig_type) {
@@ -126,13 +126,17 @@ streamer::RecorderInfo* ToRecorderInfo(Recorder *recorder) {
     }
 }
 
-streamer::SignalInfo* ToSignalInfo(long unitId, const char *signaling_type, gr::blocks::SignalType sig_type, Call *call, System *system, Recorder *recorder) {
-    streamer::SignalInfo* si;
+void ToSignalInfo(long unitId, const char *signaling_type, gr::blocks::SignalType sig_type, Call *call, System *system, Recorder *recorder, streamer::SignalInfo *si) {
     si->set_unit_id(unitId);
     si->set_signaling_type(signaling_type);
     si->set_signal_type(ToSignalType(sig_type));
-    si->set_allocated_call_info(ToCallInfo(call));
-    si->set_allocated_system_info(ToSystemInfo(system));
-    si->set_allocated_recorder_info(ToRecorderInfo(recorder));
-    return si;
+    if(call != NULL) {
+        ToCallInfo(call, si->mutable_call_info());
+    }
+    if(system != NULL) {
+        ToSystemInfo(system, si->mutable_system_info());
+    }
+    if(recorder != NULL) {
+        ToRecorderInfo(recorder, si->mutable_recorder_info());
+    }
 }
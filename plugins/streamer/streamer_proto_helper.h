@@ -2,16 +2,18 @@
 #define STREAMER_PROTO_HELPER_H
 
 #include "streamer.pb.h"
-#include "../../call.h"
-#include "../../recorders/recorder.h"
-#include "../../systems/system.h"
-#include "../../source.h"
+#include "../../trunk-recorder/call.h"
+#include "../../trunk-recorder/global_structs.h"
+#include "../../trunk-recorder/recorders/recorder.h"
+#include "../../trunk-recorder/systems/system.h"
+#include "../../trunk-recorder/source.h"
 
-streamer::AudioSample* ToAudioSample(Recorder *recorder, float *samples, int sampleCount);
-streamer::CallInfo* ToCallInfo(Call *call);
-streamer::SystemInfo* ToSystemInfo(System *system);
-streamer::SourceInfo* ToSourceInfo(Source *source);
-streamer::RecorderInfo* ToRecorderInfo(Recorder *recorder);
-streamer::SignalInfo* ToSignalInfo(long unitId, const char *signaling_type, gr::blocks::SignalType sig_type, Call *call, System *system, Recorder *recorder);
+void ToCallInfo(Call *call, streamer::CallInfo *ci);
+void ToCallInfo(const Call_Data_t &call_info, streamer::CallInfo *ci);
+void ToSystemInfo(System *system, streamer::SystemInfo *si);
+void ToSourceInfo(Source *source, streamer::SourceInfo *si);
+void ToRecorderInfo(Recorder *recorder, streamer::RecorderInfo *ri);
+void ToConfigInfo(Config *config, std::vector<Source *> sources, std::vector<System *> systems, streamer::ConfigInfo *ci);
+void ToSignalInfo(long unitId, const char *signaling_type, gr::blocks::SignalType sig_type, Call *call, System *system, Recorder *recorder, streamer::SignalInfo *si);
 
-#endif // STREAMER_PROTO_HELPER_H
\ No newline at end of file
+#endif // STREAMER_PROTO_HELPER_H
@@ -3,152 +3,443 @@
 #include <boost/dll/alias.hpp> // for BOOST_DLL_ALIAS
 #include <boost/foreach.hpp>
 
+#include <chrono>
+#include <condition_variable>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+// Only Linux has MSG_NOSIGNAL, the BSDs and macOS set SO_NOSIGPIPE on the socket instead
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+extern char **environ;
+
+static const int UNIT_SCRIPT_RESTART_MS = 1000; // the least time between starts of a persistent script, so one that keeps failing is not started for every event
+static const int UNIT_SCRIPT_SEND_TIMEOUT_MS = 1000; // a persistent script that stops reading for this long is restarted
+static const int UNIT_SCRIPT_REAP_MS = 10;     // how often to look for finished scripts while at the process limit
 
 struct Unit_Script_System_Script {
   std::string script;
   std::string short_name;
+  bool persistent;
+};
+
+struct Unit_Script_Event {
+  std::string script;
+  bool persistent;
+  long source_id;
+  std::vector<std::string> args; // shortName radioID action [talkgroup [patchedTalkgroups]]
+  std::chrono::steady_clock::time_point ready;
+};
+
+// A script that is started once and sent a line on stdin for each event
+struct Unit_Script_Process {
+  pid_t pid;
+  int fd;
+  std::chrono::steady_clock::time_point retry;
 };
 
+// Unit events are queued by the callbacks, which run on the message loop,
+// and run by a thread of the plugin's own, so a slow or busy script never
+// holds up a grant. The queue is bounded and drops its oldest events when
+// full. With unitScriptCoalesceMs set, an event waits that long before it is
+// run and is replaced by any newer event for the same unit in the meantime.
 class Unit_Script : public Plugin_Api {
-    std::vector<Unit_Script_System_Script> system_scripts;
-std::map<long, long> unit_affiliations;
+  std::vector<Unit_Script_System_Script> system_scripts;
+  std::map<long, long> unit_affiliations;
+  size_t queue_size = 1024;
+  size_t max_processes = 16;
+  int coalesce_ms = 0;
+
+  std::mutex event_mutex;
+  std::condition_variable event_cond;
+  std::list<Unit_Script_Event> events;
+  std::map<std::pair<std::string, long>, std::list<Unit_Script_Event>::iterator> pending_units; // only used when coalescing
+  bool stopping = false;
+  unsigned long dropped = 0;
+  unsigned long coalesced = 0;
+  std::thread worker;
+
+  // Only touched by the worker
+  std::vector<pid_t> children;
+  std::map<std::string, Unit_Script_Process> processes;
+  std::set<std::string> failed_scripts;
+  unsigned long dropped_logged = 0;
+
 public:
-  std::string get_system_script(std::string short_name) {
+  Unit_Script_System_Script *get_system_script(std::string short_name) {
     for (std::vector<Unit_Script_System_Script>::iterator it = system_scripts.begin(); it != system_scripts.end(); ++it) {
-      Unit_Script_System_Script system_script = *it;
-      if (system_script.short_name == short_name){
-        return system_script.script;
+      if (it->short_name == short_name) {
+        return &(*it);
       }
     }
-    return "";
+    return NULL;
   }
 
-int unit_registration(System *sys, long source_id) {
-    unit_affiliations[source_id] = 0;
-  std::string system_script = get_system_script(sys->get_short_name());
-  if ((system_script != "") && (source_id != 0)) {
-    char shell_command[200];
-    snprintf(shell_command, 200, "%s %s %li on &", system_script.c_str(), sys->get_short_name().c_str(), source_id);
-    int rc __attribute__((unused)) =  system(shell_command);
+  // The action and talkgroup, then the patched talkgroups if there are any
+  std::vector<std::string> talkgroup_args(std::string action, System *sys, long talkgroup_num) {
+    std::vector<std::string> args = {action, std::to_string(talkgroup_num)};
+    std::vector<unsigned long> talkgroup_patches = sys->get_talkgroup_patch(talkgroup_num);
+    std::string patch_string;
+    bool first = true;
+    BOOST_FOREACH (auto &TGID, talkgroup_patches) {
+      if (!first) {
+        patch_string += ",";
+      }
+      first = false;
+      patch_string += std::to_string(TGID);
+    }
+    if (!patch_string.empty()) {
+      args.push_back(patch_string);
+    }
+    return args;
+  }
+
+  // Returns 1 when the system has no script, like the callbacks always have
+  int queue_event(std::string short_name, long source_id, std::vector<std::string> extra_args) {
+    Unit_Script_System_Script *system_script = get_system_script(short_name);
+    if ((system_script == NULL) || (source_id == 0)) {
+      return 1;
+    }
+
+    Unit_Script_Event event;
+    event.script = system_script->script;
+    event.persistent = system_script->persistent;
+    event.source_id = source_id;
+    event.args.push_back(short_name);
+    event.args.push_back(std::to_string(source_id));
+    event.args.insert(event.args.end(), extra_args.begin(), extra_args.end());
+    event.ready = std::chrono::steady_clock::now() + std::chrono::milliseconds(coalesce_ms);
+
+    std::lock_guard<std::mutex> lock(event_mutex);
+    if (stopping) {
+      return 0;
+    }
+    std::pair<std::string, long> unit(short_name, source_id);
+    if (coalesce_ms > 0) {
+      std::map<std::pair<std::string, long>, std::list<Unit_Script_Event>::iterator>::iterator it = pending_units.find(unit);
+      if (it != pending_units.end()) {
+        it->second->args = event.args;
+        coalesced++;
+        return 0;
+      }
+    }
+    if (events.size() >= queue_size) {
+      if (coalesce_ms > 0) {
+        pending_units.erase(std::make_pair(events.front().args[0], events.front().source_id));
+      }
+      events.pop_front();
+      dropped++;
+    }
+    events.push_back(event);
+    if (coalesce_ms > 0) {
+      pending_units[unit] = std::prev(events.end());
+    }
+    event_cond.notify_one();
     return 0;
   }
-    return 1;
-}
 
-int unit_deregistration(System *sys, long source_id) { 
-    unit_affiliations[source_id] = -1;
-  std::string system_script = get_system_script(sys->get_short_name());
-  if ((system_script != "") && (source_id != 0)) {
-    char shell_command[200];
-    snprintf(shell_command, 200, "%s %s %li off &", system_script.c_str(), sys->get_short_name().c_str(), source_id);
-    int rc __attribute__((unused)) =  system(shell_command);
+  void reap_children() {
+    for (std::vector<pid_t>::iterator it = children.begin(); it != children.end();) {
+      if (waitpid(*it, NULL, WNOHANG) != 0) {
+        it = children.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  bool is_stopping() {
+    std::lock_guard<std::mutex> lock(event_mutex);
+    return stopping;
+  }
+
+  // Runs the script with the event as its arguments, without a shell and without waiting for it
+  void spawn_script(const Unit_Script_Event &event) {
+    reap_children();
+    while (children.size() >= max_processes) {
+      if (is_stopping()) {
+        return;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(UNIT_SCRIPT_REAP_MS));
+      reap_children();
+    }
+
+    std::vector<char *> argv;
+    argv.push_back(const_cast<char *>(event.script.c_str()));
+    for (std::vector<std::string>::const_iterator it = event.args.begin(); it != event.args.end(); ++it) {
+      argv.push_back(const_cast<char *>(it->c_str()));
+    }
+    argv.push_back(NULL);
+
+    pid_t pid;
+    int err = posix_spawnp(&pid, argv[0], NULL, NULL, argv.data(), environ);
+    if (err != 0) {
+      if (failed_scripts.insert(event.script).second) {
+        BOOST_LOG_TRIVIAL(error) << "Unit Script: unable to run " << event.script << ": " << std::strerror(err);
+      }
+      return;
+    }
+    failed_scripts.erase(event.script);
+    children.push_back(pid);
+  }
+
+  bool start_process(const std::string &script, Unit_Script_Process &process) {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0) {
+      BOOST_LOG_TRIVIAL(error) << "Unit Script: unable to create a socket for " << script << ": " << std::strerror(errno);
+      return false;
+    }
+    // Other scripts must not inherit this one's stdin. SOCK_CLOEXEC would do it
+    // in one go, but only Linux has it.
+    fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+    fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+    // A socket rather than a pipe, so a script that has gone away is an error from send() and not a SIGPIPE
+    struct timeval timeout = {UNIT_SCRIPT_SEND_TIMEOUT_MS / 1000, (UNIT_SCRIPT_SEND_TIMEOUT_MS % 1000) * 1000};
+    setsockopt(fds[0], SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#ifdef SO_NOSIGPIPE
+    int no_sigpipe = 1;
+    setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fds[1], STDIN_FILENO);
+    char *argv[] = {const_cast<char *>(script.c_str()), NULL};
+    pid_t pid;
+    int err = posix_spawnp(&pid, argv[0], &actions, NULL, argv, environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(fds[1]);
+
+    if (err != 0) {
+      close(fds[0]);
+      if (failed_scripts.insert(script).second) {
+        BOOST_LOG_TRIVIAL(error) << "Unit Script: unable to run " << script << ": " << std::strerror(err);
+      }
+      return false;
+    }
+    failed_scripts.erase(script);
+    process.pid = pid;
+    process.fd = fds[0];
+    process.retry = std::chrono::steady_clock::now() + std::chrono::milliseconds(UNIT_SCRIPT_RESTART_MS);
+    BOOST_LOG_TRIVIAL(info) << "Unit Script: started " << script << " - PID: " << pid;
+    return true;
+  }
+
+  void stop_process(Unit_Script_Process &process) {
+    if (process.fd >= 0) {
+      close(process.fd);
+      process.fd = -1;
+    }
+    if (process.pid > 0) {
+      if (waitpid(process.pid, NULL, WNOHANG) == 0) {
+        // Still running but not reading; it gets EOF on stdin and a SIGTERM
+        kill(process.pid, SIGTERM);
+        children.push_back(process.pid);
+      }
+      process.pid = -1;
+    }
+  }
+
+  // Writes the event as a line of space separated arguments to the script's stdin
+  void send_to_process(const Unit_Script_Event &event) {
+    std::map<std::string, Unit_Script_Process>::iterator it = processes.find(event.script);
+    if (it == processes.end()) {
+      Unit_Script_Process process;
+      process.pid = -1;
+      process.fd = -1;
+      it = processes.insert(std::make_pair(event.script, process)).first;
+    }
+    Unit_Script_Process &process = it->second;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    if ((process.fd >= 0) && (waitpid(process.pid, NULL, WNOHANG) != 0)) {
+      BOOST_LOG_TRIVIAL(error) << "Unit Script: " << event.script << " exited, restarting it";
+      process.pid = -1;
+      stop_process(process);
+    }
+    if (process.fd < 0) {
+      if (now < process.retry) {
+        return;
+      }
+      if (!start_process(event.script, process)) {
+        process.retry = now + std::chrono::milliseconds(UNIT_SCRIPT_RESTART_MS);
+        return;
+      }
+    }
+
+    std::string line;
+    for (std::vector<std::string>::const_iterator arg = event.args.begin(); arg != event.args.end(); ++arg) {
+      if (arg != event.args.begin()) {
+        line += " ";
+      }
+      line += *arg;
+    }
+    line += "\n";
+
+    size_t sent = 0;
+    while (sent < line.size()) {
+      ssize_t n = send(process.fd, line.data() + sent, line.size() - sent, MSG_NOSIGNAL);
+      if (n < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        BOOST_LOG_TRIVIAL(error) << "Unit Script: unable to send to " << event.script << ": " << std::strerror(errno) << ", restarting it";
+        stop_process(process);
+        return;
+      }
+      sent += n;
+    }
+  }
+
+  void run_events() {
+    std::unique_lock<std::mutex> lock(event_mutex);
+    while (true) {
+      reap_children();
+      if (events.empty()) {
+        if (stopping) {
+          break;
+        }
+        event_cond.wait_for(lock, std::chrono::seconds(1));
+        continue;
+      }
+      // Events are queued in the order they become ready, so only the front needs checking
+      if (!stopping && (events.front().ready > std::chrono::steady_clock::now())) {
+        event_cond.wait_until(lock, events.front().ready);
+        continue;
+      }
+
+      Unit_Script_Event event = events.front();
+      if (coalesce_ms > 0) {
+        pending_units.erase(std::make_pair(event.args[0], event.source_id));
+      }
+      events.pop_front();
+      unsigned long dropped_now = dropped;
+      lock.unlock();
+
+      if (dropped_now != dropped_logged) {
+        BOOST_LOG_TRIVIAL(error) << "Unit Script: queue full, dropped " << (dropped_now - dropped_logged) << " events";
+        dropped_logged = dropped_now;
+      }
+      if (event.persistent) {
+        send_to_process(event);
+      } else {
+        spawn_script(event);
+      }
+
+      lock.lock();
+    }
+    lock.unlock();
+
+    // The persistent scripts get EOF on stdin; anything still running is left to finish
+    for (std::map<std::string, Unit_Script_Process>::iterator it = processes.begin(); it != processes.end(); ++it) {
+      if (it->second.fd >= 0) {
+        close(it->second.fd);
+        it->second.fd = -1;
+        children.push_back(it->second.pid);
+      }
+    }
+    reap_children();
+  }
+
+  int start() {
+    std::lock_guard<std::mutex> lock(event_mutex);
+    if (!system_scripts.empty() && !worker.joinable()) {
+      stopping = false;
+      worker = std::thread(&Unit_Script::run_events, this);
+    }
     return 0;
   }
-    return 1;
-}  
-int unit_acknowledge_response(System *sys, long source_id) { 
-  std::string system_script = get_system_script(sys->get_short_name());
-  if ((system_script != "") && (source_id != 0)) {
-    char shell_command[200];
-    snprintf(shell_command,200, "%s %s %li ackresp &", system_script.c_str(), sys->get_short_name().c_str(), source_id);
-    int rc __attribute__((unused)) =  system(shell_command);
+
+  int stop() {
+    {
+      std::lock_guard<std::mutex> lock(event_mutex);
+      stopping = true;
+    }
+    event_cond.notify_all();
+    if (worker.joinable()) {
+      worker.join();
+      BOOST_LOG_TRIVIAL(info) << "Unit Script: dropped " << dropped << " events, coalesced " << coalesced;
+    }
     return 0;
   }
-    return 1;
-}
 
-int unit_group_affiliation(System *sys, long source_id, long talkgroup_num) {
+  int unit_registration(System *sys, long source_id) {
+    unit_affiliations[source_id] = 0;
+    return queue_event(sys->get_short_name(), source_id, {"on"});
+  }
+
+  int unit_deregistration(System *sys, long source_id) {
+    unit_affiliations[source_id] = -1;
+    return queue_event(sys->get_short_name(), source_id, {"off"});
+  }
+
+  int unit_acknowledge_response(System *sys, long source_id) {
+    return queue_event(sys->get_short_name(), source_id, {"ackresp"});
+  }
+
+  int unit_group_affiliation(System *sys, long source_id, long talkgroup_num) {
     unit_affiliations[source_id] = talkgroup_num;
-    std::string system_script = get_system_script(sys->get_short_name());
-  if ((system_script != "") && (source_id != 0)) {
-    char shell_command[200];
-    std::vector<unsigned long> talkgroup_patches = sys->get_talkgroup_patch(talkgroup_num);
-    std::string patch_string;
-    bool first = true;
-    BOOST_FOREACH (auto& TGID, talkgroup_patches) {
-      if (!first) { patch_string += ","; }
-      first = false;
-      patch_string += std::to_string(TGID);
+    if (get_system_script(sys->get_short_name()) == NULL) {
+      return 1;
     }
-    snprintf(shell_command, 200, "%s %s %li join %li %s &", system_script.c_str(), sys->get_short_name().c_str(), source_id, talkgroup_num, patch_string.c_str());
-    int rc __attribute__((unused)) =  system(shell_command);
-    return 0;
+    return queue_event(sys->get_short_name(), source_id, talkgroup_args("join", sys, talkgroup_num));
   }
-    return 1;
-}
 
-int unit_data_grant(System *sys, long source_id) {
-    std::string system_script = get_system_script(sys->get_short_name());
-  if ((system_script != "") && (source_id != 0)) {
-    char shell_command[200];
-    snprintf(shell_command, 200, "%s %s %li data &", system_script.c_str(), sys->get_short_name().c_str(), source_id);
-    int rc __attribute__((unused)) =  system(shell_command);
-    return 0;
+  int unit_data_grant(System *sys, long source_id) {
+    return queue_event(sys->get_short_name(), source_id, {"data"});
   }
-    return 1;
-}
 
-int unit_answer_request(System *sys, long source_id, long talkgroup) {
-    std::string system_script = get_system_script(sys->get_short_name());
-  if ((system_script != "") && (source_id != 0)) {
-    char shell_command[200];
-    snprintf(shell_command, 200, "%s %s %li ans_req %li &", system_script.c_str(), sys->get_short_name().c_str(), source_id, talkgroup);
-    int rc __attribute__((unused)) =  system(shell_command);
-    return 0;
+  int unit_answer_request(System *sys, long source_id, long talkgroup) {
+    return queue_event(sys->get_short_name(), source_id, {"ans_req", std::to_string(talkgroup)});
   }
-    return 1;
-}
 
-int unit_location(System *sys, long source_id, long talkgroup_num) {
+  int unit_location(System *sys, long source_id, long talkgroup_num) {
     unit_affiliations[source_id] = talkgroup_num;
-    std::string system_script = get_system_script(sys->get_short_name());
-  if ((system_script != "") && (source_id != 0)) {
-    char shell_command[200];
-    std::vector<unsigned long> talkgroup_patches = sys->get_talkgroup_patch(talkgroup_num);
-    std::string patch_string;
-    bool first = true;
-    BOOST_FOREACH (auto& TGID, talkgroup_patches) {
-      if (!first) { patch_string += ","; }
-      first = false;
-      patch_string += std::to_string(TGID);
+    if (get_system_script(sys->get_short_name()) == NULL) {
+      return 1;
     }
-    snprintf(shell_command, 200, "%s %s %li location %li %s &", system_script.c_str(), sys->get_short_name().c_str(), source_id, talkgroup_num, patch_string.c_str());
-    int rc __attribute__((unused)) =  system(shell_command);
-    return 0;
+    return queue_event(sys->get_short_name(), source_id, talkgroup_args("location", sys, talkgroup_num));
   }
-    return 1;
-}
 
-int call_start(Call *call) {
+  int call_start(Call *call) {
     long talkgroup_num = call->get_talkgroup();
-    long source_id = call->get_current_source_id();
     std::string short_name = call->get_short_name();
-    std::string system_script = get_system_script(short_name);
-  if ((system_script != "") && (source_id != 0)) {
-    char shell_command[200];
-    std::vector<unsigned long> talkgroup_patches = call->get_system()->get_talkgroup_patch(talkgroup_num);
-    std::string patch_string;
-    bool first = true;
-    BOOST_FOREACH (auto& TGID, talkgroup_patches) {
-      if (!first) { patch_string += ","; }
-      first = false;
-      patch_string += std::to_string(TGID);
+    if (get_system_script(short_name) == NULL) {
+      return 1;
     }
-    snprintf(shell_command, 200, "%s %s %li call %li %s &", system_script.c_str(), short_name.c_str(), source_id, talkgroup_num, patch_string.c_str());
-    int rc __attribute__((unused)) =  system(shell_command);
-    return 0;
+    return queue_event(short_name, call->get_current_source_id(), talkgroup_args("call", call->get_system(), talkgroup_num));
   }
-    return 1;
-}
 
   int parse_config(json config_data) {
+    queue_size = config_data.value("unitScriptQueueSize", queue_size);
+    if (queue_size < 1) {
+      queue_size = 1;
+    }
+    max_processes = config_data.value("unitScriptMaxProcesses", max_processes);
+    if (max_processes < 1) {
+      max_processes = 1;
+    }
+    coalesce_ms = config_data.value("unitScriptCoalesceMs", coalesce_ms);
 
     for (json element : config_data["systems"]) {
       Unit_Script_System_Script system_script;
       system_script.script = element.value("unitScript", "");
       system_script.short_name = element.value("shortName", "");
+      system_script.persistent = element.value("unitScriptPersistent", false);
       if (system_script.script != "") {
-        BOOST_LOG_TRIVIAL(info) << "\t- [" << system_script.short_name << "]: " << system_script.script ;
+        BOOST_LOG_TRIVIAL(info) << "\t- [" << system_script.short_name << "]: " << system_script.script << (system_script.persistent ? " (persistent)" : "");
         this->system_scripts.push_back(system_script);
       }
     }
@@ -164,5 +455,5 @@ int call_start(Call *call) {
 
 BOOST_DLL_ALIAS(
     Unit_Script::create, // <-- this function is exported with...
-    create_plugin             // <-- ...this alias name
+    create_plugin        // <-- ...this alias name
 )
@@ -0,0 +1,245 @@
+// Checks the frame pool and rings that carry a recorder's audio to the
+// plugins: frames released on a plugin's audio thread go back to the pool,
+// a pool that runs dry drops the audio for every ring and counts it, and a
+// frame a plugin keeps is not reused while the recorder goes on pushing.
+
+#include "../trunk-recorder/plugin_manager/audio_tap.h"
+#include "../trunk-recorder/recorders/recorder.h"
+
+#include <atomic>
+#include <iostream>
+#include <set>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                         \
+  do {                                                                      \
+    if (!(cond)) {                                                          \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": " << #cond << std::endl; \
+      failures++;                                                           \
+    }                                                                       \
+  } while (0)
+
+static const size_t CHUNK_SAMPLES = 160;
+
+static void fill(int16_t *samples, size_t n, int16_t value) {
+  for (size_t i = 0; i < n; i++) {
+    samples[i] = value;
+  }
+}
+
+// Pops everything queued on a ring, keeping each frame as a plugin would
+static void keep_all(audio_tap_ring *ring, std::vector<Audio_Frame *> &kept) {
+  audio_tap_chunk *chunk;
+  while ((chunk = ring->front()) != NULL) {
+    chunk->frame->retain();
+    kept.push_back(chunk->frame);
+    ring->pop();
+  }
+}
+
+static void pop_all(audio_tap_ring *ring) {
+  while (ring->front() != NULL) {
+    ring->pop();
+  }
+}
+
+// The recorder takes every frame, another thread hands them all back, and
+// the recorder can take each of them again
+static void test_release_from_other_thread() {
+  Audio_Frame_Pool pool(8);
+  std::vector<Audio_Frame *> taken;
+  for (size_t i = 0; i < pool.size(); i++) {
+    Audio_Frame *frame = pool.take();
+    CHECK(frame != NULL);
+    taken.push_back(frame);
+  }
+  CHECK(pool.take() == NULL);
+  CHECK(pool.exhausted() == 1);
+
+  std::thread plugin([&taken] {
+    for (size_t i = 0; i < taken.size(); i++) {
+      taken[i]->release();
+    }
+  });
+  plugin.join();
+
+  std::set<Audio_Frame *> again;
+  for (size_t i = 0; i < pool.size(); i++) {
+    Audio_Frame *frame = pool.take();
+    CHECK(frame != NULL);
+    again.insert(frame);
+  }
+  CHECK(again == std::set<Audio_Frame *>(taken.begin(), taken.end()));
+  CHECK(pool.take() == NULL);
+  CHECK(pool.exhausted() == 2);
+}
+
+// A small pool passed through a ring to a consumer thread many times over
+static void test_pool_cycles_through_ring() {
+  const int frames = 100000;
+  Audio_Frame_Pool pool(4);
+  audio_tap_ring ring(4);
+  std::atomic<bool> done(false);
+  int received = 0;
+  bool in_order = true;
+
+  std::thread plugin([&] {
+    int expected = 0;
+    for (;;) {
+      audio_tap_chunk *chunk = ring.front();
+      if (chunk == NULL) {
+        if (done) {
+          if (ring.front() == NULL) {
+            break;
+          }
+          continue;
+        }
+        std::this_thread::yield();
+        continue;
+      }
+      if (chunk->frame->samples[0] != (int16_t)expected) {
+        in_order = false;
+      }
+      expected++;
+      received++;
+      ring.pop();
+    }
+  });
+
+  for (int i = 0; i < frames; i++) {
+    Audio_Frame *frame;
+    while ((frame = pool.take()) == NULL) {
+      std::this_thread::yield();
+    }
+    frame->count = 1;
+    frame->samples[0] = (int16_t)i;
+    while (!ring.push(NULL, frame)) {
+      std::this_thread::yield();
+    }
+    frame->release();
+  }
+  done = true;
+  plugin.join();
+
+  CHECK(received == frames);
+  CHECK(in_order);
+  for (size_t i = 0; i < pool.size(); i++) {
+    CHECK(pool.take() != NULL);
+  }
+}
+
+// Once the plugins are keeping every frame of the pool, the audio is dropped
+// and counted for each ring, and a released frame lets it through again
+static void test_dry_pool_drops_for_every_ring() {
+  Recorder recorder(ANALOG);
+  recorder.rec_num = 3;
+  Audio_Tap tap(&recorder);
+  audio_tap_ring *first = tap.add_ring();
+  audio_tap_ring *second = tap.add_ring();
+  int16_t samples[CHUNK_SAMPLES];
+  fill(samples, CHUNK_SAMPLES, 1);
+
+  std::vector<Audio_Frame *> kept;
+  for (size_t i = 0; i < AUDIO_TAP_FRAMES; i++) {
+    tap.push(NULL, samples, CHUNK_SAMPLES);
+    keep_all(first, kept);
+    pop_all(second);
+  }
+  CHECK(kept.size() == AUDIO_TAP_FRAMES);
+  CHECK(first->dropped() == 0);
+  CHECK(second->dropped() == 0);
+
+  size_t pushed_first = first->pushed();
+  size_t pushed_second = second->pushed();
+  tap.push(NULL, samples, CHUNK_SAMPLES);
+  tap.push(NULL, samples, CHUNK_SAMPLES);
+  CHECK(first->pushed() == pushed_first);
+  CHECK(second->pushed() == pushed_second);
+  CHECK(first->dropped() == 2 * CHUNK_SAMPLES);
+  CHECK(second->dropped() == 2 * CHUNK_SAMPLES);
+
+  kept.back()->release();
+  kept.pop_back();
+  tap.push(NULL, samples, CHUNK_SAMPLES);
+  CHECK(first->pushed() == pushed_first + 1);
+  CHECK(second->pushed() == pushed_second + 1);
+  CHECK(first->dropped() == 2 * CHUNK_SAMPLES);
+
+  // The sample clock still counts the dropped audio
+  audio_tap_chunk *chunk = first->front();
+  CHECK(chunk != NULL);
+  if (chunk != NULL) {
+    CHECK(chunk->frame->rec_num == 3);
+    CHECK(chunk->frame->sample_time == (AUDIO_TAP_FRAMES + 2) * CHUNK_SAMPLES);
+  }
+  pop_all(first);
+  pop_all(second);
+
+  for (size_t i = 0; i < kept.size(); i++) {
+    kept[i]->release();
+  }
+}
+
+// A kept frame holds its audio while the tap pushes, and the plugin's other
+// ring pops, far more frames than the pool has
+static void test_kept_frame_intact() {
+  Recorder recorder(ANALOG);
+  recorder.rec_num = 4;
+  Audio_Tap tap(&recorder);
+  audio_tap_ring *keeper = tap.add_ring();
+  audio_tap_ring *other = tap.add_ring();
+  int16_t samples[CHUNK_SAMPLES];
+
+  fill(samples, CHUNK_SAMPLES, 7);
+  tap.push(NULL, samples, CHUNK_SAMPLES);
+  audio_tap_chunk *chunk = keeper->front();
+  CHECK(chunk != NULL);
+  if (chunk == NULL) {
+    return;
+  }
+  Audio_Frame *frame = chunk->frame;
+  frame->retain();
+  keeper->pop();
+  pop_all(other);
+
+  std::atomic<bool> done(false);
+  std::thread plugin([&] {
+    while (!done || (other->front() != NULL)) {
+      pop_all(other);
+      std::this_thread::yield();
+    }
+  });
+  for (size_t i = 0; i < 10 * AUDIO_TAP_FRAMES; i++) {
+    fill(samples, CHUNK_SAMPLES, (int16_t)(100 + i));
+    tap.push(NULL, samples, CHUNK_SAMPLES);
+    pop_all(keeper);
+  }
+  done = true;
+  plugin.join();
+
+  CHECK(frame->count == CHUNK_SAMPLES);
+  CHECK(frame->sample_time == 0);
+  CHECK(frame->rec_num == 4);
+  bool intact = true;
+  for (size_t i = 0; i < frame->count; i++) {
+    intact = intact && (frame->samples[i] == 7);
+  }
+  CHECK(intact);
+  frame->release();
+}
+
+int main() {
+  test_release_from_other_thread();
+  test_pool_cycles_through_ring();
+  test_dry_pool_drops_for_every_ring();
+  test_kept_frame_intact();
+
+  if (failures) {
+    std::cerr << failures << " checks failed" << std::endl;
+    return 1;
+  }
+  return 0;
+}
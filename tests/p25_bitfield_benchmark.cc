@@ -0,0 +1,88 @@
+// Times loading TSBKs and pulling out the fields of a group voice grant with
+// P25_Bitfield, against the dynamic_bitset the parser used before.
+//
+//   p25_bitfield_benchmark [tsbks]
+
+#include "../trunk-recorder/systems/p25_bitfield.h"
+
+#include <boost/dynamic_bitset.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+static const size_t TSBK_LEN = 10;
+
+static boost::dynamic_bitset<> load_bitset(const unsigned char *bytes, size_t len, int pad) {
+  boost::dynamic_bitset<> b(len * 8 + pad);
+  for (size_t i = 0; i < len; i++) {
+    unsigned char c = bytes[i];
+    b <<= 8;
+    for (int j = 0; j < 8; j++) {
+      b[j] = c & 0x1;
+      c >>= 1;
+    }
+  }
+  b <<= pad;
+  return b;
+}
+
+static unsigned long bitset_field(const boost::dynamic_bitset<> &b, int shift, unsigned long long mask) {
+  boost::dynamic_bitset<> bitmask(b.size(), mask);
+  return ((b >> shift) & bitmask).to_ulong();
+}
+
+// The fields decode_tsbk reads for a group voice channel grant
+template <typename Load, typename Field>
+static unsigned long decode_grants(const std::vector<unsigned char> &tsbks, Load load, Field field) {
+  unsigned long sum = 0;
+  for (size_t i = 0; i + TSBK_LEN <= tsbks.size(); i += TSBK_LEN) {
+    auto tsbk = load(&tsbks[i]);
+    sum += field(tsbk, 88, 0x3f);     // opcode
+    sum += field(tsbk, 80, 0xff);     // mfrid
+    sum += field(tsbk, 72, 0x1);      // emergency
+    sum += field(tsbk, 70, 0x1);      // encrypted
+    sum += field(tsbk, 64, 0x7);      // priority
+    sum += field(tsbk, 48, 0xffff);   // channel
+    sum += field(tsbk, 32, 0xffff);   // talkgroup
+    sum += field(tsbk, 16, 0xffffff); // source
+  }
+  return sum;
+}
+
+int main(int argc, char **argv) {
+  size_t count = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+
+  std::vector<unsigned char> tsbks(count * TSBK_LEN);
+  uint32_t state = 1;
+  for (size_t i = 0; i < tsbks.size(); i++) {
+    state = state * 1103515245u + 12345u;
+    tsbks[i] = (state >> 16) & 0xff;
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  unsigned long bitset_sum = decode_grants(
+      tsbks,
+      [](const unsigned char *bytes) { return load_bitset(bytes, TSBK_LEN, 16); },
+      [](const boost::dynamic_bitset<> &b, int shift, unsigned long long mask) { return bitset_field(b, shift, mask); });
+  std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+  unsigned long bitfield_sum = decode_grants(
+      tsbks,
+      [](const unsigned char *bytes) { P25_Tsbk tsbk; tsbk.load(bytes, TSBK_LEN, 16); return tsbk; },
+      [](const P25_Tsbk &tsbk, int shift, uint64_t mask) { return tsbk.field(shift, mask); });
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  double bitset_ns = std::chrono::duration<double, std::nano>(middle - start).count() / count;
+  double bitfield_ns = std::chrono::duration<double, std::nano>(end - middle).count() / count;
+  std::cout << count << " TSBKs" << std::endl;
+  std::cout << "dynamic_bitset: " << bitset_ns << " ns/TSBK" << std::endl;
+  std::cout << "P25_Bitfield:   " << bitfield_ns << " ns/TSBK (" << bitset_ns / bitfield_ns << "x)" << std::endl;
+
+  if (bitset_sum != bitfield_sum) {
+    std::cerr << "Decoded fields differ" << std::endl;
+    return 1;
+  }
+  return 0;
+}
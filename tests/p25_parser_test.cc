@@ -0,0 +1,210 @@
+// Checks the fixed width TSBK/MBT decoding against the dynamic_bitset decoder
+// it replaced.
+//
+// data/p25_parser_golden.txt holds TSBKs and MBTs with random payloads for
+// every opcode, each followed by the messages the dynamic_bitset decoder made
+// from it. They are decoded in order with one parser, so the identifier
+// updates among them fill the frequency tables the grants are decoded with.
+
+#include "../trunk-recorder/systems/p25_parser.h"
+
+#include <boost/dynamic_bitset.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                         \
+  do {                                                                      \
+    if (!(cond)) {                                                          \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": " << #cond << std::endl; \
+      failures++;                                                           \
+    }                                                                       \
+  } while (0)
+
+// How the parser used to load a TSBK or MBT: a bitset len + pad / 8 bytes long,
+// shifted left a byte at a time, then by pad bits for the missing CRC
+static boost::dynamic_bitset<> load_bitset(const unsigned char *bytes, size_t len, int pad) {
+  boost::dynamic_bitset<> b(len * 8 + pad);
+  for (size_t i = 0; i < len; i++) {
+    unsigned char c = bytes[i];
+    b <<= 8;
+    for (int j = 0; j < 8; j++) {
+      b[j] = c & 0x1;
+      c >>= 1;
+    }
+  }
+  b <<= pad;
+  return b;
+}
+
+// The old bitset_shift_mask()
+static unsigned long bitset_field(const boost::dynamic_bitset<> &b, int shift, unsigned long long mask) {
+  boost::dynamic_bitset<> bitmask(b.size(), mask);
+  return ((b >> shift) & bitmask).to_ulong();
+}
+
+// The old bitset_shift_left_mask()
+static unsigned long bitset_field_left(const boost::dynamic_bitset<> &b, int shift, unsigned long long mask) {
+  boost::dynamic_bitset<> bitmask(b.size(), mask);
+  return ((b << shift) & bitmask).to_ulong();
+}
+
+static uint32_t rand_state = 1;
+
+static unsigned char rand_byte() {
+  rand_state = rand_state * 1103515245u + 12345u;
+  return (rand_state >> 16) & 0xff;
+}
+
+template <int Bits>
+static void check_bitfield(size_t len, int pad) {
+  const unsigned long long masks[] = {0x1, 0x3f, 0xff, 0xfff, 0xffff, 0xffffff};
+  unsigned char bytes[64];
+
+  for (int n = 0; n < 64; n++) {
+    for (size_t i = 0; i < len; i++) {
+      bytes[i] = rand_byte();
+    }
+    P25_Bitfield<Bits> field;
+    field.load(bytes, len, pad);
+    boost::dynamic_bitset<> b = load_bitset(bytes, len, pad);
+
+    for (int shift = 0; shift < std::min((int)b.size(), Bits); shift++) {
+      for (size_t m = 0; m < sizeof(masks) / sizeof(masks[0]); m++) {
+        if (field.field(shift, masks[m]) != bitset_field(b, shift, masks[m])) {
+          std::cerr << "field(" << shift << ", " << std::hex << masks[m] << std::dec << ") of " << len << " bytes differs" << std::endl;
+          failures++;
+        }
+      }
+    }
+    for (int shift = 0; shift < 24; shift++) {
+      CHECK(field.field_left(shift, 0xffffff) == bitset_field_left(b, shift, 0xffffff));
+    }
+  }
+}
+
+// The bitfields hold the same bits the bitsets did, for the lengths the
+// control channel sends
+static void test_bitfield_matches_dynamic_bitset() {
+  check_bitfield<96>(10, 16);  // TSBK and MBT header
+  check_bitfield<256>(10, 32); // MBT data, 1 block
+  check_bitfield<256>(22, 32); // 2 blocks
+}
+
+static std::string format_message(const TrunkMessage &m) {
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(1);
+  os << "type=" << m.message_type << " opcode=" << m.opcode << " freq=" << m.freq << " tg=" << m.talkgroup
+     << " src=" << m.source << " enc=" << m.encrypted << " emerg=" << m.emergency << " duplex=" << m.duplex
+     << " mode=" << m.mode << " prio=" << m.priority << " slot=" << m.tdma_slot << " phase2=" << m.phase2_tdma
+     << " sys_num=" << m.sys_num << " sys_id=" << m.sys_id << " nac=" << m.nac << " wacn=" << m.wacn
+     << " patch=" << m.patch_data.sg << "," << m.patch_data.ga1 << "," << m.patch_data.ga2 << "," << m.patch_data.ga3;
+  // Only RFSS status sets these
+  if (m.message_type == SYSID && m.opcode == 0x3a) {
+    os << " rfss=" << m.sys_rfss << " site=" << m.sys_site_id;
+  }
+  os << " meta=" << m.meta;
+  return os.str();
+}
+
+static std::vector<unsigned char> from_hex(const std::string &hex) {
+  std::vector<unsigned char> bytes;
+  for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+    bytes.push_back(std::stoul(hex.substr(i, 2), NULL, 16));
+  }
+  return bytes;
+}
+
+// Loads the frame the way P25Parser::parse_data does
+static void decode(P25Parser &parser, const std::string &kind, unsigned long nac, const std::vector<unsigned char> &body, std::vector<TrunkMessage> &messages) {
+  if (kind == "tsbk") {
+    P25_Tsbk tsbk;
+    tsbk.load(body.data(), body.size(), 16);
+    parser.decode_tsbk(tsbk, nac, 0, messages);
+  } else {
+    size_t header_len = std::min(body.size(), (size_t)10);
+    P25_Mbt_Header header;
+    P25_Mbt_Data mbt_data;
+    header.load(body.data(), header_len, 16);
+    mbt_data.load(body.data() + header_len, body.size() - header_len, 32);
+    parser.decode_mbt_data(header.field(32, 0x3f), header, mbt_data, header.field(48, 0xffffff), nac, 0, messages);
+  }
+}
+
+static void check_frame(P25Parser &parser, const std::string &frame, const std::vector<std::string> &expected) {
+  std::istringstream is(frame);
+  std::string kind, nac_hex, body_hex;
+  is >> kind >> nac_hex >> body_hex;
+
+  std::vector<TrunkMessage> messages;
+  decode(parser, kind, std::stoul(nac_hex, NULL, 16), from_hex(body_hex), messages);
+
+  bool same = messages.size() == expected.size();
+  for (size_t i = 0; same && i < messages.size(); i++) {
+    same = format_message(messages[i]) == expected[i];
+  }
+  if (!same) {
+    std::cerr << frame << std::endl;
+    for (size_t i = 0; i < expected.size(); i++) {
+      std::cerr << "  expected: " << expected[i] << std::endl;
+    }
+    for (size_t i = 0; i < messages.size(); i++) {
+      std::cerr << "  got:      " << format_message(messages[i]) << std::endl;
+    }
+    failures++;
+  }
+}
+
+static void test_decode_matches_golden() {
+  std::ifstream golden("data/p25_parser_golden.txt");
+  CHECK(golden.good());
+
+  P25Parser parser;
+  parser.set_build_meta(true);
+
+  std::string line, frame;
+  std::vector<std::string> expected;
+  int frames = 0;
+  while (std::getline(golden, line)) {
+    if (line.compare(0, 2, "= ") == 0) {
+      expected.push_back(line.substr(2));
+      continue;
+    }
+    if (!frame.empty()) {
+      check_frame(parser, frame, expected);
+      frames++;
+    }
+    frame = line;
+    expected.clear();
+  }
+  if (!frame.empty()) {
+    check_frame(parser, frame, expected);
+    frames++;
+  }
+  CHECK(frames > 0);
+}
+
+int main() {
+  // The decoder logs every message it makes
+  boost::log::core::get()->set_filter(boost::log::trivial::severity >= boost::log::trivial::error);
+
+  test_bitfield_matches_dynamic_bitset();
+  test_decode_matches_golden();
+
+  if (failures) {
+    std::cerr << failures << " checks failed" << std::endl;
+    return 1;
+  }
+  return 0;
+}
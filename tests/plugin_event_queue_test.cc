@@ -0,0 +1,196 @@
+// Checks the ordering, overflow policies and sequence fence of the per plugin
+// event queue. release_retired_calls relies on the fence to know when a call
+// can no longer be reached from a queued handler.
+
+#include "../trunk-recorder/plugin_manager/plugin_event_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                         \
+  do {                                                                      \
+    if (!(cond)) {                                                          \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": " << #cond << std::endl; \
+      failures++;                                                           \
+    }                                                                       \
+  } while (0)
+
+// What the handlers ran, in the order they ran
+struct Handled {
+  std::mutex mutex;
+  std::vector<int> values;
+
+  Plugin_Event_Queue::handler_t add(int value) {
+    return [this, value](Plugin_Api *) {
+      std::lock_guard<std::mutex> lock(mutex);
+      values.push_back(value);
+    };
+  }
+};
+
+static boost::shared_ptr<Plugin_Api> make_api() {
+  return boost::shared_ptr<Plugin_Api>(new Plugin_Api());
+}
+
+static void test_order_kept() {
+  Handled handled;
+  Plugin_Event_Queue queue("order", make_api(), 10000, OVERFLOW_DROP_OLDEST);
+  queue.start();
+  for (int i = 0; i < 5000; i++) {
+    queue.push(handled.add(i));
+  }
+  queue.stop();
+
+  CHECK(handled.values.size() == 5000);
+  for (size_t i = 0; i < handled.values.size(); i++) {
+    if (handled.values[i] != (int)i) {
+      std::cerr << "event " << i << " ran as " << handled.values[i] << std::endl;
+      failures++;
+      break;
+    }
+  }
+}
+
+// With no worker running nothing is taken off, so the oldest go
+static void test_drop_oldest_within_capacity() {
+  Handled handled;
+  Plugin_Event_Queue queue("drop", make_api(), 8, OVERFLOW_DROP_OLDEST);
+  for (int i = 0; i < 20; i++) {
+    queue.push(handled.add(i));
+  }
+  Plugin_Queue_Stats stats = queue.get_stats(false);
+  CHECK(stats.depth == 8);
+  CHECK(stats.high_water == 8);
+  CHECK(stats.dropped == 12);
+
+  queue.start();
+  queue.stop();
+  CHECK(handled.values.size() == 8);
+  for (size_t i = 0; i < handled.values.size(); i++) {
+    CHECK(handled.values[i] == (int)(12 + i));
+  }
+}
+
+// A full queue holds the pusher until the worker makes room, and loses nothing
+static void test_block_within_capacity() {
+  Handled handled;
+  std::promise<void> started;
+  std::promise<void> release;
+  std::shared_future<void> gate(release.get_future());
+  Plugin_Event_Queue queue("block", make_api(), 4, OVERFLOW_BLOCK);
+  queue.start();
+
+  queue.push([&started, gate](Plugin_Api *) {
+    started.set_value();
+    gate.wait();
+  });
+  started.get_future().wait();
+  for (int i = 0; i < 4; i++) {
+    queue.push(handled.add(i));
+  }
+
+  std::atomic<bool> pushed(false);
+  std::thread pusher([&] {
+    queue.push(handled.add(4));
+    pushed = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  CHECK(!pushed);
+  CHECK(queue.get_stats(false).depth == 4);
+
+  release.set_value();
+  pusher.join();
+  queue.stop();
+
+  Plugin_Queue_Stats stats = queue.get_stats(false);
+  CHECK(pushed);
+  CHECK(stats.dropped == 0);
+  CHECK(stats.high_water <= 4);
+  CHECK(handled.values.size() == 5);
+  for (size_t i = 0; i < handled.values.size(); i++) {
+    CHECK(handled.values[i] == (int)i);
+  }
+}
+
+// Only a snapshot kind replaces a queued event, and only one with the same key
+static void test_coalesce_snapshots_per_key() {
+  Handled handled;
+  int key_a = 0;
+  int key_b = 0;
+  Plugin_Event_Queue queue("coalesce", make_api(), 16, OVERFLOW_COALESCE);
+  queue.push(handled.add(1), EVENT_ORDERED, &key_a);
+  queue.push(handled.add(2), EVENT_CALLS_ACTIVE, &key_a);
+  queue.push(handled.add(3), EVENT_ORDERED, &key_a);
+  queue.push(handled.add(4), EVENT_CALLS_ACTIVE, &key_b);
+  queue.push(handled.add(5), EVENT_SETUP_RECORDER, &key_a);
+  queue.push(handled.add(6), EVENT_CALLS_ACTIVE, &key_a); // replaces 2
+  queue.push(handled.add(7), EVENT_ORDERED, &key_a);
+  queue.push(handled.add(8), EVENT_ORDERED, &key_a);
+
+  Plugin_Queue_Stats stats = queue.get_stats(false);
+  CHECK(stats.coalesced == 1);
+  CHECK(stats.depth == 7);
+
+  queue.start();
+  queue.stop();
+  const int expected[] = {1, 3, 4, 5, 6, 7, 8};
+  CHECK(handled.values.size() == sizeof(expected) / sizeof(expected[0]));
+  for (size_t i = 0; (i < handled.values.size()) && (i < sizeof(expected) / sizeof(expected[0])); i++) {
+    CHECK(handled.values[i] == expected[i]);
+  }
+}
+
+// An event being handled is still pending, so nothing it uses can be freed yet
+static void test_oldest_pending_fences_in_flight() {
+  std::promise<void> started;
+  std::promise<void> release;
+  std::shared_future<void> gate(release.get_future());
+  Plugin_Event_Queue queue("fence", make_api(), 8, OVERFLOW_DROP_OLDEST);
+  CHECK(queue.oldest_pending() == queue.get_pushed() + 1);
+  queue.start();
+
+  queue.push([&started, gate](Plugin_Api *) {
+    started.set_value();
+    gate.wait();
+  });
+  started.get_future().wait();
+  uint64_t fence = queue.get_pushed();
+
+  // Nothing is queued behind it, so only the in flight handler holds the fence
+  CHECK(queue.get_stats(false).depth == 0);
+  CHECK(queue.oldest_pending() <= fence);
+  CHECK(!queue.wait_handled(fence, 20));
+
+  Handled handled;
+  queue.push(handled.add(1));
+  CHECK(queue.oldest_pending() <= fence);
+
+  release.set_value();
+  CHECK(queue.wait_handled(fence, 2000));
+  CHECK(queue.oldest_pending() > fence);
+  CHECK(queue.wait_handled(queue.get_pushed(), 2000));
+  CHECK(queue.oldest_pending() == queue.get_pushed() + 1);
+  queue.stop();
+  CHECK(handled.values.size() == 1);
+}
+
+int main() {
+  test_order_kept();
+  test_drop_oldest_within_capacity();
+  test_block_within_capacity();
+  test_coalesce_snapshots_per_key();
+  test_oldest_pending_fences_in_flight();
+
+  if (failures) {
+    std::cerr << failures << " checks failed" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,208 @@
+// Checks how Source hands out recorders from its free lists when a grant's
+// talkgroup priority needs more recorders than are free, with and without
+// preemption.
+
+#include "../trunk-recorder/call_impl.h"
+#include "../trunk-recorder/source.h"
+#include "../trunk-recorder/talkgroup.h"
+
+#include <fstream>
+#include <iostream>
+#include <stdio.h>
+#include <unistd.h>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                         \
+  do {                                                                      \
+    if (!(cond)) {                                                          \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": " << #cond << std::endl; \
+      failures++;                                                           \
+    }                                                                       \
+  } while (0)
+
+// Puts itself back on the Source's free list when stopped, the way the real
+// recorders do
+class Fake_Recorder : public Recorder {
+public:
+  Fake_Recorder(Source *source)
+      : Recorder(P25),
+        source(source) {}
+
+  Source *get_source() { return source; }
+  void stop() { source->release_recorder(this); }
+
+private:
+  Source *source;
+};
+
+// Skips everything conclude_call does besides stopping the recorder. Like the
+// real one, it leaves the call's state and recorder as they were.
+class Fake_Call : public Call_impl {
+public:
+  Fake_Call(long talkgroup, Config config)
+      : Call_impl(talkgroup, 851000000, NULL, config) {}
+
+  std::string get_short_name() { return "test"; }
+
+  void conclude_call() {
+    if (get_recorder()) {
+      get_recorder()->stop();
+    }
+  }
+};
+
+// A Source whose free list is filled with fake recorders
+class Test_Source : public Source {
+public:
+  Test_Source(std::string iq_file, Config *config)
+      : Source(iq_file, false, 851000000, 2400000, config) {}
+
+  using Source::add_available_digital_recorder;
+};
+
+struct Fixture {
+  Config config;
+  std::string iq_file;
+  Test_Source *source;
+  std::vector<Fake_Recorder *> recorders;
+  std::vector<Talkgroup *> talkgroups;
+  std::vector<Fake_Call *> calls;
+
+  Fixture(bool preemption, int num_recorders) {
+    config.recorder_preemption = preemption;
+
+    // The IQ file source is never run, it only has to open
+    char name[] = "/tmp/recorder_pool_testXXXXXX";
+    int fd = mkstemp(name);
+    close(fd);
+    iq_file = name;
+    std::ofstream iq(iq_file.c_str(), std::ios::binary);
+    std::vector<char> zeros(8 * 1024, 0);
+    iq.write(zeros.data(), zeros.size());
+    iq.close();
+
+    source = new Test_Source(iq_file, &config);
+    for (int i = 0; i < num_recorders; i++) {
+      recorders.push_back(new Fake_Recorder(source));
+      source->add_available_digital_recorder(recorders.back());
+    }
+  }
+
+  ~Fixture() {
+    for (size_t i = 0; i < calls.size(); i++) {
+      delete calls[i];
+    }
+    for (size_t i = 0; i < talkgroups.size(); i++) {
+      delete talkgroups[i];
+    }
+    for (size_t i = 0; i < recorders.size(); i++) {
+      delete recorders[i];
+    }
+    delete source;
+    unlink(iq_file.c_str());
+  }
+
+  // Grants a call on a talkgroup with the given priority, the way
+  // start_recorder does, and returns the recorder it got
+  Recorder *grant(int priority, Fake_Call **call_out = NULL) {
+    long num = 100 + calls.size();
+    talkgroups.push_back(new Talkgroup(0, num, "D", "", "", "", "", priority, 0));
+    calls.push_back(new Fake_Call(num, config));
+    Fake_Call *call = calls.back();
+
+    Recorder *recorder = source->get_digital_recorder(talkgroups.back(), priority, call);
+    if (recorder) {
+      call->set_recorder(recorder);
+      call->set_state(RECORDING);
+    }
+    if (call_out) {
+      *call_out = call;
+    }
+    return recorder;
+  }
+};
+
+// A priority 2 grant preempts a priority 3 call and records on its recorder,
+// even though only that one recorder is free afterwards
+static void test_preempted_recorder_goes_to_grant() {
+  Fixture f(true, 3);
+  Fake_Call *low;
+  Recorder *low_recorder = f.grant(3, &low);
+  CHECK(low_recorder != NULL);
+  CHECK(f.grant(2) != NULL);
+  CHECK(f.grant(1) != NULL);
+  CHECK(f.source->get_num_available_digital_recorders() == 0);
+
+  Fake_Call *high;
+  Recorder *recorder = f.grant(2, &high);
+  CHECK(recorder == low_recorder);
+  CHECK(high->get_recorder() == low_recorder);
+  CHECK(low->get_recorder() == NULL);
+  CHECK(low->get_state() == MONITORING);
+  CHECK(low->get_monitoring_state() == PREEMPTED);
+
+  std::map<int, Recorder_Pool_Stats> stats = f.source->get_recorder_pool_stats();
+  CHECK(stats[2].exhausted == 1);
+  CHECK(stats[2].dropped == 0);
+  CHECK(stats[3].preempted == 1);
+}
+
+// Too few free recorders for the grant's priority is enough to preempt; the
+// pool does not have to be empty
+static void test_preempts_when_too_few_are_free() {
+  Fixture f(true, 3);
+  Fake_Call *low;
+  CHECK(f.grant(3, &low) != NULL);
+  CHECK(f.grant(1) != NULL);
+  CHECK(f.source->get_num_available_digital_recorders() == 1);
+
+  Recorder *recorder = f.grant(2);
+  CHECK(recorder != NULL);
+  CHECK(low->get_monitoring_state() == PREEMPTED);
+  CHECK(f.source->get_num_available_digital_recorders() == 1);
+}
+
+// Nothing of a lower priority is recording, so the grant is dropped
+static void test_drops_without_lower_priority_call() {
+  Fixture f(true, 2);
+  Fake_Call *first;
+  Fake_Call *second;
+  CHECK(f.grant(2, &first) != NULL);
+  CHECK(f.grant(1, &second) != NULL);
+
+  CHECK(f.grant(2) == NULL);
+  CHECK(first->get_state() == RECORDING);
+  CHECK(second->get_state() == RECORDING);
+
+  std::map<int, Recorder_Pool_Stats> stats = f.source->get_recorder_pool_stats();
+  CHECK(stats[2].dropped == 1);
+  CHECK(stats[2].preempted == 0);
+}
+
+// Without preemption a grant that needs more free recorders than there are is
+// dropped
+static void test_drops_without_preemption() {
+  Fixture f(false, 3);
+  Fake_Call *low;
+  CHECK(f.grant(3, &low) != NULL);
+  CHECK(f.grant(2) != NULL);
+  CHECK(f.grant(1) != NULL);
+
+  CHECK(f.grant(2) == NULL);
+  CHECK(low->get_state() == RECORDING);
+}
+
+int main() {
+  test_preempted_recorder_goes_to_grant();
+  test_preempts_when_too_few_are_free();
+  test_drops_without_lower_priority_call();
+  test_drops_without_preemption();
+
+  if (failures) {
+    std::cerr << failures << " checks failed" << std::endl;
+    return 1;
+  }
+  return 0;
+}
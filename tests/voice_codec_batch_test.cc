@@ -0,0 +1,181 @@
+// Checks when a recorder's voice codec frames are handed to the plugins: when
+// the batch is full, when the frames switch call, on flush_call and once the
+// first frame has waited VOICE_CODEC_BATCH_MS. Also checks that the recorder
+// can add frames while a batch is being delivered.
+
+#include "../trunk-recorder/plugin_manager/voice_codec_batch.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                         \
+  do {                                                                      \
+    if (!(cond)) {                                                          \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": " << #cond << std::endl; \
+      failures++;                                                           \
+    }                                                                       \
+  } while (0)
+
+struct Delivery {
+  Call *call;
+  std::vector<uint32_t> first_params; // params[0] of each frame
+};
+
+static std::vector<Delivery> deliveries;
+
+static void record_delivery(Call *call, const Voice_Codec_Frame *frames, int frame_count) {
+  Delivery delivery;
+  delivery.call = call;
+  for (int i = 0; i < frame_count; i++) {
+    delivery.first_params.push_back(frames[i].params[0]);
+  }
+  deliveries.push_back(delivery);
+}
+
+// The batch only compares the calls, so any distinct addresses will do
+static char call_storage[2];
+static Call *const call_a = reinterpret_cast<Call *>(&call_storage[0]);
+static Call *const call_b = reinterpret_cast<Call *>(&call_storage[1]);
+
+static std::int64_t now_ms() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+static void add_frame(Voice_Codec_Batch &batch, Call *call, uint32_t value) {
+  uint32_t params[8] = {value, 1, 2, 3, 4, 5, 6, 7};
+  batch.add(call, CODEC_P25_IMBE, 101, 2001, params, 8, 0, 0, 0, false);
+}
+
+static void test_deliver_when_full() {
+  deliveries.clear();
+  Voice_Codec_Batch batch(record_delivery);
+  for (int i = 0; i < VOICE_CODEC_BATCH_FRAMES - 1; i++) {
+    add_frame(batch, call_a, i);
+  }
+  CHECK(deliveries.empty());
+  add_frame(batch, call_a, VOICE_CODEC_BATCH_FRAMES - 1);
+  CHECK(deliveries.size() == 1);
+  if (deliveries.size() == 1) {
+    CHECK(deliveries[0].call == call_a);
+    CHECK(deliveries[0].first_params.size() == (size_t)VOICE_CODEC_BATCH_FRAMES);
+    for (size_t i = 0; i < deliveries[0].first_params.size(); i++) {
+      CHECK(deliveries[0].first_params[i] == i);
+    }
+  }
+  batch.flush();
+  CHECK(deliveries.size() == 1);
+}
+
+static void test_deliver_on_call_switch() {
+  deliveries.clear();
+  Voice_Codec_Batch batch(record_delivery);
+  add_frame(batch, call_a, 1);
+  add_frame(batch, call_a, 2);
+  add_frame(batch, call_a, 3);
+  CHECK(deliveries.empty());
+  add_frame(batch, call_b, 4);
+  CHECK(deliveries.size() == 1);
+  if (deliveries.size() == 1) {
+    CHECK(deliveries[0].call == call_a);
+    CHECK(deliveries[0].first_params == std::vector<uint32_t>({1, 2, 3}));
+  }
+  batch.flush();
+  CHECK(deliveries.size() == 2);
+  if (deliveries.size() == 2) {
+    CHECK(deliveries[1].call == call_b);
+    CHECK(deliveries[1].first_params == std::vector<uint32_t>({4}));
+  }
+}
+
+static void test_deliver_on_flush_call() {
+  deliveries.clear();
+  Voice_Codec_Batch batch(record_delivery);
+  add_frame(batch, call_a, 1);
+  add_frame(batch, call_a, 2);
+  batch.flush_call(call_b);
+  CHECK(deliveries.empty());
+  batch.flush_call(call_a);
+  CHECK(deliveries.size() == 1);
+  if (deliveries.size() == 1) {
+    CHECK(deliveries[0].call == call_a);
+    CHECK(deliveries[0].first_params == std::vector<uint32_t>({1, 2}));
+  }
+  batch.flush_call(call_a);
+  CHECK(deliveries.size() == 1);
+}
+
+static void test_deliver_when_stale() {
+  deliveries.clear();
+  Voice_Codec_Batch batch(record_delivery);
+  std::int64_t before = now_ms();
+  add_frame(batch, call_a, 1);
+  add_frame(batch, call_a, 2);
+  std::int64_t after = now_ms();
+  batch.flush_stale(before);
+  batch.flush_stale(before + VOICE_CODEC_BATCH_MS - 1);
+  CHECK(deliveries.empty());
+  batch.flush_stale(after + VOICE_CODEC_BATCH_MS);
+  CHECK(deliveries.size() == 1);
+  if (deliveries.size() == 1) {
+    CHECK(deliveries[0].first_params == std::vector<uint32_t>({1, 2}));
+  }
+}
+
+// A flush from the main loop must not hold the recorder's add() for as long
+// as the plugins take
+static std::atomic<bool> delivering(false);
+static std::atomic<bool> added(false);
+static bool added_during_delivery = false;
+
+static void slow_delivery(Call *call, const Voice_Codec_Frame *frames, int frame_count) {
+  if (!delivering) {
+    delivering = true;
+    std::chrono::steady_clock::time_point give_up = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!added && (std::chrono::steady_clock::now() < give_up)) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    added_during_delivery = added;
+  }
+  record_delivery(call, frames, frame_count);
+}
+
+static void test_add_during_delivery() {
+  deliveries.clear();
+  Voice_Codec_Batch batch(slow_delivery);
+  add_frame(batch, call_a, 1);
+
+  std::thread main_loop([&] { batch.flush_call(call_a); });
+  while (!delivering) {
+    std::this_thread::yield();
+  }
+  add_frame(batch, call_a, 2);
+  added = true;
+  main_loop.join();
+  CHECK(added_during_delivery);
+
+  batch.flush();
+  CHECK(deliveries.size() == 2);
+  if (deliveries.size() == 2) {
+    CHECK(deliveries[0].first_params == std::vector<uint32_t>({1}));
+    CHECK(deliveries[1].first_params == std::vector<uint32_t>({2}));
+  }
+}
+
+int main() {
+  test_deliver_when_full();
+  test_deliver_on_call_switch();
+  test_deliver_on_flush_call();
+  test_deliver_when_stale();
+  test_add_during_delivery();
+
+  if (failures) {
+    std::cerr << failures << " checks failed" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -21,7 +21,7 @@ class System;
 class Call {
 public:
   // static Call * make(long t, double f, System *s, Config c);
-  static Call *make(TrunkMessage message, System *s, Config c);
+  static Call *make(const TrunkMessage &message, System *s, Config c);
   virtual ~Call(){};
   virtual long get_call_num() = 0;
   virtual void restart_call() = 0;
@@ -41,7 +41,7 @@ public:
   virtual void set_freq(double f) = 0;
   virtual long get_talkgroup() = 0;
 
-  virtual bool update(TrunkMessage message) = 0;
+  virtual bool update(const TrunkMessage &message) = 0;
   virtual int get_idle_count() = 0;
   virtual void increase_idle_count() = 0;
   virtual void reset_idle_count() = 0;
@@ -68,6 +68,7 @@ public:
   virtual const char *get_xor_mask() = 0;
   virtual time_t get_start_time() = 0;
   virtual std::int64_t get_start_time_ms() = 0;
+  virtual std::int64_t get_stop_time_ms() = 0;
   virtual bool is_conventional() = 0;
   virtual void set_encrypted(bool m) = 0;
   virtual bool get_encrypted() = 0;
@@ -1,5 +1,7 @@
 #include "call_concluder.h"
 #include "../plugin_manager/plugin_manager.h"
+#include "../gr_blocks/codec_file.h"
+#include "../metrics.h"
 
 #include <boost/filesystem.hpp>
 #include <filesystem>
@@ -10,6 +12,7 @@
 #include <cstring>
 #include <fstream>
 #include <iomanip>
+#include <memory>
 #include <random>
 #include <sstream>
 #include <string>
@@ -887,6 +890,9 @@ void remove_call_files(const Call_Data_t &call_info, bool plugin_failure) {
       if (checkIfFile(t.filename)) std::remove(t.filename.c_str());
   }
 
+  for (const auto &t : call_info.transmission_list)
+    if (!t.codec_filename.empty() && checkIfFile(t.codec_filename)) std::remove(t.codec_filename.c_str());
+
   const bool keep_json = call_info.call_log || (plugin_failure && call_info.archive_files_on_failure);
   if (!keep_json && checkIfFile(call_info.status_filename))
     std::remove(call_info.status_filename.c_str());
@@ -897,7 +903,26 @@ void remove_call_files(const Call_Data_t &call_info, bool plugin_failure) {
 // ---------------------------------------------------------------------------
 
 Call_Data_t upload_call_worker(Call_Data_t call_info) {
+  static Metric_Histogram *render_seconds = metrics.histogram("trunk_recorder_call_render_seconds", "Time to synthesize and encode the audio of a concluded call.",
+                                                              {0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 30, 60});
+
   if (call_info.status == INITIAL) {
+    const auto render_start = std::chrono::steady_clock::now();
+
+    // With a deferred vocoder the transmissions were recorded as silence
+    // and the audio is synthesized here, off the DSP threads. One vocoder
+    // takes the whole call, so its state carries over from one transmission
+    // to the next as it would have if they had been decoded live.
+    std::unique_ptr<gr::op25_repeater::codec_synth> synth;
+    for (auto &t : call_info.transmission_list) {
+      if (t.codec_filename.empty()) continue;
+      if (!synth) synth.reset(new gr::op25_repeater::codec_synth(call_info.soft_vocoder, call_info.fast_vocoder));
+      if (!gr::blocks::synthesize_codec_file(t.codec_filename, t.filename, *synth))
+        BOOST_LOG_TRIVIAL(error) << "\033[0;31mFailed to synthesize " << t.codec_filename << "\033[0m";
+      std::remove(t.codec_filename.c_str());
+      t.codec_filename.clear();
+    }
+
     std::vector<std::string> input_files;
     input_files.reserve(call_info.transmission_list.size());
 
@@ -944,6 +969,7 @@ Call_Data_t upload_call_worker(Call_Data_t call_info) {
       call_info.status = FAILED;
       return call_info;
     }
+    render_seconds->observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - render_start).count());
 
     if (!trim_whitespace(call_info.upload_script).empty()) {
       if (run_upload_script_argv(call_info) != 0) {
@@ -1061,6 +1087,8 @@ Call_Data_t Call_Concluder::create_call_data(Call *call, System *sys, const Conf
   call_info.call_log             = sys->get_call_log();
   call_info.call_num             = call->get_call_num();
   call_info.compress_wav         = sys->get_compress_wav();
+  call_info.soft_vocoder         = config.soft_vocoder;
+  call_info.fast_vocoder         = config.fast_vocoder;
   call_info.audio_bitrate        = sys->get_audio_bitrate();
 
   call_info.audio_postprocess.enabled             = sys->get_audio_postprocess_enabled();
@@ -1120,6 +1148,7 @@ Call_Data_t Call_Concluder::create_call_data(Call *call, System *sys, const Conf
                                  << min_tx_s << "s (actual: " << seg_len_s << "s).";
         if (checkIfFile(t.filename)) std::remove(t.filename.c_str());
       }
+      if (!t.codec_filename.empty() && checkIfFile(t.codec_filename)) std::remove(t.codec_filename.c_str());
       it = call_info.transmission_list.erase(it);
       continue;
     }
@@ -2,6 +2,7 @@
 #include "call.h"
 #include "call_concluder/call_concluder.h"
 #include "formatter.h"
+#include "metrics.h"
 #include "recorder_globals.h"
 #include "recorders/recorder.h"
 #include "source.h"
@@ -24,7 +25,7 @@ Call * Call::make(long t, double f, System *s, Config c) {
   return (Call *) new Call_impl(t, f, s, c);
 }*/
 
-Call *Call::make(TrunkMessage message, System *s, Config c) {
+Call *Call::make(const TrunkMessage &message, System *s, Config c) {
   return (Call *)new Call_impl(message, s, c);
 }
 
@@ -66,7 +67,7 @@ Call_impl::Call_impl(long t, double f, System *s, Config c) {
   this->update_talkgroup_display();
 }
 
-Call_impl::Call_impl(TrunkMessage message, System *s, Config c) {
+Call_impl::Call_impl(const TrunkMessage &message, System *s, Config c) {
   config = c;
   call_num = call_counter++;
   noise = DB_UNSET;
@@ -317,7 +318,21 @@ State Call_impl::get_state() {
   return state;
 }
 
+// The counters of calls that were not recorded, indexed by the MonitoringState saying why
+static std::vector<Metric_Counter *> make_not_recorded_counters() {
+  static const char *reasons[] = {"", "unknown_tg", "ignored_tg", "no_source", "no_recorder", "encrypted", "duplicate", "superseded", "preempted"};
+  std::vector<Metric_Counter *> counters(PREEMPTED + 1, NULL);
+  for (int s = UNKNOWN_TG; s <= PREEMPTED; s++) {
+    counters[s] = metrics.counter("trunk_recorder_calls_not_recorded", "Calls that were not recorded, or stopped being recorded, by reason.", Metrics::label("reason", reasons[s]));
+  }
+  return counters;
+}
+
 void Call_impl::set_monitoring_state(MonitoringState s) {
+  static std::vector<Metric_Counter *> not_recorded = make_not_recorded_counters();
+  if ((s != monitoringState) && (s > UNSPECIFIED) && (s <= PREEMPTED)) {
+    not_recorded[s]->inc();
+  }
   monitoringState = s;
 }
 
@@ -422,7 +437,7 @@ bool Call_impl::add_source(long src) {
   return true;
 }
 
-bool Call_impl::update(TrunkMessage message) {
+bool Call_impl::update(const TrunkMessage &message) {
   last_update = time(NULL);
   if ((message.freq != this->curr_freq) || (message.talkgroup != this->talkgroup)) {
     std::string loghdr = log_header( sys->get_short_name(), this->get_call_num(), this->get_talkgroup_display(), this->get_freq());
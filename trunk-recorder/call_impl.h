@@ -22,7 +22,7 @@ class System;
 class Call_impl : public Call {
 public:
   Call_impl(long t, double f, System *s, Config c);
-  Call_impl(TrunkMessage message, System *s, Config c);
+  Call_impl(const TrunkMessage &message, System *s, Config c);
 
   long get_call_num();
   virtual void restart_call();
@@ -42,7 +42,7 @@ public:
   void set_freq(double f);
   long get_talkgroup();
 
-  bool update(TrunkMessage message);
+  bool update(const TrunkMessage &message);
   int get_idle_count();
   void increase_idle_count();
   void reset_idle_count();
@@ -69,6 +69,7 @@ public:
   const char *get_xor_mask();
   virtual time_t get_start_time() { return start_time; }
   virtual std::int64_t get_start_time_ms();
+  virtual std::int64_t get_stop_time_ms() { return stop_time_ms; }
   bool is_conventional() { return false; }
   void set_encrypted(bool m);
   bool get_encrypted();
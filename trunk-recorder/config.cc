@@ -195,8 +195,15 @@ bool load_config(string config_file, Config &config, gr::top_block_sptr &tb, std
     BOOST_LOG_TRIVIAL(info) << "Upload Server: " << config.upload_server;
     config.bcfy_calls_server = data.value("broadcastifyCallsServer", "");
     BOOST_LOG_TRIVIAL(info) << "Broadcastify Calls Server: " << config.bcfy_calls_server;
+    config.upload_connections_per_host = data.value("uploadConnectionsPerHost", 4);
+    BOOST_LOG_TRIVIAL(info) << "Upload Connections per Host: " << config.upload_connections_per_host;
     config.status_server = data.value("statusServer", "");
     BOOST_LOG_TRIVIAL(info) << "Status Server: " << config.status_server;
+    config.metrics_port = data.value("metricsPort", 0);
+    config.metrics_address = data.value("metricsAddress", "127.0.0.1");
+    if (config.metrics_port > 0) {
+      BOOST_LOG_TRIVIAL(info) << "Metrics Endpoint: " << config.metrics_address << ":" << config.metrics_port;
+    }
     config.instance_key = data.value("instanceKey", "");
     BOOST_LOG_TRIVIAL(info) << "Instance Key: " << config.instance_key;
     config.instance_id = data.value("instanceId", "");
@@ -213,12 +220,24 @@ bool load_config(string config_file, Config &config, gr::top_block_sptr &tb, std
     BOOST_LOG_TRIVIAL(info) << "Control channel retune limit: " << config.control_retune_limit;
     config.soft_vocoder = data.value("softVocoder", false);
     BOOST_LOG_TRIVIAL(info) << "Phase 1 Software Vocoder: " << config.soft_vocoder;
+    config.fast_vocoder = data.value("fastVocoder", false);
+    BOOST_LOG_TRIVIAL(info) << "Fast Software Vocoder Synthesis: " << config.fast_vocoder;
+    config.fused_demod = data.value("fusedDemod", false);
+    BOOST_LOG_TRIVIAL(info) << "Fused P25 Demodulator: " << config.fused_demod;
+    config.deferred_vocoder = data.value("deferredVocoder", false);
+    BOOST_LOG_TRIVIAL(info) << "Deferred Vocoder: " << config.deferred_vocoder;
     config.enable_audio_streaming = data.value("audioStreaming", false);
     BOOST_LOG_TRIVIAL(info) << "Enable Audio Streaming: " << config.enable_audio_streaming;
     config.record_uu_v_calls = data.value("recordUUVCalls", true);
     BOOST_LOG_TRIVIAL(info) << "Record Unit to Unit Voice Calls: " << config.record_uu_v_calls;
     config.new_call_from_update = data.value("newCallFromUpdate", true);
     BOOST_LOG_TRIVIAL(info) << "New Call from UPDATE Messages: " << config.new_call_from_update;
+    config.recorder_preemption = data.value("recorderPreemption", false);
+    BOOST_LOG_TRIVIAL(info) << "Recorder Preemption: " << config.recorder_preemption;
+    config.speculative_recorders = data.value("speculativeRecorders", 0);
+    BOOST_LOG_TRIVIAL(info) << "Speculative Recorders per Source: " << config.speculative_recorders;
+    config.speculative_spare_recorders = data.value("speculativeSpareRecorders", 1);
+    BOOST_LOG_TRIVIAL(info) << "Speculative Spare Recorders: " << config.speculative_spare_recorders;
     std::string frequency_format_string = data.value("frequencyFormat", "mhz");
 
     if (boost::iequals(frequency_format_string, "mhz")) {
@@ -235,9 +254,9 @@ bool load_config(string config_file, Config &config, gr::top_block_sptr &tb, std
 
     statusAsString = data.value("statusAsString", statusAsString);
     BOOST_LOG_TRIVIAL(info) << "Status as String: " << statusAsString;
-    std::string log_level = data.value("logLevel", "info");
-    BOOST_LOG_TRIVIAL(info) << "Log Level: " << log_level;
-    set_logging_level(log_level);
+    config.log_level = data.value("logLevel", "info");
+    BOOST_LOG_TRIVIAL(info) << "Log Level: " << config.log_level;
+    set_logging_level(config.log_level);
     BOOST_LOG_TRIVIAL(info) << "Color Console/Logfile Output: " << config.log_color;
 
     config.debug_recorder = data.value("debugRecorder", 0);
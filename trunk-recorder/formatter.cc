@@ -43,6 +43,7 @@ std::string format_state(State state, MonitoringState monitoringState) {
           case ENCRYPTED:    ss << ": " << Color::RED << "ENCRYPTED" << Color::RST; break;
           case DUPLICATE:    ss << ": " << Color::CYN << "DUPLICATE" << Color::RST; break;
           case SUPERSEDED:   ss << ": " << Color::CYN << "SUPERSEDED" << Color::RST; break;
+          case PREEMPTED:    ss << ": " << Color::YEL << "PREEMPTED" << Color::RST; break;
           default: break;  // UNSPECIFIED
         }
         break;
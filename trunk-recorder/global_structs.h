@@ -8,6 +8,8 @@
 
 const int DB_UNSET = 999;
 
+class Upload_Engine;
+
 struct Transmission {
   long source;
   long talkgroup;
@@ -23,6 +25,7 @@ struct Transmission {
   double freq;
   double length;
   std::string filename;
+  std::string codec_filename; // deferred vocoder frames for filename, if any
 };
 
 struct Config {
@@ -39,6 +42,9 @@ struct Config {
   std::string log_dir;
   std::string default_mode;
   bool new_call_from_update;
+  bool recorder_preemption;
+  int speculative_recorders;
+  int speculative_spare_recorders;
   bool debug_recorder;
   int debug_recorder_port;
   double call_timeout;
@@ -46,15 +52,23 @@ struct Config {
   bool log_file;
   bool syslog_friendly;
   std::string log_color;
+  std::string log_level;
   int control_message_warn_rate;
   int control_retune_limit;
   bool broadcast_signals;
   bool enable_audio_streaming;
   bool soft_vocoder;
+  bool fast_vocoder;
+  bool fused_demod;
+  bool deferred_vocoder;
   bool record_uu_v_calls;
   bool archive_files_on_failure;
   int frequency_format;
   std::string filename_format;
+  int upload_connections_per_host;
+  Upload_Engine *upload_engine; // shared by the uploader plugins, set up with the plugins
+  std::string metrics_address;
+  int metrics_port; // 0 leaves the metrics endpoint off
 };
 
 struct Audio_Postprocess_Config {
@@ -149,6 +163,8 @@ struct Call_Data_t {
   bool archive_files_on_failure;
   bool call_log;
   bool compress_wav;
+  bool soft_vocoder;
+  bool fast_vocoder;
   std::string audio_bitrate = "32k";
   std::string raw_filename;
   std::string filename;
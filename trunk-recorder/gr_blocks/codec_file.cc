@@ -0,0 +1,75 @@
+#include "codec_file.h"
+#include "wavfile_gr3.8.h"
+
+#include <algorithm>
+#include <boost/log/trivial.hpp>
+#include <stdio.h>
+
+namespace gr {
+namespace blocks {
+
+std::string codec_filename(const std::string &wav_filename) {
+  std::string filename = wav_filename;
+  size_t ext = filename.rfind(".wav");
+  if (ext != std::string::npos && ext == filename.size() - 4) {
+    filename.erase(ext);
+  }
+  return filename + ".codec";
+}
+
+bool synthesize_codec_file(const std::string &codec_filename, const std::string &wav_filename, gr::op25_repeater::codec_synth &synth) {
+  unsigned int sample_rate;
+  int nchans;
+  int bytes_per_sample;
+  int first_sample_pos;
+  unsigned int samples_per_chan;
+
+  FILE *codec_fp = fopen(codec_filename.c_str(), "rb");
+  if (!codec_fp) {
+    BOOST_LOG_TRIVIAL(error) << "Unable to open codec file: " << codec_filename;
+    return false;
+  }
+
+  FILE *wav_fp = fopen(wav_filename.c_str(), "rb+");
+  if (!wav_fp) {
+    BOOST_LOG_TRIVIAL(error) << "Unable to open wav file: " << wav_filename;
+    fclose(codec_fp);
+    return false;
+  }
+
+  if (!wavheader_parse(wav_fp, sample_rate, nchans, bytes_per_sample, first_sample_pos, samples_per_chan) || (nchans != 1) || (bytes_per_sample != 2)) {
+    BOOST_LOG_TRIVIAL(error) << "Codec frames can only be written to 16 bit mono wav files: " << wav_filename;
+    fclose(wav_fp);
+    fclose(codec_fp);
+    return false;
+  }
+
+  codec_file_record record;
+  int16_t audio[gr::op25_repeater::CODEC_FRAME_SAMPLES];
+  bool ok = true;
+
+  while (fread(&record, sizeof(record), 1, codec_fp) == 1) {
+    if (!synth.decode(record.frame, audio)) {
+      continue;
+    }
+    if (record.sample >= samples_per_chan) {
+      continue;
+    }
+    size_t count = std::min<size_t>(gr::op25_repeater::CODEC_FRAME_SAMPLES, samples_per_chan - record.sample);
+    if (fseek(wav_fp, first_sample_pos + (long)record.sample * bytes_per_sample, SEEK_SET) != 0) {
+      BOOST_LOG_TRIVIAL(error) << "Failed seeking in wav file: " << wav_filename;
+      ok = false;
+      break;
+    }
+    for (size_t i = 0; i < count; i++) {
+      wav_write_sample(wav_fp, audio[i], bytes_per_sample);
+    }
+  }
+
+  fclose(wav_fp);
+  fclose(codec_fp);
+  return ok;
+}
+
+} /* namespace blocks */
+} /* namespace gr */
@@ -0,0 +1,29 @@
+#ifndef INCLUDED_CODEC_FILE_H
+#define INCLUDED_CODEC_FILE_H
+
+#include <op25_repeater/include/op25_repeater/codec_frame.h>
+#include <stdint.h>
+#include <string>
+
+namespace gr {
+namespace blocks {
+
+// One record in a .codec sidecar: a vocoder frame and the sample in the
+// transmission's wav file where its audio starts.
+struct codec_file_record {
+  uint32_t sample;
+  gr::op25_repeater::codec_frame frame;
+};
+
+// The sidecar that goes with a transmission wav, e.g. 1234-1718145678.042_851012500.codec
+std::string codec_filename(const std::string &wav_filename);
+
+// Runs the frames in codec_filename through synth and writes the audio over
+// the silence the recorder left in wav_filename. Give it the same synth for
+// each transmission of a call, in order, so the vocoder state carries over.
+bool synthesize_codec_file(const std::string &codec_filename, const std::string &wav_filename, gr::op25_repeater::codec_synth &synth);
+
+} /* namespace blocks */
+} /* namespace gr */
+
+#endif
@@ -27,6 +27,7 @@
 
 #include "tps_decoder_sink.h"
 #include "tps_decoder_sink_impl.h"
+#include <algorithm>
 #include <boost/math/special_functions/round.hpp>
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -138,61 +139,18 @@ void tps_decoder_sink_impl::process_message(gr::message::sptr msg) {
   }
 
   if (type == 7) { // # trunk: TSBK
-    boost::dynamic_bitset<> b((s.length() + 2) * 8);
-
-    for (unsigned int i = 0; i < s.length(); ++i) {
-      unsigned char c = (unsigned char)s[i];
-      b <<= 8;
-
-      for (int j = 0; j < 8; j++) {
-        if (c & 0x1) {
-          b[j] = 1;
-        } else {
-          b[j] = 0;
-        }
-        c >>= 1;
-      }
-    }
-    b <<= 16; // for missing crc
+    P25_Tsbk tsbk;
+    tsbk.load((const unsigned char *)s.data(), s.length(), 16); // 16 bits for missing crc
 
-    decode_tsbk(b, nac);
+    decode_tsbk(tsbk, nac);
   } else if (type == 12) { // # trunk: MBT
-    std::string s1 = s.substr(0, 10);
-    std::string s2 = s.substr(10);
-    boost::dynamic_bitset<> header((s1.length() + 2) * 8);
-
-    for (unsigned int i = 0; i < s1.length(); ++i) {
-      unsigned char c = (unsigned char)s1[i];
-      header <<= 8;
-
-      for (int j = 0; j < 8; j++) {
-        if (c & 0x1) {
-          header[j] = 1;
-        } else {
-          header[j] = 0;
-        }
-        c >>= 1;
-      }
-    }
-    header <<= 16; // for missing crc
-
-    boost::dynamic_bitset<> mbt_data((s2.length() + 4) * 8);
-    for (unsigned int i = 0; i < s2.length(); ++i) {
-      unsigned char c = (unsigned char)s2[i];
-      mbt_data <<= 8;
-
-      for (int j = 0; j < 8; j++) {
-        if (c & 0x1) {
-          mbt_data[j] = 1;
-        } else {
-          mbt_data[j] = 0;
-        }
-        c >>= 1;
-      }
-    }
-    mbt_data <<= 32; // for missing crc
-    unsigned long opcode = bitset_shift_mask(header, 32, 0x3f);
-    unsigned long link_id = bitset_shift_mask(header, 48, 0xffffff);
+    size_t header_len = std::min(s.length(), (size_t)10);
+    P25_Mbt_Header header;
+    P25_Mbt_Data mbt_data;
+    header.load((const unsigned char *)s.data(), header_len, 16); // 16 bits for missing crc
+    mbt_data.load((const unsigned char *)s.data() + header_len, s.length() - header_len, 32); // 32 bits for missing crc
+    unsigned long opcode = header.field(32, 0x3f);
+    unsigned long link_id = header.field(48, 0xffffff);
     decode_mbt_data(opcode, header, mbt_data, link_id, nac);
   } else {
     // Not supported yet...
@@ -238,28 +196,18 @@ void tps_decoder_sink_impl::initialize_p25() {
   connect(slicer, 0, op25_frame_assembler, 0);
 }
 
-unsigned long tps_decoder_sink_impl::bitset_shift_mask(boost::dynamic_bitset<> &tsbk, int shift, unsigned long long mask) {
-  boost::dynamic_bitset<> bitmask(tsbk.size(), mask);
-  unsigned long result = ((tsbk >> shift) & bitmask).to_ulong();
-
-  // std::cout << "    " << std::dec<< shift << " " << tsbk.size() << " [ " <<
-  // mask << " ]  = " << result << " - " << ((tsbk >> shift) & bitmask) <<
-  // std::endl;
-  return result;
-}
-
-void tps_decoder_sink_impl::decode_mbt_data(unsigned long opcode, boost::dynamic_bitset<> &header, boost::dynamic_bitset<> &mbt_data, unsigned long sa, unsigned long nac) {
+void tps_decoder_sink_impl::decode_mbt_data(unsigned long opcode, const P25_Mbt_Header &header, const P25_Mbt_Data &mbt_data, unsigned long sa, unsigned long nac) {
   long unit_id = 0;
   bool emergency = false;
 
   BOOST_LOG_TRIVIAL(trace) << "decode_mbt_data: $" << opcode;
   if (opcode == 0x0) { // grp voice channel grant
-                       // unsigned long mfrid = bitset_shift_mask(header, 72, 0xff);
-    unit_id = bitset_shift_mask(header, 48, 0xffffff);
-    emergency = (bool)bitset_shift_mask(header, 24, 0x80);
+                       // unsigned long mfrid = header.field(72, 0xff);
+    unit_id = header.field(48, 0xffffff);
+    emergency = (bool)header.field(24, 0x80);
   } else if (opcode == 0x04) { //  Unit to Unit Voice Service Channel Grant -Extended (UU_V_CH_GRANT)
-    emergency = (bool)bitset_shift_mask(header, 24, 0x80);
-    unit_id = bitset_shift_mask(header, 48, 0xffffff);
+    emergency = (bool)header.field(24, 0x80);
+    unit_id = header.field(48, 0xffffff);
   }
 
   if (unit_id > 0 || emergency) {
@@ -267,38 +215,38 @@ void tps_decoder_sink_impl::decode_mbt_data(unsigned long opcode, boost::dynamic
   }
 }
 
-void tps_decoder_sink_impl::decode_tsbk(boost::dynamic_bitset<> &tsbk, unsigned long nac) {
+void tps_decoder_sink_impl::decode_tsbk(const P25_Tsbk &tsbk, unsigned long nac) {
   long unit_id = 0;
   bool emergency = false;
 
-  unsigned long opcode = bitset_shift_mask(tsbk, 88, 0x3f); // x3f
+  unsigned long opcode = tsbk.field(88, 0x3f); // x3f
 
   BOOST_LOG_TRIVIAL(trace) << "TSBK: opcode: $" << std::hex << opcode;
   if (opcode == 0x00) { // group voice chan grant
-    emergency = (bool)bitset_shift_mask(tsbk, 72, 0x80);
-    unit_id = bitset_shift_mask(tsbk, 16, 0xffffff);
+    emergency = (bool)tsbk.field(72, 0x80);
+    unit_id = tsbk.field(16, 0xffffff);
   } else if (opcode == 0x02) { // group voice chan grant update
-    unsigned long mfrid = bitset_shift_mask(tsbk, 80, 0xff);
-    emergency = (bool)bitset_shift_mask(tsbk, 72, 0x80);
+    unsigned long mfrid = tsbk.field(80, 0xff);
+    emergency = (bool)tsbk.field(72, 0x80);
 
     if (mfrid == 0x90) {
-      unit_id = bitset_shift_mask(tsbk, 16, 0xffffff);
+      unit_id = tsbk.field(16, 0xffffff);
     }
   } else if (opcode == 0x04) { //  Unit to Unit Voice Service Channel Grant (UU_V_CH_GRANT)
-    emergency = (bool)bitset_shift_mask(tsbk, 72, 0x80);
-    unit_id = bitset_shift_mask(tsbk, 16, 0xffffff);
+    emergency = (bool)tsbk.field(72, 0x80);
+    unit_id = tsbk.field(16, 0xffffff);
   } else if (opcode == 0x06) { //  Unit to Unit Voice Channel Grant Update (UU_V_CH_GRANT_UPDT)
-    emergency = (bool)bitset_shift_mask(tsbk, 72, 0x80);
-    unit_id = bitset_shift_mask(tsbk, 16, 0xffffff);
+    emergency = (bool)tsbk.field(72, 0x80);
+    unit_id = tsbk.field(16, 0xffffff);
   } else if (opcode == 0x20) { // Acknowledge response
-    unit_id = bitset_shift_mask(tsbk, 16, 0xffffff);
+    unit_id = tsbk.field(16, 0xffffff);
   } else if (opcode == 0x28) { // Unit Group Affiliation Response
-    unit_id = bitset_shift_mask(tsbk, 16, 0xffffff);
+    unit_id = tsbk.field(16, 0xffffff);
   } else if (opcode == 0x2c) { // Unit Registration Response
-    // unsigned long sa = bitset_shift_mask(tsbk, 16, 0xffffff);
-    unit_id = bitset_shift_mask(tsbk, 40, 0xffffff);
+    // unsigned long sa = tsbk.field(16, 0xffffff);
+    unit_id = tsbk.field(40, 0xffffff);
   } else if (opcode == 0x2f) { // Unit DeRegistration Ack
-    unit_id = bitset_shift_mask(tsbk, 16, 0xffffff);
+    unit_id = tsbk.field(16, 0xffffff);
   }
 
   if (unit_id > 0 || emergency) {
@@ -24,7 +24,7 @@
 #define INCLUDED_GR_TPS_DECODER_SINK_IMPL_H
 
 #include "tps_decoder_sink.h"
-#include <boost/dynamic_bitset.hpp>
+#include "../../systems/p25_bitfield.h"
 #include <boost/log/trivial.hpp>
 
 #include <op25_repeater/fsk4_demod_ff.h>
@@ -50,10 +50,8 @@ private:
   void initialize_p25(void);
   void process_message(gr::message::sptr msg);
   void parse_p25_json(std::string json);
-  void decode_mbt_data(unsigned long opcode, boost::dynamic_bitset<> &header, boost::dynamic_bitset<> &mbt_data, unsigned long link_id, unsigned long nac);
-  void decode_tsbk(boost::dynamic_bitset<> &tsbk, unsigned long nac);
-
-  unsigned long bitset_shift_mask(boost::dynamic_bitset<> &tsbk, int shift, unsigned long long mask);
+  void decode_mbt_data(unsigned long opcode, const P25_Mbt_Header &header, const P25_Mbt_Data &mbt_data, unsigned long link_id, unsigned long nac);
+  void decode_tsbk(const P25_Tsbk &tsbk, unsigned long nac);
 
   std::string to_hex(const std::string &s, bool upper = false, bool spaced = true);
 
@@ -23,6 +23,8 @@
 
 #include "transmission_sink.h"
 #include "../../trunk-recorder/call.h"
+#include "../../trunk-recorder/metrics.h"
+#include <algorithm>
 #include <boost/filesystem.hpp>
 #include <boost/math/special_functions/round.hpp>
 #include <climits>
@@ -53,6 +55,8 @@
 #define OUR_O_LARGEFILE 0
 #endif // ifdef O_LARGEFILE
 
+static const unsigned WRITE_TIMING_INTERVAL = 16; // one batch in this many is timed for the write_seconds histogram
+
 namespace gr {
 namespace blocks {
 transmission_sink::sptr
@@ -67,6 +71,7 @@ transmission_sink::transmission_sink(int n_channels, unsigned int sample_rate, i
       d_sample_rate(sample_rate),
       d_nchans(n_channels),
       d_current_call(NULL),
+      d_codec_fp(NULL),
       d_fp(0) {
 
   if ((bits_per_sample != 8) && (bits_per_sample != 16)) {
@@ -76,7 +81,15 @@ transmission_sink::transmission_sink(int n_channels, unsigned int sample_rate, i
   d_sample_count = 0;
   d_slot = -1;
   d_termination_flag = false;
+  d_parked = false;
   state = AVAILABLE;
+  d_write_seconds = metrics.histogram("trunk_recorder_transmission_write_seconds", "Time each recorder's transmission sink spends writing a batch of samples, from one batch in 16.",
+                                      {0.00001, 0.000025, 0.00005, 0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.05});
+  d_write_batches = 0;
+
+  // A batch holds at most a buffer's worth of frames, so these do not grow on the DSP thread
+  d_pending_codec_frames.reserve(64);
+  d_codec_records.reserve(64);
 }
 
 void transmission_sink::create_filename() {
@@ -139,6 +152,7 @@ bool transmission_sink::start_recording(Call *call) {
     BOOST_LOG_TRIVIAL(trace) << "Start() - Current_Call & fp are not null! current_filename is: " << current_filename << " Length: " << d_sample_count << std::endl;
   }
   d_current_call = call;
+  d_parked = false;
   d_current_call_num = call->get_call_num();
   d_current_call_freq = call->get_freq();
   d_conventional = call->is_conventional();
@@ -303,6 +317,11 @@ void transmission_sink::end_transmission() {
     transmission.length = length_in_seconds(); // length in seconds
     d_prior_transmission_length = d_prior_transmission_length + transmission.length;
     transmission.filename = current_filename;
+    if (d_codec_fp) {
+      fclose(d_codec_fp);
+      d_codec_fp = NULL;
+      transmission.codec_filename = d_codec_filename;
+    }
     transmission.talkgroup = d_current_call_talkgroup;
 
     BOOST_LOG_TRIVIAL(debug) << "Adding transmission: " << transmission.filename << " Slot: " << transmission.slot << " Talkgroup: " << transmission.talkgroup << " Length: " << transmission.length << " Samples: " << d_sample_count;
@@ -345,6 +364,20 @@ void transmission_sink::close_wav(bool close_call) {
   d_fp = NULL;
 }
 
+void transmission_sink::write_codec_records() {
+  if (!d_codec_fp) {
+    d_codec_filename = codec_filename(current_filename);
+    if ((d_codec_fp = fopen(d_codec_filename.c_str(), "wb")) == NULL) {
+      BOOST_LOG_TRIVIAL(error) << "codec error opening: " << d_codec_filename;
+      return;
+    }
+  }
+  for (codec_file_record &record : d_codec_records) {
+    record.sample += d_sample_count / d_nchans;
+  }
+  fwrite(d_codec_records.data(), sizeof(codec_file_record), d_codec_records.size(), d_codec_fp);
+}
+
 transmission_sink::~transmission_sink() {
   stop_recording();
 }
@@ -353,6 +386,11 @@ bool transmission_sink::stop() {
   return true;
 }
 
+void transmission_sink::set_parked(bool parked) {
+  gr::thread::scoped_lock guard(d_mutex);
+  d_parked = parked;
+}
+
 State transmission_sink::get_state() {
   return this->state;
 }
@@ -364,6 +402,11 @@ int transmission_sink::work(int noutput_items, gr_vector_const_void_star &input_
   
   // it is possible that we could get part of a transmission after a call has stopped. We shouldn't do any recording if this happens.... this could mean that we miss part of the recording though
   if (!d_current_call) {
+    // A parked recorder is only demodulating to stay locked to the channel
+    if (d_parked) {
+      return noutput_items;
+    }
+
     time_t now = time(NULL);
     double its_been = difftime(now, d_stop_time);
 
@@ -396,11 +439,21 @@ int transmission_sink::work(int noutput_items, gr_vector_const_void_star &input_
   pmt::pmt_t terminate_key(pmt::intern("terminate"));
   pmt::pmt_t spike_count_key(pmt::intern("spike_count"));
   pmt::pmt_t error_count_key(pmt::intern("error_count"));
+  pmt::pmt_t codec_frames_key(pmt::intern("codec_frames")); // Vocoder frames from a deferred vocoder
+
+  // The terminator is on the last sample of the transmission that ended. Stop
+  // this batch there; the samples after it are left for the next transmission.
+  get_tags_in_window(tags, 0, 0, noutput_items, terminate_key);
+  for (unsigned int i = 0; i < tags.size(); i++) {
+    noutput_items = std::min(noutput_items, (int)(tags[i].offset - nitems_read(0)) + 1);
+  }
+  tags.clear();
 
   // pmt::pmt_t squelch_key(pmt::intern("squelch_eob"));
   // get_tags_in_range(tags, 0, nitems_read(0), nitems_read(0) + noutput_items);
   get_tags_in_window(tags, 0, 0, noutput_items);
   unsigned pos = 0;
+  d_codec_records.clear();
   // long curr_src_id = 0;
 
   for (unsigned int i = 0; i < tags.size(); i++) {
@@ -486,6 +539,17 @@ int transmission_sink::work(int noutput_items, gr_vector_const_void_star &input_
       // BOOST_LOG_TRIVIAL(info) << "TERMINATOR!!";
     }
 
+    if (pmt::eq(codec_frames_key, tags[i].key)) {
+      const gr::op25_repeater::tagged_codec_frame *tagged = (const gr::op25_repeater::tagged_codec_frame *)pmt::blob_data(tags[i].value);
+      size_t count = pmt::blob_length(tags[i].value) / sizeof(gr::op25_repeater::tagged_codec_frame);
+      for (size_t j = 0; j < count; j++) {
+        pending_codec_frame pending;
+        pending.offset = tags[i].offset + tagged[j].offset;
+        pending.frame = tagged[j].frame;
+        d_pending_codec_frames.push_back(pending);
+      }
+    }
+
     // Only process Spike and Error Count tags if the sink is currently recording
     if (state == RECORDING) {
       if (pmt::eq(spike_count_key, tags[i].key)) {
@@ -502,6 +566,23 @@ int transmission_sink::work(int noutput_items, gr_vector_const_void_star &input_
   }
   tags.clear();
 
+  // The frames that start in this batch, with the sample offset relative to it
+  // until dowork() knows where it lands in the file. A batch cut at a terminator
+  // leaves the rest of a tag's frames for the next one.
+  size_t codec_frames = 0;
+  for (; codec_frames < d_pending_codec_frames.size(); codec_frames++) {
+    const pending_codec_frame &pending = d_pending_codec_frames[codec_frames];
+    if (pending.offset >= nitems_read(0) + noutput_items)
+      break;
+    if (pending.offset >= nitems_read(0)) {
+      codec_file_record record;
+      record.sample = pending.offset - nitems_read(0);
+      record.frame = pending.frame;
+      d_codec_records.push_back(record);
+    }
+  }
+  d_pending_codec_frames.erase(d_pending_codec_frames.begin(), d_pending_codec_frames.begin() + codec_frames);
+
   // if the System for this call is in Transmission Mode, and we have a recording and we got a flag that a Transmission ended...
   int nwritten = dowork(noutput_items, input_items, output_items);
 
@@ -592,6 +673,11 @@ int transmission_sink::dowork(int noutput_items, gr_vector_const_void_star &inpu
 
       close_wav(false);
     }
+    if (d_codec_fp) {
+      fclose(d_codec_fp);
+      d_codec_fp = NULL;
+      std::remove(d_codec_filename.c_str());
+    }
 
     auto now_sys = std::chrono::system_clock::now();
     d_start_time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -618,6 +704,16 @@ int transmission_sink::dowork(int noutput_items, gr_vector_const_void_star &inpu
   }
 
   if (state == RECORDING) {
+    // Only some batches are timed, so the clock is read once per batch as before
+    bool timed = ((d_write_batches++ % WRITE_TIMING_INTERVAL) == 0);
+    std::chrono::steady_clock::time_point write_start;
+    if (timed) {
+      write_start = std::chrono::steady_clock::now();
+    }
+
+    if (!d_codec_records.empty()) {
+      write_codec_records();
+    }
     for (nwritten = 0; nwritten < noutput_items; nwritten++) {
       for (int chan = 0; chan < d_nchans; chan++) {
         // Write zeros to channels which are in the WAV file
@@ -635,13 +731,18 @@ int transmission_sink::dowork(int noutput_items, gr_vector_const_void_star &inpu
       }
     }
 
+    d_last_write_time = std::chrono::steady_clock::now();
+    if (timed) {
+      d_write_seconds->observe(std::chrono::duration<double>(d_last_write_time - write_start).count());
+    }
+
     if (terminate_after_write) {
       end_transmission();
     }
+  } else {
+    d_last_write_time = std::chrono::steady_clock::now();
   }
 
-  d_last_write_time = std::chrono::steady_clock::now();
-
   if (nwritten < noutput_items) {
     BOOST_LOG_TRIVIAL(error) << loghdr << "Failed to Write! Wrote: " << nwritten << " of " << noutput_items;
   } else {
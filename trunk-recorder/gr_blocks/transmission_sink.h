@@ -23,6 +23,7 @@
 #ifndef INCLUDED_TRANSMISSION_SINK_H
 #define INCLUDED_TRANSMISSION_SINK_H
 
+#include "codec_file.h"
 #include "wavfile_gr3.8.h"
 #include <sys/time.h>
 
@@ -35,6 +36,7 @@
 #include <chrono>
 
 class Call;
+class Metric_Histogram;
 struct Transmission;
 namespace gr {
 namespace blocks {
@@ -51,11 +53,14 @@ private:
   bool d_conventional;
   bool d_first_work;
   bool d_termination_flag;
+  bool d_parked;
   time_t d_start_time;
   time_t d_stop_time;
   std::int64_t d_start_time_ms;
   std::int64_t d_stop_time_ms;
   std::chrono::time_point<std::chrono::steady_clock> d_last_write_time;
+  Metric_Histogram *d_write_seconds;
+  unsigned d_write_batches;
   long d_spike_count;
   long d_error_count;
   long curr_src_id;
@@ -71,6 +76,14 @@ private:
   long d_current_call_talkgroup;
   long d_current_call_talkgroup_encoded;
   std::string d_current_call_talkgroup_display;
+  struct pending_codec_frame {
+    uint64_t offset; // input sample the frame starts at
+    gr::op25_repeater::codec_frame frame;
+  };
+  std::vector<pending_codec_frame> d_pending_codec_frames; // tagged frames that start past the current batch
+  std::vector<codec_file_record> d_codec_records;          // codec frames in the current batch
+  std::string d_codec_filename;
+  FILE *d_codec_fp;
 
 protected:
   unsigned d_sample_count;
@@ -94,6 +107,12 @@ protected:
    */
   void close_wav(bool close_call);
 
+  /*!
+   * \brief Appends the codec frames tagged in this batch to the sidecar of
+   * the wav file being recorded, opening it on the first frame.
+   */
+  void write_codec_records();
+
 protected:
   bool stop();
   bool open_internal(const char *filename);
@@ -127,6 +146,7 @@ public:
   bool start_recording(Call *call);
   bool start_recording(Call *call, int slot);
   void stop_recording();
+  void set_parked(bool parked); // Silently discard audio while a recorder is parked without a call
   void end_transmission();
   void set_source(long src);
   void set_sample_rate(unsigned int sample_rate);
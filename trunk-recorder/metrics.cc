@@ -0,0 +1,356 @@
+#include "metrics.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <boost/log/trivial.hpp>
+
+// Only Linux has MSG_NOSIGNAL, the BSDs and macOS set SO_NOSIGPIPE on the socket instead
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+Metrics metrics;
+
+// How long a scraper gets to send its request and read the reply
+static const int METRICS_CLIENT_TIMEOUT_S = 2;
+static const size_t METRICS_MAX_REQUEST = 8192;
+
+static std::atomic<unsigned> next_metric_slot(0);
+
+static inline unsigned thread_slot() {
+  thread_local unsigned slot = next_metric_slot.fetch_add(1, std::memory_order_relaxed) % METRIC_SLOTS;
+  return slot;
+}
+
+// So scripts started by plugins do not inherit the descriptor. SOCK_CLOEXEC,
+// pipe2() and accept4() would do it in one go, but only Linux has them.
+static void set_cloexec(int fd) {
+  fcntl(fd, F_SETFD, FD_CLOEXEC);
+}
+
+static std::string format_value(double value) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.15g", value);
+  return buf;
+}
+
+Metric_Counter::Metric_Counter() : d_slots(METRIC_SLOTS) {}
+
+void Metric_Counter::inc(uint64_t n) {
+  d_slots[thread_slot()].v[0].fetch_add(n, std::memory_order_relaxed);
+}
+
+uint64_t Metric_Counter::value() const {
+  uint64_t total = 0;
+  for (int i = 0; i < METRIC_SLOTS; i++) {
+    total += d_slots[i].v[0].load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+Metric_Histogram::Metric_Histogram(const std::vector<double> &bounds)
+    : d_bounds(bounds),
+      d_lines_per_slot((bounds.size() + 2 + 7) / 8),
+      d_lines(METRIC_SLOTS * d_lines_per_slot) {}
+
+void Metric_Histogram::observe(double seconds) {
+  size_t bucket = 0;
+  while ((bucket < d_bounds.size()) && (seconds > d_bounds[bucket])) {
+    bucket++;
+  }
+  unsigned slot = thread_slot();
+  cell(slot, bucket).fetch_add(1, std::memory_order_relaxed);
+  if (seconds > 0) {
+    cell(slot, d_bounds.size() + 1).fetch_add((uint64_t)(seconds * 1e9), std::memory_order_relaxed);
+  }
+}
+
+std::vector<uint64_t> Metric_Histogram::bucket_counts() const {
+  std::vector<uint64_t> counts(d_bounds.size() + 1, 0);
+  for (int slot = 0; slot < METRIC_SLOTS; slot++) {
+    for (size_t i = 0; i < counts.size(); i++) {
+      counts[i] += cell(slot, i).load(std::memory_order_relaxed);
+    }
+  }
+  return counts;
+}
+
+double Metric_Histogram::sum() const {
+  uint64_t nanoseconds = 0;
+  for (int slot = 0; slot < METRIC_SLOTS; slot++) {
+    nanoseconds += cell(slot, d_bounds.size() + 1).load(std::memory_order_relaxed);
+  }
+  return nanoseconds / 1e9;
+}
+
+Metrics::Metrics() : d_listen_fd(-1) {
+  d_wake_pipe[0] = -1;
+  d_wake_pipe[1] = -1;
+}
+
+Metrics::~Metrics() {
+  stop();
+}
+
+Metrics::Family &Metrics::family(const std::string &name, const std::string &type, const std::string &help) {
+  Family &family = d_families[name];
+  if (family.type.empty()) {
+    family.type = type;
+    family.help = help;
+  }
+  return family;
+}
+
+Metric_Counter *Metrics::counter(const std::string &name, const std::string &help, const std::string &labels) {
+  std::lock_guard<std::mutex> lock(d_mutex);
+  std::unique_ptr<Metric_Counter> &metric = family(name, "counter", help).counters[labels];
+  if (!metric) {
+    metric.reset(new Metric_Counter());
+  }
+  return metric.get();
+}
+
+Metric_Gauge *Metrics::gauge(const std::string &name, const std::string &help, const std::string &labels) {
+  std::lock_guard<std::mutex> lock(d_mutex);
+  std::unique_ptr<Metric_Gauge> &metric = family(name, "gauge", help).gauges[labels];
+  if (!metric) {
+    metric.reset(new Metric_Gauge());
+  }
+  return metric.get();
+}
+
+Metric_Histogram *Metrics::histogram(const std::string &name, const std::string &help, const std::vector<double> &bounds, const std::string &labels) {
+  std::lock_guard<std::mutex> lock(d_mutex);
+  std::unique_ptr<Metric_Histogram> &metric = family(name, "histogram", help).histograms[labels];
+  if (!metric) {
+    metric.reset(new Metric_Histogram(bounds));
+  }
+  return metric.get();
+}
+
+std::string Metrics::label(const std::string &name, const std::string &value) {
+  std::string out = name + "=\"";
+  for (std::string::const_iterator it = value.begin(); it != value.end(); ++it) {
+    if (*it == '\\') {
+      out += "\\\\";
+    } else if (*it == '"') {
+      out += "\\\"";
+    } else if (*it == '\n') {
+      out += "\\n";
+    } else {
+      out += *it;
+    }
+  }
+  return out + "\"";
+}
+
+static std::string with_labels(const std::string &name, const std::string &labels, const std::string &extra = "") {
+  if (labels.empty() && extra.empty()) {
+    return name;
+  }
+  if (labels.empty() || extra.empty()) {
+    return name + "{" + labels + extra + "}";
+  }
+  return name + "{" + labels + "," + extra + "}";
+}
+
+std::string Metrics::format(bool openmetrics) {
+  std::string out;
+  std::lock_guard<std::mutex> lock(d_mutex);
+
+  for (std::map<std::string, Family>::iterator it = d_families.begin(); it != d_families.end(); ++it) {
+    const std::string &name = it->first;
+    Family &family = it->second;
+    // The OpenMetrics family name leaves off the _total its samples have
+    std::string family_name = ((family.type == "counter") && !openmetrics) ? name + "_total" : name;
+    out += "# HELP " + family_name + " " + family.help + "\n";
+    out += "# TYPE " + family_name + " " + family.type + "\n";
+
+    for (std::map<std::string, std::unique_ptr<Metric_Counter>>::iterator metric = family.counters.begin(); metric != family.counters.end(); ++metric) {
+      out += with_labels(name + "_total", metric->first) + " " + std::to_string(metric->second->value()) + "\n";
+    }
+    for (std::map<std::string, std::unique_ptr<Metric_Gauge>>::iterator metric = family.gauges.begin(); metric != family.gauges.end(); ++metric) {
+      out += with_labels(name, metric->first) + " " + format_value(metric->second->value()) + "\n";
+    }
+    for (std::map<std::string, std::unique_ptr<Metric_Histogram>>::iterator metric = family.histograms.begin(); metric != family.histograms.end(); ++metric) {
+      const std::vector<double> &bounds = metric->second->get_bounds();
+      std::vector<uint64_t> counts = metric->second->bucket_counts();
+      uint64_t cumulative = 0;
+      for (size_t i = 0; i < counts.size(); i++) {
+        cumulative += counts[i];
+        std::string le = (i < bounds.size()) ? format_value(bounds[i]) : "+Inf";
+        out += with_labels(name + "_bucket", metric->first, label("le", le)) + " " + std::to_string(cumulative) + "\n";
+      }
+      out += with_labels(name + "_sum", metric->first) + " " + format_value(metric->second->sum()) + "\n";
+      out += with_labels(name + "_count", metric->first) + " " + std::to_string(cumulative) + "\n";
+    }
+  }
+
+  if (openmetrics) {
+    out += "# EOF\n";
+  }
+  return out;
+}
+
+bool Metrics::start(const std::string &address, int port) {
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  if (inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1) {
+    BOOST_LOG_TRIVIAL(error) << "Metrics: invalid address: " << address;
+    return false;
+  }
+
+  d_listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (d_listen_fd < 0) {
+    BOOST_LOG_TRIVIAL(error) << "Metrics: unable to create socket: " << strerror(errno);
+    return false;
+  }
+  set_cloexec(d_listen_fd);
+  int reuse = 1;
+  setsockopt(d_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  if ((bind(d_listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) || (listen(d_listen_fd, 8) < 0)) {
+    BOOST_LOG_TRIVIAL(error) << "Metrics: unable to listen on " << address << ":" << port << " - " << strerror(errno);
+    close(d_listen_fd);
+    d_listen_fd = -1;
+    return false;
+  }
+  if (pipe(d_wake_pipe) < 0) {
+    BOOST_LOG_TRIVIAL(error) << "Metrics: unable to create pipe: " << strerror(errno);
+    close(d_listen_fd);
+    d_listen_fd = -1;
+    return false;
+  }
+  set_cloexec(d_wake_pipe[0]);
+  set_cloexec(d_wake_pipe[1]);
+
+  BOOST_LOG_TRIVIAL(info) << "Metrics: serving http://" << address << ":" << port << "/metrics";
+  d_server = std::thread(&Metrics::run, this);
+  return true;
+}
+
+void Metrics::stop() {
+  if (!d_server.joinable()) {
+    return;
+  }
+  char wake = 0;
+  if (write(d_wake_pipe[1], &wake, 1) < 0) {
+    BOOST_LOG_TRIVIAL(error) << "Metrics: unable to stop the listener: " << strerror(errno);
+  }
+  d_server.join();
+  close(d_listen_fd);
+  close(d_wake_pipe[0]);
+  close(d_wake_pipe[1]);
+  d_listen_fd = -1;
+  d_wake_pipe[0] = -1;
+  d_wake_pipe[1] = -1;
+}
+
+// Scrapes are rare and quick, so they are answered one at a time
+void Metrics::run() {
+  while (true) {
+    struct pollfd fds[2];
+    fds[0].fd = d_listen_fd;
+    fds[0].events = POLLIN;
+    fds[1].fd = d_wake_pipe[0];
+    fds[1].events = POLLIN;
+    if (poll(fds, 2, -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      BOOST_LOG_TRIVIAL(error) << "Metrics: poll failed: " << strerror(errno);
+      return;
+    }
+    if (fds[1].revents) {
+      return;
+    }
+    if (fds[0].revents & POLLIN) {
+      int fd = accept(d_listen_fd, NULL, NULL);
+      if (fd >= 0) {
+        set_cloexec(fd);
+        handle_client(fd);
+        close(fd);
+      }
+    }
+  }
+}
+
+static bool send_all(int fd, const std::string &data) {
+  size_t sent = 0;
+  while (sent < data.size()) {
+    ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    sent += n;
+  }
+  return true;
+}
+
+void Metrics::handle_client(int fd) {
+  struct timeval timeout;
+  timeout.tv_sec = METRICS_CLIENT_TIMEOUT_S;
+  timeout.tv_usec = 0;
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#ifdef SO_NOSIGPIPE
+  int no_sigpipe = 1;
+  setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+
+  std::string request;
+  char buf[1024];
+  while (request.find("\r\n\r\n") == std::string::npos) {
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n <= 0) {
+      return;
+    }
+    request.append(buf, n);
+    if (request.size() > METRICS_MAX_REQUEST) {
+      return;
+    }
+  }
+
+  std::string request_line = request.substr(0, request.find("\r\n"));
+  std::string path;
+  if (request_line.compare(0, 4, "GET ") == 0) {
+    path = request_line.substr(4, request_line.find(' ', 4) - 4);
+    path = path.substr(0, path.find('?'));
+  }
+
+  std::string status;
+  std::string content_type = "text/plain; charset=utf-8";
+  std::string body;
+  if (path == "/metrics") {
+    // Header names are case insensitive, but scrapers send the values as written in the spec
+    bool openmetrics = request.find("application/openmetrics-text") != std::string::npos;
+    status = "200 OK";
+    if (openmetrics) {
+      content_type = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+    } else {
+      content_type = "text/plain; version=0.0.4; charset=utf-8";
+    }
+    body = format(openmetrics);
+  } else if (path.empty()) {
+    status = "405 Method Not Allowed";
+    body = "Only GET is supported\n";
+  } else {
+    status = "404 Not Found";
+    body = "Metrics are at /metrics\n";
+  }
+
+  send_all(fd, "HTTP/1.1 " + status + "\r\nContent-Type: " + content_type + "\r\nContent-Length: " + std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body);
+}
@@ -0,0 +1,113 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Counters and histograms are updated from the DSP threads, the call
+// concluder workers and the main loop. Each thread adds into a slot of its own,
+// so an update is one uncontended atomic add and never takes a lock. The slots
+// are summed when the metrics are scraped.
+const int METRIC_SLOTS = 16;
+
+struct alignas(64) Metric_Line {
+  std::atomic<uint64_t> v[8];
+  Metric_Line() {
+    for (int i = 0; i < 8; i++) {
+      v[i].store(0, std::memory_order_relaxed);
+    }
+  }
+};
+
+class Metric_Counter {
+public:
+  Metric_Counter();
+  void inc(uint64_t n = 1);
+  uint64_t value() const;
+
+private:
+  std::vector<Metric_Line> d_slots;
+};
+
+// Only set from one thread, the main loop, so it is a plain atomic
+class Metric_Gauge {
+public:
+  Metric_Gauge() : d_value(0) {}
+  void set(double value) { d_value.store(value, std::memory_order_relaxed); }
+  double value() const { return d_value.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<double> d_value;
+};
+
+// Durations in seconds, counted into buckets with the given upper bounds
+class Metric_Histogram {
+public:
+  explicit Metric_Histogram(const std::vector<double> &bounds);
+  void observe(double seconds);
+  const std::vector<double> &get_bounds() const { return d_bounds; }
+  // The count in each bucket, not cumulative, with the +Inf bucket last
+  std::vector<uint64_t> bucket_counts() const;
+  double sum() const;
+
+private:
+  std::atomic<uint64_t> &cell(size_t slot, size_t index) { return d_lines[slot * d_lines_per_slot + index / 8].v[index % 8]; }
+  const std::atomic<uint64_t> &cell(size_t slot, size_t index) const { return d_lines[slot * d_lines_per_slot + index / 8].v[index % 8]; }
+
+  std::vector<double> d_bounds;
+  size_t d_lines_per_slot;
+  std::vector<Metric_Line> d_lines; // per slot: the buckets, then the sum in nanoseconds
+};
+
+// The metrics trunk-recorder keeps, and the HTTP listener that serves them in
+// the Prometheus text format, or OpenMetrics when the scraper asks for it.
+// Metrics are registered by name and label set; asking again returns the same
+// one, so callers look a metric up once and keep the pointer.
+class Metrics {
+public:
+  Metrics();
+  ~Metrics();
+
+  // labels is a list such as system="p25",source="0" built with label()
+  Metric_Counter *counter(const std::string &name, const std::string &help, const std::string &labels = "");
+  Metric_Gauge *gauge(const std::string &name, const std::string &help, const std::string &labels = "");
+  Metric_Histogram *histogram(const std::string &name, const std::string &help, const std::vector<double> &bounds, const std::string &labels = "");
+
+  static std::string label(const std::string &name, const std::string &value);
+  static std::string label(const std::string &name, long value) { return label(name, std::to_string(value)); }
+
+  std::string format(bool openmetrics);
+
+  bool start(const std::string &address, int port);
+  void stop();
+
+private:
+  struct Family {
+    std::string type;
+    std::string help;
+    std::map<std::string, std::unique_ptr<Metric_Counter>> counters;
+    std::map<std::string, std::unique_ptr<Metric_Gauge>> gauges;
+    std::map<std::string, std::unique_ptr<Metric_Histogram>> histograms;
+  };
+
+  Family &family(const std::string &name, const std::string &type, const std::string &help);
+  void run();
+  void handle_client(int fd);
+
+  std::mutex d_mutex;
+  std::map<std::string, Family> d_families;
+
+  int d_listen_fd;
+  int d_wake_pipe[2];
+  std::thread d_server;
+};
+
+extern Metrics metrics;
+
+#endif // METRICS_H
@@ -1,5 +1,9 @@
 #include "monitor_systems.h"
+#include "call_concluder/call_concluder.h"
+#include "metrics.h"
 #include "recorders/p25_recorder.h"
+#include "setup_systems.h"
+#include "speculative_tuner.h"
 #include <chrono>
 #include <boost/log/sinks/text_file_backend.hpp>
 #include <boost/log/core.hpp>
@@ -26,7 +30,72 @@ uint64_t time_since_epoch_millisec() {
   return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
 }
 
-bool start_recorder(Call *call, TrunkMessage message, Config &config, System *sys, std::vector<Source *> &sources) {
+// The metrics for each System, looked up once and kept by sys_num
+struct System_Metrics {
+  Metric_Counter *control_messages;
+  Metric_Counter *control_crc_errors;
+  Metric_Histogram *grant_latency;
+};
+static std::vector<System_Metrics> system_metrics;
+
+static System_Metrics &get_system_metrics(System *sys) {
+  size_t sys_num = sys->get_sys_num();
+  if (sys_num >= system_metrics.size()) {
+    system_metrics.resize(sys_num + 1);
+  }
+  System_Metrics &sys_metrics = system_metrics[sys_num];
+  if (!sys_metrics.control_messages) {
+    std::string labels = Metrics::label("system", sys->get_short_name());
+    sys_metrics.control_messages = metrics.counter("trunk_recorder_control_messages", "Control channel messages decoded.", labels);
+    sys_metrics.control_crc_errors = metrics.counter("trunk_recorder_control_crc_errors", "Control channel blocks dropped for a bad CRC.", labels);
+    sys_metrics.grant_latency = metrics.histogram("trunk_recorder_grant_to_recorder_seconds", "Time from decoding a grant to starting a recorder for it.",
+                                                  {0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5}, labels);
+  }
+  return sys_metrics;
+}
+
+// Sets the metrics that are read from state only the main loop may touch
+static void update_metrics(std::vector<Source *> &sources, std::vector<System *> &systems) {
+  // The overflow counts each control ring had at the last update
+  static std::map<gr::op25_repeater::control_frame_ring *, long> ring_overflows;
+
+  for (vector<Source *>::iterator it = sources.begin(); it != sources.end(); it++) {
+    Source *source = *it;
+    std::map<std::string, std::pair<int, int>> counts; // busy and available recorders of each type
+    std::vector<Recorder *> recorders = source->get_recorders();
+    for (std::vector<Recorder *>::iterator rec_it = recorders.begin(); rec_it != recorders.end(); rec_it++) {
+      std::pair<int, int> &count = counts[(*rec_it)->get_type_string()];
+      if ((*rec_it)->get_state() == AVAILABLE) {
+        count.second++;
+      } else {
+        count.first++;
+      }
+    }
+    for (std::map<std::string, std::pair<int, int>>::iterator count = counts.begin(); count != counts.end(); count++) {
+      std::string labels = Metrics::label("source", source->get_num()) + "," + Metrics::label("type", count->first);
+      metrics.gauge("trunk_recorder_recorders", "Recorders on each Source by type and whether they are busy.", labels + "," + Metrics::label("state", "busy"))->set(count->second.first);
+      metrics.gauge("trunk_recorder_recorders", "Recorders on each Source by type and whether they are busy.", labels + "," + Metrics::label("state", "available"))->set(count->second.second);
+    }
+  }
+
+  for (std::vector<System *>::iterator it = systems.begin(); it != systems.end(); ++it) {
+    System_impl *sys = (System_impl *)*it;
+    for (std::vector<System_impl::Control_Channel_Input>::iterator input_it = sys->control_channel_inputs.begin(); input_it != sys->control_channel_inputs.end(); input_it++) {
+      long overflows = input_it->control_ring->overflows();
+      long &last = ring_overflows[input_it->control_ring];
+      if (overflows > last) {
+        std::string labels = Metrics::label("system", sys->get_short_name()) + "," + Metrics::label("source", input_it->source->get_num());
+        metrics.counter("trunk_recorder_control_ring_overflows", "Control channel frames dropped because the main loop fell behind the decoder.", labels)->inc(overflows - last);
+        last = overflows;
+      }
+    }
+  }
+
+  metrics.gauge("trunk_recorder_concluder_queue", "Concluded calls being processed, or waiting to retry.", Metrics::label("queue", "running"))->set(Call_Concluder::call_data_workers.size());
+  metrics.gauge("trunk_recorder_concluder_queue", "Concluded calls being processed, or waiting to retry.", Metrics::label("queue", "retry"))->set(Call_Concluder::retry_call_list.size());
+}
+
+bool start_recorder(Call *call, const TrunkMessage &message, Config &config, System *sys, std::vector<Source *> &sources) {
   Talkgroup *talkgroup = sys->find_talkgroup(call->get_talkgroup());
 
   bool source_found = false;
@@ -37,14 +106,12 @@ bool start_recorder(Call *call, TrunkMessage message, Config &config, System *sy
   Recorder *debug_recorder;
   Recorder *sigmf_recorder;
 
-  if (!talkgroup){
-    BOOST_FOREACH (auto &TGID, sys->get_talkgroup_patch(call->get_talkgroup())) {  //for each talkgroup in the patch
-      if (sys->find_talkgroup(TGID) != NULL){  //if the patched talkgroup is known
-        override_record_unknown = true;
-        std::string loghdr = log_header( call->get_short_name(), call->get_call_num(), call->get_talkgroup_display(), call->get_freq());
-        BOOST_LOG_TRIVIAL(info) << loghdr << "\u001b[33mEnabling recording of TG not in Talkgroup File due to active supergroup patch\u001b[0m ";
-      }
-    }
+  const TalkgroupPatch *patch = sys->find_talkgroup_patch(call->get_talkgroup());
+
+  if (!talkgroup && patch && patch->has_known_talkgroup) { // if one of the patched talkgroups is known
+    override_record_unknown = true;
+    std::string loghdr = log_header( call->get_short_name(), call->get_call_num(), call->get_talkgroup_display(), call->get_freq());
+    BOOST_LOG_TRIVIAL(info) << loghdr << "\u001b[33mEnabling recording of TG not in Talkgroup File due to active supergroup patch\u001b[0m ";
   }
 
   if (!talkgroup && (sys->get_record_unknown() == false) && override_record_unknown == false) {
@@ -84,94 +151,92 @@ bool start_recorder(Call *call, TrunkMessage message, Config &config, System *sy
     }
   }
 
-  for (vector<Source *>::iterator it = sources.begin(); it != sources.end(); it++) {
-    Source *source = *it;
+  Source *source = source_index.find(call->get_freq());
 
-    if ((source->get_min_hz() <= call->get_freq()) &&
-        (source->get_max_hz() >= call->get_freq())) {
-      source_found = true;
-
-      if (talkgroup) {
-        int priority = talkgroup->get_priority();
-        BOOST_FOREACH (auto &TGID, sys->get_talkgroup_patch(call->get_talkgroup())) {
-          if (sys->find_talkgroup(TGID) != NULL) {
-            if (sys->find_talkgroup(TGID)->get_priority() < priority) {
-              priority = sys->find_talkgroup(TGID)->get_priority();
-              BOOST_LOG_TRIVIAL(info) << "Temporarily increased priority of talkgroup " << call->get_talkgroup() << " to " << sys->find_talkgroup(TGID)->get_priority() << " due to active patch with talkgroup " << TGID;
-            }
-          }
-        }
-        if (talkgroup->mode.compare("A") == 0) {
-          recorder = source->get_analog_recorder(talkgroup, priority, call);
-          call->set_is_analog(true);
-        } else {
-          recorder = source->get_digital_recorder(talkgroup, priority, call);
-        }
+  if (source) {
+    source_found = true;
+
+    if (talkgroup) {
+      int priority = talkgroup->get_priority();
+      if (patch && patch->has_known_talkgroup && (patch->priority < priority)) {
+        priority = patch->priority;
+        BOOST_LOG_TRIVIAL(info) << "Temporarily increased priority of talkgroup " << call->get_talkgroup() << " to " << patch->priority << " due to active patch with talkgroup " << patch->priority_talkgroup;
+      }
+      if (talkgroup->mode.compare("A") == 0) {
+        recorder = source->get_analog_recorder(talkgroup, priority, call);
+        call->set_is_analog(true);
       } else {
-        std::string loghdr = log_header( call->get_short_name(), call->get_call_num(), call->get_talkgroup_display(), call->get_freq());
-        BOOST_LOG_TRIVIAL(info) << loghdr << "TG not in Talkgroup File ";
-
-        // A talkgroup was not found from the talkgroup file.
-        // Use an analog recorder if this is a Type II trunk and defaultMode is analog.
-        // All other cases use a digital recorder.
-        if ((config.default_mode == "analog") && (sys->get_system_type() == "smartnet")) {
-          recorder = source->get_analog_recorder(call);
-          call->set_is_analog(true);
-        } else {
-          recorder = source->get_digital_recorder(call);
-        }
+        recorder = source->get_digital_recorder(talkgroup, priority, call);
+      }
+    } else {
+      std::string loghdr = log_header( call->get_short_name(), call->get_call_num(), call->get_talkgroup_display(), call->get_freq());
+      BOOST_LOG_TRIVIAL(info) << loghdr << "TG not in Talkgroup File ";
+
+      // A talkgroup was not found from the talkgroup file.
+      // Use an analog recorder if this is a Type II trunk and defaultMode is analog.
+      // All other cases use a digital recorder.
+      if ((config.default_mode == "analog") && (sys->get_system_type() == "smartnet")) {
+        recorder = source->get_analog_recorder(call);
+        call->set_is_analog(true);
+      } else {
+        recorder = source->get_digital_recorder(call);
       }
+    }
 
-      if (recorder) {
-        if (message.meta.length()) {
-          BOOST_LOG_TRIVIAL(trace) << message.meta;
-        }
+    if (recorder) {
+      if (message.meta.length()) {
+        BOOST_LOG_TRIVIAL(trace) << message.meta;
+      }
 
-        if (recorder->start(call)) {
-          call->set_recorder(recorder);
-          call->set_state(RECORDING);
-          plugman_setup_recorder(recorder);
-          recorder_found = true;
-        } else {
-          call->set_state(MONITORING);
-          // call->set_monitoring_state(NO_SOURCE);
-          recorder_found = false;
-          return false;
+      if (recorder->start(call)) {
+        call->set_recorder(recorder);
+        call->set_state(RECORDING);
+        plugman_setup_recorder(recorder);
+        recorder_found = true;
+        if (message.timestamp > 0) {
+          double now = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+          get_system_metrics(sys).grant_latency->observe(now - message.timestamp);
         }
       } else {
-        // not recording call either because the priority was too low or no
-        // recorders were available
+        source->release_recorder(recorder);
+        call->set_state(MONITORING);
+        // call->set_monitoring_state(NO_SOURCE);
+        recorder_found = false;
         return false;
       }
+    } else {
+      // not recording call either because the priority was too low or no
+      // recorders were available
+      return false;
+    }
 
-      debug_recorder = source->get_debug_recorder();
+    debug_recorder = source->get_debug_recorder();
 
-      if (debug_recorder) {
-        debug_recorder->start(call);
-        call->set_debug_recorder(debug_recorder);
-        call->set_debug_recording(true);
-        plugman_setup_recorder(debug_recorder);
-        recorder_found = true;
-      } else {
-        // BOOST_LOG_TRIVIAL(info) << "\tNot debug recording call";
-      }
+    if (debug_recorder) {
+      debug_recorder->start(call);
+      call->set_debug_recorder(debug_recorder);
+      call->set_debug_recording(true);
+      plugman_setup_recorder(debug_recorder);
+      recorder_found = true;
+    } else {
+      // BOOST_LOG_TRIVIAL(info) << "\tNot debug recording call";
+    }
 
-      sigmf_recorder = source->get_sigmf_recorder();
+    sigmf_recorder = source->get_sigmf_recorder();
 
-      if (sigmf_recorder) {
-        sigmf_recorder->start(call);
-        call->set_sigmf_recorder(sigmf_recorder);
-        call->set_sigmf_recording(true);
-        plugman_setup_recorder(sigmf_recorder);
-        recorder_found = true;
-      } else {
-        // BOOST_LOG_TRIVIAL(info) << "\tNot SIGMF recording call";
-      }
+    if (sigmf_recorder) {
+      sigmf_recorder->start(call);
+      call->set_sigmf_recorder(sigmf_recorder);
+      call->set_sigmf_recording(true);
+      plugman_setup_recorder(sigmf_recorder);
+      recorder_found = true;
+    } else {
+      // BOOST_LOG_TRIVIAL(info) << "\tNot SIGMF recording call";
+    }
 
-      if (recorder_found) {
-        // recording successfully started.
-        return true;
-      }
+    if (recorder_found) {
+      // recording successfully started.
+      return true;
     }
   }
 
@@ -221,6 +286,12 @@ void print_status(std::vector<Source *> &sources, std::vector<System *> &systems
 
     if ((sys->get_system_type() != "conventional") && (sys->get_system_type() != "conventionalP25") && (sys->get_system_type() != "conventionalDMR") && (sys->get_system_type() != "conventionalSIGMF")) {
       BOOST_LOG_TRIVIAL(info) << "[" << sys->get_short_name() << "]\t" << format_freq(sys->get_current_control_channel()) << "\t" << sys->get_decode_rate() << " msg/sec";
+
+      for (std::vector<System_impl::Control_Channel_Input>::iterator input_it = sys->control_channel_inputs.begin(); input_it != sys->control_channel_inputs.end(); input_it++) {
+        gr::op25_repeater::control_frame_ring *ring = input_it->control_ring;
+        BOOST_LOG_TRIVIAL(info) << "[" << sys->get_short_name() << "]\tSource " << input_it->source->get_num() << " Control Ring - Depth: " << ring->depth() << "/" << ring->capacity() << " High Water: " << ring->high_water() << " Overflows: " << ring->overflows();
+      }
+      BOOST_LOG_TRIVIAL(info) << "[" << sys->get_short_name() << "]\tControl Channel CRC Errors: " << sys->control_crc_errors;
       
       if ((sys->get_source()->get_autotune_source()) && (sys->get_system_type() == "p25")) {
         // If control channel source has autotune enabled, perform autotune adjustments and log to console
@@ -235,6 +306,8 @@ void print_status(std::vector<Source *> &sources, std::vector<System *> &systems
     Source *source = *it;
     source->print_recorders();
   }
+
+  plugman_print_status();
 }
 
 void manage_conventional_call(Call *call, Config &config) {
@@ -307,7 +380,7 @@ void manage_calls(Config &config, std::vector<Call *> &calls) {
     if ((state == MONITORING) && (call->since_last_update() > config.call_timeout)) {
       ended_call = true;
       it = calls.erase(it);
-      delete call;
+      plugman_retire_call(call);
       continue;
     }
 
@@ -327,7 +400,7 @@ void manage_calls(Config &config, std::vector<Call *> &calls) {
           plugman_setup_recorder(recorder);
         }
         it = calls.erase(it);
-        delete call;
+        plugman_retire_call(call);
         continue;
       }
     } else if (call->since_last_update() > config.call_timeout) {
@@ -343,13 +416,13 @@ void manage_calls(Config &config, std::vector<Call *> &calls) {
   }
 }
 
-void current_system_status(TrunkMessage message, System *sys) {
+void current_system_status(const TrunkMessage &message, System *sys) {
   if (sys->update_status(message)) {
     plugman_setup_system(sys);
   }
 }
 
-void current_system_sysid(TrunkMessage message, System *sys) {
+void current_system_sysid(const TrunkMessage &message, System *sys) {
   if ((sys->get_system_type() == "p25") || (sys->get_system_type() == "conventionalP25")) {
     if (sys->update_sysid(message)) {
       plugman_setup_system(sys);
@@ -388,7 +461,7 @@ void unit_location(System *sys, long source_id, long talkgroup_num) {
 
 
 
-void handle_call_grant(TrunkMessage message, System *sys, bool grant_message, Config &config, std::vector<Source *> &sources, std::vector<Call *> &calls) {
+void handle_call_grant(const TrunkMessage &message, System *sys, bool grant_message, Config &config, std::vector<Source *> &sources, std::vector<Call *> &calls) {
   bool call_found = false;
   bool duplicate_grant = false;
   bool superseding_grant = false;
@@ -410,6 +483,8 @@ void handle_call_grant(TrunkMessage message, System *sys, bool grant_message, Co
   unsigned long call_rfss_site = 0;
   unsigned long sys_rfss_site = 0;
 
+  speculative_tuner.note_activity(message.freq, sys);
+
   Talkgroup *message_talkgroup = sys->find_talkgroup(message.talkgroup);
   if (message_talkgroup) {
     message_preferredNAC = message_talkgroup->get_preferredNAC();
@@ -556,7 +631,7 @@ void handle_call_grant(TrunkMessage message, System *sys, bool grant_message, Co
   }
 }
 
-void handle_call_update(TrunkMessage message, System *sys, std::vector<Call *> &calls) {
+void handle_call_update(const TrunkMessage &message, System *sys, std::vector<Call *> &calls) {
   bool call_found = false;
 
   /* Notes: it is possible for 2 Calls to exist for the same talkgroup on different freq. This happens when a Talkgroup starts on a freq
@@ -567,6 +642,8 @@ void handle_call_update(TrunkMessage message, System *sys, std::vector<Call *> &
   going until it gets a termination flag.
   */
 
+  speculative_tuner.note_activity(message.freq, sys);
+
   for (vector<Call *>::iterator it = calls.begin(); it != calls.end(); ++it) {
     Call *call = *it;
 
@@ -596,9 +673,9 @@ void handle_call_update(TrunkMessage message, System *sys, std::vector<Call *> &
   }
 }
 
-void handle_message(std::vector<TrunkMessage> messages, System *sys, Config &config, std::vector<Source *> &sources, std::vector<Call *> &calls, gr::top_block_sptr &tb) {
-  for (std::vector<TrunkMessage>::iterator it = messages.begin(); it != messages.end(); it++) {
-    TrunkMessage message = *it;
+void handle_message(const std::vector<TrunkMessage> &messages, System *sys, Config &config, std::vector<Source *> &sources, std::vector<Call *> &calls, gr::top_block_sptr &tb) {
+  for (std::vector<TrunkMessage>::const_iterator it = messages.begin(); it != messages.end(); it++) {
+    const TrunkMessage &message = *it;
 
     switch (message.message_type) {
     case GRANT:
@@ -702,56 +779,31 @@ void retune_system(System *sys, gr::top_block_sptr &tb, std::vector<Source *> &s
 
   BOOST_LOG_TRIVIAL(error) << "[" << system->get_short_name() << "] Retuning to Control Channel: " << format_freq(control_channel_freq);
 
-  if ((current_source->get_min_hz() <= control_channel_freq) &&
-      (current_source->get_max_hz() >= control_channel_freq)) {
+  Source *source = current_source;
+
+  if ((current_source->get_min_hz() > control_channel_freq) ||
+      (current_source->get_max_hz() < control_channel_freq)) {
+    source = source_index.find(control_channel_freq);
+  }
+
+  if (source) {
     source_found = true;
-    BOOST_LOG_TRIVIAL(info) << "\t - System Source " << current_source->get_num() << " - Min Freq: " << format_freq(current_source->get_min_hz()) << " Max Freq: " << format_freq(current_source->get_max_hz());
-    // The source can cover the System's control channel, break out of the
-    // For Loop
-    if (system->get_system_type() == "smartnet") {
-      system->smartnet_trunking->tune_freq(control_channel_freq);
-      //system->smartnet_trunking->reset();
-    } else if (system->get_system_type() == "p25") {
-      system->p25_trunking->tune_freq(control_channel_freq);
-    } else {
+    BOOST_LOG_TRIVIAL(info) << "\t - System Source " << source->get_num() << " - Min Freq: " << format_freq(source->get_min_hz()) << " Max Freq: " << format_freq(source->get_max_hz());
+
+    if ((system->get_system_type() != "smartnet") && (system->get_system_type() != "p25")) {
       BOOST_LOG_TRIVIAL(error) << "\t - Unknown system type for Retune";
+      return;
     }
-  } else {
-    for (vector<Source *>::iterator src_it = sources.begin(); src_it != sources.end(); src_it++) {
-      Source *source = *src_it;
-
-      if ((source->get_min_hz() <= control_channel_freq) &&
-          (source->get_max_hz() >= control_channel_freq)) {
-        source_found = true;
-        BOOST_LOG_TRIVIAL(info) << "\t - System Source " << source->get_num() << " - Min Freq: " << format_freq(source->get_min_hz()) << " Max Freq: " << format_freq(source->get_max_hz());
-
-        if (system->get_system_type() == "smartnet") {
-          system->set_source(source);
-          // We must lock the flow graph in order to disconnect and reconnect blocks
-          tb->lock();
-          tb->disconnect(current_source->get_src_block(), 0, system->smartnet_trunking, 0);
-          system->smartnet_trunking = smartnet_impl::make(control_channel_freq, source->get_center(), source->get_rate(), system->get_msg_queue(), system->get_sys_num());
-          tb->connect(source->get_src_block(), 0, system->smartnet_trunking, 0);
-          tb->unlock();
-          //system->smartnet_trunking->reset();
-        } else if (system->get_system_type() == "p25") {
-          system->set_source(source);
-          // We must lock the flow graph in order to disconnect and reconnect blocks
-          // ( We have gone back and forth on whether this should be lock/unlock or stop/wait/start.
-          //   If there are unexplained issues around control channel tuning, we should look at alternet
-          //   approaches. See PR #1090 )
-          tb->lock();
-          tb->disconnect(current_source->get_src_block(), 0, system->p25_trunking, 0);
-          system->p25_trunking = make_p25_trunking(control_channel_freq, source->get_center(), source->get_rate(), system->get_msg_queue(), system->get_qpsk_mod(), system->get_sys_num());
-          tb->connect(source->get_src_block(), 0, system->p25_trunking, 0);
-          tb->unlock();
-        } else {
-          BOOST_LOG_TRIVIAL(error) << "\t - Unkown system type for Retune";
-        }
 
-        // break out of the For Loop
-        break;
-      }
+    // Switching to another Source's trunking block only flips selector ports. The flow
+    // graph only has to be locked the first time a control channel learned over the air
+    // lands on a Source that was not set up with a trunking block.
+    if (!select_control_channel_input(system, source, control_channel_freq)) {
+      BOOST_LOG_TRIVIAL(info) << "\t - Adding a Control Channel input to Source " << source->get_num();
+      tb->lock();
+      add_control_channel_input(system, source, control_channel_freq, tb);
+      tb->unlock();
+      select_control_channel_input(system, source, control_channel_freq);
     }
   }
   if (!source_found) {
@@ -855,15 +907,21 @@ int monitor_messages(Config &config, gr::top_block_sptr &tb, std::vector<Source
   uint64_t last_conventional_channel_detection_check = time_since_epoch_millisec();
   time_t current_time = time(NULL);
   uint64_t current_time_ms = time_since_epoch_millisec();
+  // Reused for every batch so the parsers append into storage that is already allocated
   std::vector<TrunkMessage> trunk_messages;
-  SmartnetParser *smartnet_parser;
+  trunk_messages.reserve(64);
+  std::vector<gr::op25_repeater::control_frame> control_frames(64); // batch popped from a control ring at a time
   P25Parser *p25_parser;
 
   signal(SIGINT, exit_interupt);
   signal(SIGHUP, rotate_log_signal);
 
-  smartnet_parser = new SmartnetParser(systems.front()); // this has to eventually be generic;
   p25_parser = new P25Parser();
+  p25_parser->set_build_meta((config.log_level == "debug") || (config.log_level == "trace") || plugman_trunk_message_meta());
+
+  if (config.metrics_port > 0) {
+    metrics.start(config.metrics_address, config.metrics_port);
+  }
 
   while (1) {
 
@@ -875,11 +933,20 @@ int monitor_messages(Config &config, gr::top_block_sptr &tb, std::vector<Source
         call->conclude_call();
 
         it = calls.erase(it);
-        delete call;
+        plugman_retire_call(call);
       }
 
       BOOST_LOG_TRIVIAL(info) << "Cleaning up & Exiting...";
       Call_Concluder::shutdown_call_data_workers(std::chrono::seconds(10));
+      metrics.stop();
+
+      // Drain any OTA aliases still waiting to be written to disk
+      for (vector<System *>::iterator sys_it = systems.begin(); sys_it != systems.end(); sys_it++) {
+        System_impl *system = (System_impl *)*sys_it;
+        if (system->unit_tags) {
+          system->unit_tags->stop_ota_writer();
+        }
+      }
       return exit_code;
     }
 
@@ -905,22 +972,59 @@ int monitor_messages(Config &config, gr::top_block_sptr &tb, std::vector<Source
       System_impl *system = (System_impl *)*sys_it;
 
       if ((system->get_system_type() == "p25") || (system->get_system_type() == "smartnet")) {
+        System_Metrics sys_metrics = get_system_metrics(system);
+        for (std::vector<System_impl::Control_Channel_Input>::iterator input_it = system->control_channel_inputs.begin(); input_it != system->control_channel_inputs.end(); input_it++) {
+          size_t frame_count;
+          while ((frame_count = input_it->control_ring->pop(control_frames.data(), control_frames.size())) > 0) {
+            trunk_messages.clear();
+            long crc_errors = 0;
+            for (size_t i = 0; i < frame_count; i++) {
+              const gr::op25_repeater::control_frame &frame = control_frames[i];
+
+              if (!frame.crc_ok) {
+                crc_errors++;
+                continue;
+              }
+
+              size_t first_message = trunk_messages.size();
+              if (system->get_system_type() == "smartnet") {
+                system->smartnet_parser->parse_frame(frame, system, trunk_messages);
+              } else {
+                p25_parser->parse_frame(frame, system, trunk_messages);
+              }
+              for (size_t m = first_message; m < trunk_messages.size(); m++) {
+                trunk_messages[m].timestamp = frame.timestamp;
+              }
+            }
+            system->control_crc_errors += crc_errors;
+            system->set_message_count(system->get_message_count() + frame_count - crc_errors);
+            sys_metrics.control_messages->inc(frame_count - crc_errors);
+            if (crc_errors) {
+              sys_metrics.control_crc_errors->inc(crc_errors);
+            }
+            handle_message(trunk_messages, system, config, sources, calls, tb);
+            plugman_trunk_message(trunk_messages, system);
+          }
+        }
+
+        // Messages that do not come through a control ring, like the LCW updates and JSON data
         msg.reset();
         msg = system->get_msg_queue()->delete_head_nowait();
         while (msg != 0) {
           system->set_message_count(system->get_message_count() + 1);
+          sys_metrics.control_messages->inc();
 
+          trunk_messages.clear();
           if (system->get_system_type() == "smartnet") {
-            trunk_messages = smartnet_parser->parse_message(msg, system);
-            handle_message(trunk_messages, system, config, sources, calls, tb);
-            plugman_trunk_message(trunk_messages, system);
+            system->smartnet_parser->parse_message(msg, system, trunk_messages);
+          } else {
+            p25_parser->parse_message(msg, system, trunk_messages);
           }
-
-          if (system->get_system_type() == "p25") {
-            trunk_messages = p25_parser->parse_message(msg, system);
-            handle_message(trunk_messages, system, config, sources, calls, tb);
-            plugman_trunk_message(trunk_messages, system);
+          for (std::vector<TrunkMessage>::iterator message_it = trunk_messages.begin(); message_it != trunk_messages.end(); message_it++) {
+            message_it->timestamp = 0;
           }
+          handle_message(trunk_messages, system, config, sources, calls, tb);
+          plugman_trunk_message(trunk_messages, system);
 
           if (msg->type() == -1) {
             BOOST_LOG_TRIVIAL(error) << "[" << system->get_short_name() << "]\t process_data_unit timeout";
@@ -940,7 +1044,9 @@ int monitor_messages(Config &config, gr::top_block_sptr &tb, std::vector<Source
 
     if ((current_time - management_timestamp) >= 1.0) {
       manage_calls(config, calls);
+      speculative_tuner.update(config, sources);
       Call_Concluder::manage_call_data_workers();
+      update_metrics(sources, systems);
       management_timestamp = current_time;
     }
 
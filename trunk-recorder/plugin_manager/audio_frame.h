@@ -0,0 +1,96 @@
+#ifndef AUDIO_FRAME_H
+#define AUDIO_FRAME_H
+
+#include <atomic>
+#include <cstdint>
+#include <stddef.h>
+#include <vector>
+
+static const size_t AUDIO_FRAME_SAMPLES = 512; // most samples a frame holds
+
+class Audio_Frame_Pool;
+
+// A chunk of a recorder's audio, shared by every plugin it is handed to. The
+// recorder fills it once and each plugin holds a reference while it is queued
+// for that plugin. A plugin that wants to keep the audio after audio_frame()
+// returns calls retain(), and release() once it is done with it. The last
+// release() puts the frame back in its pool; nothing is allocated or freed.
+class Audio_Frame {
+public:
+  long call_num;         // the Call the audio is from, 0 if there is none
+  int rec_num;           // the Recorder's number
+  long sample_rate;      // samples per second
+  uint64_t sample_time;  // the recorder's sample clock at the first sample. It counts every sample the recorder has output and never goes back, so consecutive frames are contiguous when one starts where the last ended.
+  size_t count;          // samples in use
+  int16_t samples[AUDIO_FRAME_SAMPLES];
+
+  void retain() { d_refs.fetch_add(1, std::memory_order_relaxed); }
+  inline void release();
+
+private:
+  friend class Audio_Frame_Pool;
+
+  std::atomic<int> d_refs;
+  Audio_Frame_Pool *d_pool;
+  Audio_Frame *d_next; // in the pool's free list
+};
+
+// A fixed set of frames for one recorder. Only the recorder's thread takes
+// frames out, but they can be released from any thread, so released frames
+// go onto a lock free stack and the taker swaps the whole stack out when it
+// runs dry. With one taker there is nothing for a frame to be reused under.
+class Audio_Frame_Pool {
+public:
+  explicit Audio_Frame_Pool(size_t size)
+      : d_frames(size),
+        d_local(NULL),
+        d_free(NULL),
+        d_exhausted(0) {
+    for (size_t i = 0; i < d_frames.size(); i++) {
+      d_frames[i].d_refs.store(0, std::memory_order_relaxed);
+      d_frames[i].d_pool = this;
+      d_frames[i].d_next = d_local;
+      d_local = &d_frames[i];
+    }
+  }
+
+  // Producer side. A frame with one reference, or NULL if every frame is in use.
+  Audio_Frame *take() {
+    if (d_local == NULL) {
+      d_local = d_free.exchange(NULL, std::memory_order_acquire);
+      if (d_local == NULL) {
+        d_exhausted.fetch_add(1, std::memory_order_relaxed);
+        return NULL;
+      }
+    }
+    Audio_Frame *frame = d_local;
+    d_local = frame->d_next;
+    frame->d_refs.store(1, std::memory_order_relaxed);
+    return frame;
+  }
+
+  // Any thread
+  void put(Audio_Frame *frame) {
+    Audio_Frame *head = d_free.load(std::memory_order_relaxed);
+    do {
+      frame->d_next = head;
+    } while (!d_free.compare_exchange_weak(head, frame, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  size_t size() const { return d_frames.size(); }
+  unsigned long exhausted() const { return d_exhausted.load(std::memory_order_relaxed); } // times there was no frame to take
+
+private:
+  std::vector<Audio_Frame> d_frames;
+  Audio_Frame *d_local;              // only touched by the taker
+  std::atomic<Audio_Frame *> d_free; // released frames
+  std::atomic<unsigned long> d_exhausted;
+};
+
+void Audio_Frame::release() {
+  if (d_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    d_pool->put(this);
+  }
+}
+
+#endif // AUDIO_FRAME_H
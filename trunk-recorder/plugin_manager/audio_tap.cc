@@ -0,0 +1,164 @@
+#include "audio_tap.h"
+
+#include <chrono>
+#include <utility>
+
+// How long an audio thread sleeps when none of its rings have anything
+static const int AUDIO_TAP_IDLE_MS = 5;
+
+Audio_Tap::Audio_Tap(Recorder *recorder)
+    : d_recorder(recorder),
+      d_pool(AUDIO_TAP_FRAMES),
+      d_sample_time(0) {
+}
+
+Audio_Tap::~Audio_Tap() {
+  for (size_t i = 0; i < d_rings.size(); i++) {
+    delete d_rings[i];
+  }
+}
+
+void Audio_Tap::push(Call *call, const int16_t *samples, size_t n) {
+  // No plugin wants audio, so there is nothing to copy
+  if (d_rings.empty()) {
+    d_sample_time += n;
+    return;
+  }
+  long call_num = call ? call->get_call_num() : 0;
+  int rec_num = d_recorder->get_num();
+  long sample_rate = d_recorder->get_wav_hz();
+  while (n > 0) {
+    size_t count = (n < AUDIO_FRAME_SAMPLES) ? n : AUDIO_FRAME_SAMPLES;
+    Audio_Frame *frame = d_pool.take();
+    if (frame == NULL) {
+      for (size_t i = 0; i < d_rings.size(); i++) {
+        d_rings[i]->drop(count);
+      }
+    } else {
+      frame->call_num = call_num;
+      frame->rec_num = rec_num;
+      frame->sample_rate = sample_rate;
+      frame->sample_time = d_sample_time;
+      frame->count = count;
+      memcpy(frame->samples, samples, count * sizeof(int16_t));
+      for (size_t i = 0; i < d_rings.size(); i++) {
+        d_rings[i]->push(call, frame);
+      }
+      // The rings have their own references, so this hands it back if none took it
+      frame->release();
+    }
+    d_sample_time += count;
+    samples += count;
+    n -= count;
+  }
+}
+
+audio_tap_ring *Audio_Tap::add_ring() {
+  audio_tap_ring *ring = new audio_tap_ring();
+  d_rings.push_back(ring);
+  return ring;
+}
+
+Audio_Consumer::Audio_Consumer(std::string name, boost::shared_ptr<Plugin_Api> api)
+    : d_name(name),
+      d_api(api),
+      d_stopping(false),
+      d_delivered(0) {
+}
+
+Audio_Consumer::~Audio_Consumer() {
+  stop();
+}
+
+void Audio_Consumer::add_tap(Audio_Tap *tap) {
+  Input input;
+  input.recorder = tap->get_recorder();
+  input.ring = tap->add_ring();
+  std::lock_guard<std::mutex> lock(d_mutex);
+  d_inputs.push_back(input);
+}
+
+void Audio_Consumer::start() {
+  if (!d_worker.joinable()) {
+    d_stopping = false;
+    d_worker = std::thread(&Audio_Consumer::run, this);
+  }
+}
+
+void Audio_Consumer::stop() {
+  d_stopping = true;
+  if (d_worker.joinable()) {
+    d_worker.join();
+  }
+}
+
+void Audio_Consumer::run() {
+  std::vector<Input> inputs;
+  while (!d_stopping) {
+    {
+      std::lock_guard<std::mutex> lock(d_mutex);
+      if (inputs.size() != d_inputs.size()) {
+        inputs = d_inputs;
+      }
+    }
+
+    bool idle = true;
+    for (size_t i = 0; i < inputs.size(); i++) {
+      audio_tap_ring *ring = inputs[i].ring;
+      audio_tap_chunk *chunk;
+      while ((chunk = ring->front()) != NULL) {
+        d_api->audio_frame(chunk->call, inputs[i].recorder, chunk->frame);
+        d_delivered.fetch_add(chunk->frame->count, std::memory_order_relaxed);
+        ring->pop();
+        idle = false;
+      }
+    }
+
+    if (idle) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(AUDIO_TAP_IDLE_MS));
+    }
+  }
+}
+
+bool Audio_Consumer::drain_recorder(int rec_num, int timeout_ms) {
+  std::vector<std::pair<audio_tap_ring *, size_t>> fence;
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    for (size_t i = 0; i < d_inputs.size(); i++) {
+      audio_tap_ring *ring = d_inputs[i].ring;
+      size_t pushed = ring->pushed();
+      if ((d_inputs[i].recorder->get_num() == rec_num) && (ring->popped() < pushed)) {
+        fence.push_back(std::make_pair(ring, pushed));
+      }
+    }
+  }
+
+  std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+  for (size_t i = 0; i < fence.size(); i++) {
+    while (fence[i].first->popped() < fence[i].second) {
+      if (d_stopping || (std::chrono::steady_clock::now() >= deadline)) {
+        return false;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  return true;
+}
+
+Audio_Consumer_Stats Audio_Consumer::get_stats() {
+  std::lock_guard<std::mutex> lock(d_mutex);
+  Audio_Consumer_Stats stats;
+  stats.delivered = d_delivered.load(std::memory_order_relaxed);
+  stats.dropped = 0;
+  stats.high_water = 0;
+  stats.capacity = 0;
+  for (size_t i = 0; i < d_inputs.size(); i++) {
+    audio_tap_ring *ring = d_inputs[i].ring;
+    stats.dropped += ring->dropped();
+    stats.capacity = ring->capacity();
+    if (ring->high_water() > stats.high_water) {
+      stats.high_water = ring->high_water();
+    }
+  }
+  return stats;
+}
@@ -0,0 +1,164 @@
+#ifndef AUDIO_TAP_H
+#define AUDIO_TAP_H
+
+#include "plugin_api.h"
+
+#include <atomic>
+#include <boost/shared_ptr.hpp>
+#include <cstdint>
+#include <mutex>
+#include <stddef.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const size_t AUDIO_TAP_CHUNKS = 64;  // per ring, 4 seconds at 8 kHz if the frames are full
+static const size_t AUDIO_TAP_FRAMES = 256; // per tap, enough for the rings of stalled plugins and the frames plugins keep
+static const int AUDIO_TAP_DRAIN_MS = 500;  // longest call_end waits for a plugin's audio thread to catch up
+
+struct audio_tap_chunk {
+  Call *call;
+  Audio_Frame *frame;
+};
+
+// Fixed size single producer, single consumer ring of audio frames. A recorder's
+// plugin sink pushes from its GNU Radio thread and one plugin's audio thread
+// pops, without locks or allocation. A frame that does not fit is dropped and
+// counted rather than holding up the recorder.
+class audio_tap_ring {
+public:
+  audio_tap_ring(size_t capacity = AUDIO_TAP_CHUNKS)
+      : d_chunks(round_up(capacity)),
+        d_mask(round_up(capacity) - 1),
+        d_head(0),
+        d_tail(0),
+        d_dropped(0),
+        d_high_water(0) {
+  }
+
+  // Producer side. The ring takes a reference to the frame if there is room for it.
+  bool push(Call *call, Audio_Frame *frame) {
+    size_t head = d_head.load(std::memory_order_relaxed);
+    size_t tail = d_tail.load(std::memory_order_acquire);
+    size_t depth = head - tail;
+    if (depth >= d_chunks.size()) {
+      drop(frame->count);
+      return false;
+    }
+    audio_tap_chunk &chunk = d_chunks[head & d_mask];
+    chunk.call = call;
+    chunk.frame = frame;
+    frame->retain();
+    d_head.store(head + 1, std::memory_order_release);
+
+    if (depth + 1 > d_high_water.load(std::memory_order_relaxed)) {
+      d_high_water.store(depth + 1, std::memory_order_relaxed);
+    }
+    return true;
+  }
+
+  void drop(size_t samples) { d_dropped.fetch_add(samples, std::memory_order_relaxed); }
+
+  // Consumer side. The oldest chunk, or NULL if there is none. It stays valid
+  // until pop(), which gives up the ring's reference to the frame.
+  audio_tap_chunk *front() {
+    size_t tail = d_tail.load(std::memory_order_relaxed);
+    if (tail == d_head.load(std::memory_order_acquire)) {
+      return NULL;
+    }
+    return &d_chunks[tail & d_mask];
+  }
+
+  void pop() {
+    size_t tail = d_tail.load(std::memory_order_relaxed);
+    d_chunks[tail & d_mask].frame->release();
+    d_tail.store(tail + 1, std::memory_order_release);
+  }
+
+  size_t depth() const { return pushed() - popped(); }
+  size_t capacity() const { return d_chunks.size(); }
+  size_t high_water() const { return d_high_water.load(std::memory_order_relaxed); }
+  size_t pushed() const { return d_head.load(std::memory_order_acquire); } // total chunks ever queued
+  size_t popped() const { return d_tail.load(std::memory_order_acquire); } // total chunks ever taken out
+  unsigned long dropped() const { return d_dropped.load(std::memory_order_relaxed); } // samples
+
+private:
+  static size_t round_up(size_t n) {
+    size_t size = 1;
+    while (size < n)
+      size <<= 1;
+    return size;
+  }
+
+  std::vector<audio_tap_chunk> d_chunks;
+  const size_t d_mask;
+  alignas(64) std::atomic<size_t> d_head; // written by the producer
+  alignas(64) std::atomic<size_t> d_tail; // written by the consumer
+  std::atomic<unsigned long> d_dropped;
+  std::atomic<size_t> d_high_water;
+};
+
+// The audio from one plugin sink, with a ring for each plugin. The rings are
+// added before the flowgraph starts and never change while it runs. Each chunk
+// of audio is copied once, into a frame from the tap's pool, and that frame is
+// shared by all of the rings.
+class Audio_Tap {
+public:
+  Audio_Tap(Recorder *recorder);
+  ~Audio_Tap();
+
+  // Called from the plugin sink's thread
+  void push(Call *call, const int16_t *samples, size_t n);
+
+  audio_tap_ring *add_ring();
+  Recorder *get_recorder() const { return d_recorder; }
+  const std::vector<audio_tap_ring *> &get_rings() const { return d_rings; }
+
+private:
+  Recorder *d_recorder;
+  std::vector<audio_tap_ring *> d_rings;
+  Audio_Frame_Pool d_pool;
+  uint64_t d_sample_time;
+};
+
+struct Audio_Consumer_Stats {
+  unsigned long delivered; // samples
+  unsigned long dropped;   // samples
+  size_t high_water;       // chunks, deepest of the rings
+  size_t capacity;         // chunks per ring
+};
+
+// Calls audio_frame on one plugin from a thread of its own, with the audio
+// from each of the taps.
+class Audio_Consumer {
+public:
+  Audio_Consumer(std::string name, boost::shared_ptr<Plugin_Api> api);
+  ~Audio_Consumer();
+
+  void add_tap(Audio_Tap *tap);
+  void start();
+  void stop();
+  // Waits until the audio queued so far from the recorder has been handed to
+  // the plugin. Returns false if that takes longer than timeout_ms.
+  bool drain_recorder(int rec_num, int timeout_ms);
+  Audio_Consumer_Stats get_stats();
+
+private:
+  struct Input {
+    Recorder *recorder;
+    audio_tap_ring *ring;
+  };
+
+  void run();
+
+  std::string d_name;
+  boost::shared_ptr<Plugin_Api> d_api;
+  std::mutex d_mutex;
+  std::vector<Input> d_inputs;
+  std::thread d_worker;
+  std::atomic<bool> d_stopping;
+  std::atomic<unsigned long> d_delivered;
+};
+
+#endif // AUDIO_TAP_H
@@ -7,6 +7,7 @@
 #include "../systems/system.h"
 #include "../systems/parser.h"
 #include "../formatter.h"
+#include "audio_frame.h"
 
 #include <json.hpp>
 
@@ -28,6 +29,22 @@ enum VoiceCodecType {
   CODEC_YSF_HALFRATE = 5, // YSF half rate: 9 AMBE2250 params, int b[9] cast to uint32_t
 };
 
+static const int VOICE_CODEC_MAX_PARAMS = 9; // the most params any codec type has
+
+// One voice_codec_data call, as delivered in a voice_codec_batch
+struct Voice_Codec_Frame {
+  std::int64_t time_ms; // when the frame was decoded, milliseconds since the epoch
+  int codec_type;
+  long tgid;
+  uint32_t src_id;
+  int errs;
+  int e0;         // FEC errors in the first codeword (IMBE: E0), 0 for codecs without them
+  int e1;         // FEC errors in the second codeword (IMBE: ET)
+  bool encrypted; // no key for the frame, so params are ciphertext
+  int param_count;
+  uint32_t params[VOICE_CODEC_MAX_PARAMS];
+};
+
 using json = nlohmann::json;
 
 class Plugin_Api {
@@ -39,7 +56,14 @@ public:
   virtual int poll_one() { return 0; };
   virtual int signal(long unitId, const char *signaling_type, gr::blocks::SignalType sig_type, Call *call, System *system, Recorder *recorder) { return 0; };
   virtual int audio_stream(Call *call, Recorder *recorder, int16_t *samples, int sampleCount) { return 0; };
-  virtual int trunk_message(std::vector<TrunkMessage> messages, System *system) { return 0; };
+  // The same audio as a shared frame, which the plugin can retain() to keep past the call. Hands it to audio_stream unless overridden.
+  virtual int audio_frame(Call *call, Recorder *recorder, Audio_Frame *frame) { return audio_stream(call, recorder, frame->samples, frame->count); };
+  // Return true to be given the recorders' audio. Only these plugins get an audio ring for each recorder and an audio thread.
+  virtual bool wants_audio() { return false; };
+  // Called once per batch of decoded control channel messages. The vector is reused after the call returns.
+  virtual int trunk_message(const std::vector<TrunkMessage> &messages, System *system) { return 0; };
+  // Return true to have the parsers fill in TrunkMessage::meta, which is skipped otherwise
+  virtual bool trunk_message_meta() { return false; };
   virtual int call_start(Call *call) { return 0; };
   virtual int call_end(Call_Data_t call_info) { return 0; }; //= 0; //{ BOOST_LOG_TRIVIAL(info) << "plugin_api call_end"; return 0; };
   virtual int calls_active(std::vector<Call *> calls) { return 0; };
@@ -61,6 +85,19 @@ public:
   // rx_sync slot tracking; for D-STAR/YSF they are 0. Use call->get_talkgroup() and
   // call->get_current_source_id() for authoritative values across all codec types.
   virtual int voice_codec_data(Call *call, int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs) { return 0; };
+  // The frames of one call from one recorder, up to a superframe at a time. The frames are only
+  // valid during the call. Hands each frame to voice_codec_data unless overridden.
+  virtual int voice_codec_batch(Call *call, const Voice_Codec_Frame *frames, int frame_count) {
+    int err = 0;
+    for (int i = 0; i < frame_count; i++) {
+      const Voice_Codec_Frame &frame = frames[i];
+      int frame_err = voice_codec_data(call, frame.codec_type, frame.tgid, frame.src_id, frame.params, frame.param_count, frame.errs);
+      if (frame_err != 0) {
+        err = frame_err;
+      }
+    }
+    return err;
+  };
   //void set_frequency_format(int f) { frequencyFormat = f; }
   virtual ~Plugin_Api(){};
 };
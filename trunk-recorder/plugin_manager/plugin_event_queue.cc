@@ -0,0 +1,214 @@
+#include "plugin_event_queue.h"
+
+#include <boost/log/trivial.hpp>
+
+Plugin_Event_Queue::Plugin_Event_Queue(std::string name, boost::shared_ptr<Plugin_Api> api, size_t capacity, plugin_overflow_t overflow)
+    : d_name(name),
+      d_api(api),
+      d_capacity(capacity > 0 ? capacity : 1),
+      d_overflow(overflow),
+      d_stopping(false),
+      d_poll_requested(false),
+      d_pushed(0),
+      d_in_flight(0),
+      d_high_water(0),
+      d_handled(0),
+      d_dropped(0),
+      d_coalesced(0),
+      d_handler_total_ms(0),
+      d_handler_max_ms(0),
+      d_wait_max_ms(0) {
+}
+
+Plugin_Event_Queue::~Plugin_Event_Queue() {
+  stop();
+}
+
+void Plugin_Event_Queue::start() {
+  std::lock_guard<std::mutex> lock(d_mutex);
+  if (!d_worker.joinable()) {
+    d_stopping = false;
+    d_worker = std::thread(&Plugin_Event_Queue::run, this);
+  }
+}
+
+void Plugin_Event_Queue::stop() {
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_stopping = true;
+  }
+  d_not_empty.notify_all();
+  d_not_full.notify_all();
+  if (d_worker.joinable()) {
+    d_worker.join();
+  }
+}
+
+void Plugin_Event_Queue::push(handler_t handler, plugin_event_kind kind, const void *key) {
+  std::unique_lock<std::mutex> lock(d_mutex);
+  if (d_stopping) {
+    return;
+  }
+
+  if ((d_overflow == OVERFLOW_COALESCE) && (kind != EVENT_ORDERED)) {
+    for (std::deque<Event>::iterator it = d_events.begin(); it != d_events.end(); ++it) {
+      if ((it->kind == kind) && (it->key == key)) {
+        // The newer event goes to the back, so the queue stays in sequence order
+        d_events.erase(it);
+        d_coalesced++;
+        break;
+      }
+    }
+  }
+
+  if (d_events.size() >= d_capacity) {
+    if (d_overflow == OVERFLOW_BLOCK) {
+      d_not_full.wait(lock, [this] { return d_stopping || (d_events.size() < d_capacity); });
+      if (d_stopping) {
+        return;
+      }
+    } else {
+      d_events.pop_front();
+      d_dropped++;
+    }
+  }
+
+  Event event;
+  event.seq = ++d_pushed;
+  event.kind = kind;
+  event.key = key;
+  event.queued = std::chrono::steady_clock::now();
+  event.handler = std::move(handler);
+  d_events.push_back(std::move(event));
+  if (d_events.size() > d_high_water) {
+    d_high_water = d_events.size();
+  }
+  lock.unlock();
+  d_not_empty.notify_one();
+}
+
+void Plugin_Event_Queue::request_poll() {
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (d_poll_requested || d_stopping) {
+      return;
+    }
+    d_poll_requested = true;
+  }
+  d_not_empty.notify_one();
+}
+
+uint64_t Plugin_Event_Queue::get_pushed() {
+  std::lock_guard<std::mutex> lock(d_mutex);
+  return d_pushed;
+}
+
+uint64_t Plugin_Event_Queue::oldest_pending() {
+  std::lock_guard<std::mutex> lock(d_mutex);
+  return oldest_pending_locked();
+}
+
+bool Plugin_Event_Queue::wait_handled(uint64_t seq, int timeout_ms) {
+  std::unique_lock<std::mutex> lock(d_mutex);
+  return d_done.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this, seq] { return oldest_pending_locked() > seq; });
+}
+
+uint64_t Plugin_Event_Queue::oldest_pending_locked() {
+  if (d_in_flight) {
+    return d_in_flight;
+  }
+  if (!d_events.empty()) {
+    return d_events.front().seq;
+  }
+  return d_pushed + 1;
+}
+
+void Plugin_Event_Queue::run() {
+  std::unique_lock<std::mutex> lock(d_mutex);
+  while (true) {
+    d_not_empty.wait(lock, [this] { return d_stopping || d_poll_requested || !d_events.empty(); });
+
+    if (d_poll_requested) {
+      d_poll_requested = false;
+      lock.unlock();
+      d_api->poll_one();
+      lock.lock();
+      continue;
+    }
+
+    if (d_events.empty()) {
+      // Only stopping gets here, and everything queued has been handled
+      d_done.notify_all();
+      break;
+    }
+
+    Event event = std::move(d_events.front());
+    d_events.pop_front();
+    d_in_flight = event.seq;
+    lock.unlock();
+    d_not_full.notify_one();
+
+    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    event.handler(d_api.get());
+    std::chrono::steady_clock::time_point finished = std::chrono::steady_clock::now();
+
+    double wait_ms = std::chrono::duration<double, std::milli>(started - event.queued).count();
+    double handler_ms = std::chrono::duration<double, std::milli>(finished - started).count();
+
+    lock.lock();
+    d_in_flight = 0;
+    d_done.notify_all();
+    d_handled++;
+    d_handler_total_ms += handler_ms;
+    if (handler_ms > d_handler_max_ms) {
+      d_handler_max_ms = handler_ms;
+    }
+    if (wait_ms > d_wait_max_ms) {
+      d_wait_max_ms = wait_ms;
+    }
+  }
+}
+
+Plugin_Queue_Stats Plugin_Event_Queue::get_stats(bool reset) {
+  std::lock_guard<std::mutex> lock(d_mutex);
+  Plugin_Queue_Stats stats;
+  stats.depth = d_events.size();
+  stats.capacity = d_capacity;
+  stats.high_water = d_high_water;
+  stats.handled = d_handled;
+  stats.dropped = d_dropped;
+  stats.coalesced = d_coalesced;
+  stats.handler_total_ms = d_handler_total_ms;
+  stats.handler_max_ms = d_handler_max_ms;
+  stats.wait_max_ms = d_wait_max_ms;
+  if (reset) {
+    d_high_water = d_events.size();
+    d_handler_max_ms = 0;
+    d_wait_max_ms = 0;
+  }
+  return stats;
+}
+
+bool Plugin_Event_Queue::parse_overflow(const std::string &name, plugin_overflow_t &overflow) {
+  if (name == "dropOldest") {
+    overflow = OVERFLOW_DROP_OLDEST;
+  } else if (name == "block") {
+    overflow = OVERFLOW_BLOCK;
+  } else if (name == "coalesce") {
+    overflow = OVERFLOW_COALESCE;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+const char *Plugin_Event_Queue::format_overflow(plugin_overflow_t overflow) {
+  switch (overflow) {
+  case OVERFLOW_BLOCK:
+    return "block";
+  case OVERFLOW_COALESCE:
+    return "coalesce";
+  default:
+    return "dropOldest";
+  }
+}
@@ -0,0 +1,115 @@
+#ifndef PLUGIN_EVENT_QUEUE_H
+#define PLUGIN_EVENT_QUEUE_H
+
+#include "plugin_api.h"
+
+#include <boost/shared_ptr.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+static const int PLUGIN_QUEUE_DRAIN_MS = 1000; // longest call_end waits for an async plugin to handle the call's earlier events
+
+typedef enum {
+  OVERFLOW_DROP_OLDEST, // discard the oldest queued event to make room
+  OVERFLOW_BLOCK,       // wait for the worker to make room
+  OVERFLOW_COALESCE     // as OVERFLOW_DROP_OLDEST, and a snapshot event replaces a queued one of the same kind and key
+} plugin_overflow_t;
+
+// Events that carry a snapshot of state, where only the newest one queued
+// matters. Everything else is EVENT_ORDERED and never coalesced.
+enum plugin_event_kind {
+  EVENT_ORDERED = 0,
+  EVENT_CALLS_ACTIVE,
+  EVENT_SETUP_RECORDER,
+  EVENT_SETUP_SYSTEM,
+  EVENT_SETUP_CONFIG,
+  EVENT_SYSTEM_RATES
+};
+
+struct Plugin_Queue_Stats {
+  size_t depth;
+  size_t capacity;
+  size_t high_water;          // since the stats were last reset
+  unsigned long handled;
+  unsigned long dropped;
+  unsigned long coalesced;
+  double handler_total_ms;
+  double handler_max_ms;      // since the stats were last reset
+  double wait_max_ms;         // longest an event sat in the queue, since the stats were last reset
+};
+
+// A bounded event queue and worker thread for one plugin. Any thread can push;
+// the worker calls the handlers on the plugin one at a time, in order.
+class Plugin_Event_Queue {
+public:
+  typedef std::function<void(Plugin_Api *)> handler_t;
+
+  Plugin_Event_Queue(std::string name, boost::shared_ptr<Plugin_Api> api, size_t capacity, plugin_overflow_t overflow);
+  ~Plugin_Event_Queue();
+
+  void start();
+  // Handles whatever is still queued, then joins the worker
+  void stop();
+
+  void push(handler_t handler, plugin_event_kind kind = EVENT_ORDERED, const void *key = NULL);
+  // Has the worker call poll_one once it is free. Requests made while one is pending are merged.
+  void request_poll();
+
+  // Sequence number of the last event pushed
+  uint64_t get_pushed();
+  // Sequence number of the oldest event still queued or being handled, or
+  // one past get_pushed() if there is none. Anything pushed before it is done.
+  uint64_t oldest_pending();
+  // Waits until every event up to and including seq has been handled.
+  // Returns false if that takes longer than timeout_ms.
+  bool wait_handled(uint64_t seq, int timeout_ms);
+
+  Plugin_Queue_Stats get_stats(bool reset);
+  const std::string &get_name() const { return d_name; }
+  static bool parse_overflow(const std::string &name, plugin_overflow_t &overflow);
+  static const char *format_overflow(plugin_overflow_t overflow);
+
+private:
+  struct Event {
+    uint64_t seq;
+    plugin_event_kind kind;
+    const void *key;
+    std::chrono::steady_clock::time_point queued;
+    handler_t handler;
+  };
+
+  void run();
+  uint64_t oldest_pending_locked();
+
+  std::string d_name;
+  boost::shared_ptr<Plugin_Api> d_api;
+  size_t d_capacity;
+  plugin_overflow_t d_overflow;
+
+  std::mutex d_mutex;
+  std::condition_variable d_not_empty;
+  std::condition_variable d_not_full;
+  std::condition_variable d_done; // a handler finished or the worker exited
+  std::deque<Event> d_events;
+  std::thread d_worker;
+  bool d_stopping;
+  bool d_poll_requested;
+  uint64_t d_pushed;
+  uint64_t d_in_flight; // 0 when the worker is not running a handler
+
+  size_t d_high_water;
+  unsigned long d_handled;
+  unsigned long d_dropped;
+  unsigned long d_coalesced;
+  double d_handler_total_ms;
+  double d_handler_max_ms;
+  double d_wait_max_ms;
+};
+
+#endif // PLUGIN_EVENT_QUEUE_H
@@ -1,6 +1,8 @@
 #include "plugin_manager.h"
+#include "upload_engine.h"
 
 #include "../global_structs.h"
+#include <algorithm>
 #include <boost/dll/import.hpp> // for import_alias
 #include <boost/foreach.hpp>
 #include <boost/function.hpp>
@@ -8,10 +10,46 @@
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/xml_parser.hpp>
+#include <chrono>
+#include <iomanip>
+#include <memory>
 #include <stdlib.h>
 #include <vector>
 
+static const size_t DEFAULT_PLUGIN_QUEUE_SIZE = 1024;
+static const long MAX_UPLOAD_CONNECTIONS = 32;
+
 std::vector<Plugin *> plugins;
+bool plugins_started = false;
+
+// Never deleted, as call concluder threads left behind at exit may still be waiting on it
+Upload_Engine *upload_engine = NULL;
+
+// One for each plugin sink. Only touched from the main thread while the flowgraph is being set up.
+std::vector<Audio_Tap *> audio_taps;
+
+// One for each recorder that decodes voice codec frames. Added from the main thread.
+std::vector<Voice_Codec_Batch *> voice_codec_batches;
+
+// A call deleted while async plugins may still have events that point to it is
+// kept until every queue has moved past the events pushed before it was retired.
+struct Retired_Call {
+  Call *call;
+  std::vector<uint64_t> fence; // get_pushed() of each plugin's queue, 0 for plugins without one
+  std::vector<std::pair<audio_tap_ring *, size_t>> audio_fence; // pushed() of each audio ring that was not empty
+};
+std::vector<Retired_Call> retired_calls;
+
+// Calls handler on the plugin now, or queues it when the plugin is async. The
+// handler has to capture its arguments by value.
+template <typename Handler>
+static void dispatch(Plugin *plugin, Handler handler, plugin_event_kind kind = EVENT_ORDERED, const void *key = NULL) {
+  if (plugin->queue) {
+    plugin->queue->push(handler, kind, key);
+  } else {
+    handler(plugin->api.get());
+  }
+}
 
 Plugin *setup_plugin(std::string plugin_lib, std::string plugin_name) {
   BOOST_LOG_TRIVIAL(info) << "Setting up plugin -  Name: " << plugin_name << "\t Library file: " << plugin_lib;
@@ -28,11 +66,27 @@ Plugin *setup_plugin(std::string plugin_lib, std::string plugin_name) {
 
   plugin->api = plugin->creator();
   plugin->name = plugin_name;
+  plugin->state = PLUGIN_UNKNOWN;
+  plugin->async = false;
+  plugin->queue_size = DEFAULT_PLUGIN_QUEUE_SIZE;
+  plugin->overflow = OVERFLOW_DROP_OLDEST;
+  plugin->queue = NULL;
+  plugin->audio = NULL;
   plugins.push_back(plugin);
 
   return plugin;
 }
 
+void configure_event_queue(Plugin *plugin, json element) {
+  plugin->async = element.value("async", plugin->async);
+  plugin->queue_size = element.value("queueSize", plugin->queue_size);
+  std::string overflow = element.value("overflow", Plugin_Event_Queue::format_overflow(plugin->overflow));
+  if (!Plugin_Event_Queue::parse_overflow(overflow, plugin->overflow)) {
+    BOOST_LOG_TRIVIAL(error) << "Plugin: " << plugin->name << " - unknown overflow policy: " << overflow << ", using dropOldest";
+    plugin->overflow = OVERFLOW_DROP_OLDEST;
+  }
+}
+
 void initialize_plugins(json config_data, Config *config, std::vector<Source *> sources, std::vector<System *> systems) {
 
   bool plugins_exists = config_data.contains("plugins");
@@ -54,6 +108,7 @@ void initialize_plugins(json config_data, Config *config, std::vector<Source *>
       if (plugin_enabled) {
         Plugin *plugin = setup_plugin(plugin_lib, plugin_name);
         plugin->api->parse_config(element);
+        configure_event_queue(plugin, element);
       }
     }
 
@@ -68,6 +123,25 @@ void initialize_plugins(json config_data, Config *config, std::vector<Source *>
     BOOST_LOG_TRIVIAL(info) << "No plugins configured";
   }
 
+  // The built-in plugins have no plugin object, so they are made async by name
+  for (const std::string &name : config_data.value("asyncPlugins", std::vector<std::string>())) {
+    bool found = false;
+    for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
+      if ((*it)->name == name) {
+        (*it)->async = true;
+        found = true;
+      }
+    }
+    if (!found) {
+      BOOST_LOG_TRIVIAL(error) << "asyncPlugins: no plugin named " << name;
+    }
+  }
+
+  long connections_per_host = config->upload_connections_per_host > 0 ? config->upload_connections_per_host : 1;
+  upload_engine = new Upload_Engine(connections_per_host, std::max(connections_per_host, MAX_UPLOAD_CONNECTIONS));
+  upload_engine->start();
+  config->upload_engine = upload_engine;
+
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     int ret = plugin->api->init(config, sources, systems);
@@ -86,6 +160,20 @@ void add_internal_plugin(std::string name, std::string library, json config_data
   plugin->api->parse_config(config_data);
 }
 
+// Gives the tap a ring for each running plugin that wants audio, starting the plugin's audio thread if it has none yet
+void add_audio_consumers(Audio_Tap *tap) {
+  for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
+    Plugin *plugin = *it;
+    if ((plugin->state == PLUGIN_RUNNING) && plugin->api->wants_audio()) {
+      if (!plugin->audio) {
+        plugin->audio = new Audio_Consumer(plugin->name, plugin->api);
+        plugin->audio->start();
+      }
+      plugin->audio->add_tap(tap);
+    }
+  }
+}
+
 void start_plugins(std::vector<Source *> sources, std::vector<System *> systems) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
@@ -109,12 +197,33 @@ void start_plugins(std::vector<Source *> sources, std::vector<System *> systems)
     if (plugin->state == PLUGIN_RUNNING) {
       plugin->api->setup_systems(systems);
     }
+
+    /* ----- Plugin Event Queue ----- */
+    if ((plugin->state == PLUGIN_RUNNING) && plugin->async) {
+      BOOST_LOG_TRIVIAL(info) << "Plugin: " << plugin->name << " - events are queued, Queue Size: " << plugin->queue_size << " Overflow: " << Plugin_Event_Queue::format_overflow(plugin->overflow);
+      plugin->queue = new Plugin_Event_Queue(plugin->name, plugin->api, plugin->queue_size, plugin->overflow);
+      plugin->queue->start();
+    }
+  }
+
+  plugins_started = true;
+  for (std::vector<Audio_Tap *>::iterator it = audio_taps.begin(); it != audio_taps.end(); it++) {
+    add_audio_consumers(*it);
   }
 }
 
 void stop_plugins() {
+  for (std::vector<Voice_Codec_Batch *>::iterator it = voice_codec_batches.begin(); it != voice_codec_batches.end(); it++) {
+    (*it)->flush();
+  }
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
+    if (plugin->audio) {
+      plugin->audio->stop();
+    }
+    if (plugin->queue) {
+      plugin->queue->stop();
+    }
     if (plugin->state == PLUGIN_RUNNING) {
       int err = plugin->api->stop();
       if (err != 0) {
@@ -124,24 +233,145 @@ void stop_plugins() {
     }
     plugin->state = PLUGIN_STOPPED;
   }
+
+  // Any upload still going fails, so the call concluder can give up on it
+  if (upload_engine) {
+    upload_engine->stop();
+  }
+
+  // Every queue has been drained and the audio threads are stopped
+  for (std::vector<Retired_Call>::iterator it = retired_calls.begin(); it != retired_calls.end(); it++) {
+    delete it->call;
+  }
+  retired_calls.clear();
+  for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
+    Plugin *plugin = *it;
+    delete plugin->queue;
+    plugin->queue = NULL;
+    delete plugin->audio;
+    plugin->audio = NULL;
+  }
+}
+
+void release_retired_calls() {
+  for (std::vector<Retired_Call>::iterator it = retired_calls.begin(); it != retired_calls.end();) {
+    bool released = true;
+    for (size_t i = 0; i < plugins.size(); i++) {
+      if (it->fence[i] && plugins[i]->queue && (plugins[i]->queue->oldest_pending() <= it->fence[i])) {
+        released = false;
+        break;
+      }
+    }
+    for (size_t i = 0; released && (i < it->audio_fence.size()); i++) {
+      if (it->audio_fence[i].first->popped() < it->audio_fence[i].second) {
+        released = false;
+      }
+    }
+    if (released) {
+      delete it->call;
+      it = retired_calls.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void plugman_retire_call(Call *call) {
+  Retired_Call retired;
+  bool queued = false;
+  retired.call = call;
+  // Frames the recorder decoded just as it was stopped, so they are fenced below like any other event
+  for (std::vector<Voice_Codec_Batch *>::iterator it = voice_codec_batches.begin(); it != voice_codec_batches.end(); it++) {
+    (*it)->flush_call(call);
+  }
+  for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
+    Plugin *plugin = *it;
+    uint64_t pushed = plugin->queue ? plugin->queue->get_pushed() : 0;
+    if (pushed) {
+      queued = true;
+    }
+    retired.fence.push_back(pushed);
+  }
+  for (std::vector<Audio_Tap *>::iterator it = audio_taps.begin(); it != audio_taps.end(); it++) {
+    const std::vector<audio_tap_ring *> &rings = (*it)->get_rings();
+    for (size_t i = 0; i < rings.size(); i++) {
+      size_t pushed = rings[i]->pushed();
+      if (rings[i]->popped() < pushed) {
+        retired.audio_fence.push_back(std::make_pair(rings[i], pushed));
+        queued = true;
+      }
+    }
+  }
+
+  if (queued) {
+    retired_calls.push_back(retired);
+  } else {
+    delete call;
+  }
 }
 
 void plugman_poll_one() {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->poll_one();
+      if (plugin->queue) {
+        plugin->queue->request_poll();
+      } else {
+        plugin->api->poll_one();
+      }
+    }
+  }
+  if (!voice_codec_batches.empty()) {
+    std::int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    for (std::vector<Voice_Codec_Batch *>::iterator it = voice_codec_batches.begin(); it != voice_codec_batches.end(); it++) {
+      (*it)->flush_stale(now_ms);
     }
   }
+  if (!retired_calls.empty()) {
+    release_retired_calls();
+  }
 }
 
-void plugman_audio_callback(Call *call, Recorder *recorder, int16_t *samples, int sampleCount) {
+void plugman_print_status() {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
-    if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->audio_stream(call, recorder, samples, sampleCount);
+    if (plugin->queue) {
+      Plugin_Queue_Stats stats = plugin->queue->get_stats(true);
+      double handler_avg_ms = stats.handled ? stats.handler_total_ms / stats.handled : 0;
+      BOOST_LOG_TRIVIAL(info) << "Plugin: " << plugin->name << "\tEvent Queue - Depth: " << stats.depth << "/" << stats.capacity << " High Water: " << stats.high_water << " Handled: " << stats.handled << " Dropped: " << stats.dropped << " Coalesced: " << stats.coalesced;
+      BOOST_LOG_TRIVIAL(info) << "Plugin: " << plugin->name << "\tHandler Avg: " << std::fixed << std::setprecision(2) << handler_avg_ms << "ms Max: " << stats.handler_max_ms << "ms Queue Wait Max: " << stats.wait_max_ms << "ms";
+    }
+  }
+  for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
+    Plugin *plugin = *it;
+    if (plugin->audio) {
+      Audio_Consumer_Stats stats = plugin->audio->get_stats();
+      BOOST_LOG_TRIVIAL(info) << "Plugin: " << plugin->name << "\tAudio Tap - Delivered: " << stats.delivered << " samples Dropped: " << stats.dropped << " samples High Water: " << stats.high_water << "/" << stats.capacity;
     }
   }
+  if (upload_engine) {
+    Upload_Engine_Stats stats = upload_engine->get_stats();
+    BOOST_LOG_TRIVIAL(info) << "Uploads - Queued: " << stats.queued << " Active: " << stats.active << " Completed: " << stats.completed << " Failed: " << stats.failed << " Connections Opened: " << stats.connections;
+  }
+  if (!retired_calls.empty()) {
+    BOOST_LOG_TRIVIAL(info) << "Calls waiting on queued plugin events: " << retired_calls.size();
+  }
+}
+
+Audio_Tap *plugman_audio_tap(Recorder *recorder) {
+  Audio_Tap *tap = new Audio_Tap(recorder);
+  audio_taps.push_back(tap);
+  if (plugins_started) {
+    add_audio_consumers(tap);
+  }
+  return tap;
+}
+
+// Called from the plugin sink's thread. The audio is copied once into a pooled
+// frame, which goes into a ring for each plugin and is handed to audio_frame
+// from the plugin's audio thread.
+void plugman_audio_callback(Audio_Tap *tap, Call *call, int16_t *samples, int sampleCount) {
+  tap->push(call, samples, sampleCount);
 }
 
 int plugman_signal(long unitId, const char *signaling_type, gr::blocks::SignalType sig_type, Call *call, System *system, Recorder *recorder) {
@@ -149,34 +379,65 @@ int plugman_signal(long unitId, const char *signaling_type, gr::blocks::SignalTy
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->signal(unitId, signaling_type, sig_type, call, system, recorder);
+      if (plugin->queue) {
+        bool has_type = (signaling_type != NULL);
+        std::string type = has_type ? signaling_type : "";
+        plugin->queue->push([=](Plugin_Api *api) { api->signal(unitId, has_type ? type.c_str() : NULL, sig_type, call, system, recorder); });
+      } else {
+        plugin->api->signal(unitId, signaling_type, sig_type, call, system, recorder);
+      }
     }
   }
   return error;
 }
 
-int plugman_trunk_message(std::vector<TrunkMessage> messages, System *system) {
+int plugman_trunk_message(const std::vector<TrunkMessage> &messages, System *system) {
   int error = 0;
+  if (messages.empty()) {
+    return error;
+  }
+  // The vector is reused once this returns, so queued plugins share a copy
+  std::shared_ptr<const std::vector<TrunkMessage>> queued_messages;
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->trunk_message(messages, system);
+      if (plugin->queue) {
+        if (!queued_messages) {
+          queued_messages = std::make_shared<const std::vector<TrunkMessage>>(messages);
+        }
+        plugin->queue->push([queued_messages, system](Plugin_Api *api) { api->trunk_message(*queued_messages, system); });
+      } else {
+        plugin->api->trunk_message(messages, system);
+      }
     }
   }
   return error;
 }
 
+bool plugman_trunk_message_meta() {
+  for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
+    Plugin *plugin = *it;
+    if ((plugin->state == PLUGIN_RUNNING) && plugin->api->trunk_message_meta()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 int plugman_call_start(Call *call) {
   int error = 0;
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->call_start(call);
+      dispatch(plugin, [call](Plugin_Api *api) { api->call_start(call); });
     }
   }
   return error;
 }
 
+// call_end is not queued for async plugins. Its result decides the retries,
+// and it already runs on the call concluder's worker threads. It waits instead
+// for what was queued before it, so the plugin sees the call's events in order.
 int plugman_call_end(Call_Data_t& call_info) {
   std::vector<int> plugin_retry_list;
   
@@ -190,6 +451,14 @@ int plugman_call_end(Call_Data_t& call_info) {
     for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
       Plugin *plugin = *it;
       if (plugin->state == PLUGIN_RUNNING) {
+        // The call's audio reaches the plugin before its call_end
+        if (plugin->audio && !plugin->audio->drain_recorder(call_info.recorder_num, AUDIO_TAP_DRAIN_MS)) {
+          BOOST_LOG_TRIVIAL(debug) << loghdr << "Plugin Manager: call_end - " << plugin->name << " is still behind on the call's audio";
+        }
+        // and so do the events queued for it so far, such as its last codec frames
+        if (plugin->queue && !plugin->queue->wait_handled(plugin->queue->get_pushed(), PLUGIN_QUEUE_DRAIN_MS)) {
+          BOOST_LOG_TRIVIAL(debug) << loghdr << "Plugin Manager: call_end - " << plugin->name << " is still behind on its queued events";
+        }
         int plugin_error = plugin->api->call_end(call_info);
         if (plugin_error) {
           BOOST_LOG_TRIVIAL(error) << loghdr << "Plugin Manager: call_end -  " << plugin->name << " failed.";
@@ -228,7 +497,7 @@ int plugman_calls_active(std::vector<Call *> calls) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->calls_active(calls);
+      dispatch(plugin, [calls](Plugin_Api *api) { api->calls_active(calls); }, EVENT_CALLS_ACTIVE);
     }
   }
   return error;
@@ -238,7 +507,7 @@ void plugman_setup_recorder(Recorder *recorder) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->setup_recorder(recorder);
+      dispatch(plugin, [recorder](Plugin_Api *api) { api->setup_recorder(recorder); }, EVENT_SETUP_RECORDER, recorder);
     }
   }
 }
@@ -247,7 +516,7 @@ void plugman_setup_system(System *system) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->setup_system(system);
+      dispatch(plugin, [system](Plugin_Api *api) { api->setup_system(system); }, EVENT_SETUP_SYSTEM, system);
     }
   }
 }
@@ -256,7 +525,7 @@ void plugman_setup_systems(std::vector<System *> systems) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->setup_systems(systems);
+      dispatch(plugin, [systems](Plugin_Api *api) { api->setup_systems(systems); });
     }
   }
 }
@@ -265,7 +534,7 @@ void plugman_setup_sources(std::vector<Source *> sources) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->setup_sources(sources);
+      dispatch(plugin, [sources](Plugin_Api *api) { api->setup_sources(sources); });
     }
   }
 }
@@ -274,7 +543,7 @@ void plugman_setup_config(std::vector<Source *> sources, std::vector<System *> s
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->setup_config(sources, systems);
+      dispatch(plugin, [sources, systems](Plugin_Api *api) { api->setup_config(sources, systems); }, EVENT_SETUP_CONFIG);
     }
   }
 }
@@ -283,7 +552,7 @@ void plugman_system_rates(std::vector<System *> systems, float timeDiff) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->system_rates(systems, timeDiff);
+      dispatch(plugin, [systems, timeDiff](Plugin_Api *api) { api->system_rates(systems, timeDiff); }, EVENT_SYSTEM_RATES);
     }
   }
 }
@@ -292,7 +561,7 @@ void plugman_unit_registration(System *system, long source_id) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->unit_registration(system, source_id);
+      dispatch(plugin, [system, source_id](Plugin_Api *api) { api->unit_registration(system, source_id); });
     }
   }
 }
@@ -300,7 +569,7 @@ void plugman_unit_deregistration(System *system, long source_id) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->unit_deregistration(system, source_id);
+      dispatch(plugin, [system, source_id](Plugin_Api *api) { api->unit_deregistration(system, source_id); });
     }
   }
 }
@@ -308,7 +577,7 @@ void plugman_unit_acknowledge_response(System *system, long source_id) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->unit_acknowledge_response(system, source_id);
+      dispatch(plugin, [system, source_id](Plugin_Api *api) { api->unit_acknowledge_response(system, source_id); });
     }
   }
 }
@@ -316,7 +585,7 @@ void plugman_unit_group_affiliation(System *system, long source_id, long talkgro
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->unit_group_affiliation(system, source_id, talkgroup_num);
+      dispatch(plugin, [system, source_id, talkgroup_num](Plugin_Api *api) { api->unit_group_affiliation(system, source_id, talkgroup_num); });
     }
   }
 }
@@ -324,7 +593,7 @@ void plugman_unit_data_grant(System *system, long source_id) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->unit_data_grant(system, source_id);
+      dispatch(plugin, [system, source_id](Plugin_Api *api) { api->unit_data_grant(system, source_id); });
     }
   }
 }
@@ -332,7 +601,7 @@ void plugman_unit_answer_request(System *system, long source_id, long talkgroup)
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->unit_answer_request(system, source_id, talkgroup);
+      dispatch(plugin, [system, source_id, talkgroup](Plugin_Api *api) { api->unit_answer_request(system, source_id, talkgroup); });
     }
   }
 }
@@ -340,16 +609,42 @@ void plugman_unit_location(System *system, long source_id, long talkgroup_num) {
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->unit_location(system, source_id, talkgroup_num);
+      dispatch(plugin, [system, source_id, talkgroup_num](Plugin_Api *api) { api->unit_location(system, source_id, talkgroup_num); });
     }
   }
 }
 
-void plugman_voice_codec_data(Call *call, int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs) {
+// Called with a full batch from the recorder's thread, or from the main thread
+// for one that has been held too long or whose recorder has stopped
+static void deliver_voice_codec_batch(Call *call, const Voice_Codec_Frame *frames, int frame_count) {
+  std::shared_ptr<const std::vector<Voice_Codec_Frame>> queued_frames;
   for (std::vector<Plugin *>::iterator it = plugins.begin(); it != plugins.end(); it++) {
     Plugin *plugin = *it;
     if (plugin->state == PLUGIN_RUNNING) {
-      plugin->api->voice_codec_data(call, codec_type, tgid, src_id, params, param_count, errs);
+      if (plugin->queue) {
+        if (!queued_frames) {
+          queued_frames = std::make_shared<const std::vector<Voice_Codec_Frame>>(frames, frames + frame_count);
+        }
+        plugin->queue->push([=](Plugin_Api *api) { api->voice_codec_batch(call, queued_frames->data(), frame_count); });
+      } else {
+        plugin->api->voice_codec_batch(call, frames, frame_count);
+      }
     }
   }
 }
+
+Voice_Codec_Batch *plugman_voice_codec_batch() {
+  Voice_Codec_Batch *batch = new Voice_Codec_Batch(deliver_voice_codec_batch);
+  voice_codec_batches.push_back(batch);
+  return batch;
+}
+
+// Called from the recorder's thread for every frame. The plugins get the frames a batch at a time.
+void plugman_voice_codec_data(Voice_Codec_Batch *batch, Call *call, int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted) {
+  batch->add(call, codec_type, tgid, src_id, params, param_count, errs, e0, e1, encrypted);
+}
+
+// Called when the recorder stops, so the last frames of the call go out before it ends
+void plugman_voice_codec_flush(Voice_Codec_Batch *batch) {
+  batch->flush();
+}
@@ -7,7 +7,10 @@
 #include "../systems/system.h"
 #include "../systems/system_impl.h"
 
+#include "audio_tap.h"
 #include "plugin_api.h"
+#include "plugin_event_queue.h"
+#include "voice_codec_batch.h"
 #if GNURADIO_VERSION >= 0x030a00
 #include <boost/function.hpp>
 #endif
@@ -23,6 +26,11 @@ struct Plugin {
   boost::shared_ptr<Plugin_Api> api;
   plugin_state_t state;
   std::string name;
+  bool async;
+  size_t queue_size;
+  plugin_overflow_t overflow;
+  Plugin_Event_Queue *queue; // set while an async plugin is running
+  Audio_Consumer *audio;     // set while audio is being streamed
 };
 
 void initialize_plugins(json config_data, Config *config, std::vector<Source *> sources, std::vector<System *> systems);
@@ -31,9 +39,13 @@ void start_plugins(std::vector<Source *> sources, std::vector<System *> systems)
 void stop_plugins();
 
 void plugman_poll_one();
-void plugman_audio_callback(Call *call, Recorder *recorder, int16_t *samples, int sampleCount);
+void plugman_print_status();
+void plugman_retire_call(Call *call);
+Audio_Tap *plugman_audio_tap(Recorder *recorder);
+void plugman_audio_callback(Audio_Tap *tap, Call *call, int16_t *samples, int sampleCount);
 int plugman_signal(long unitId, const char *signaling_type, gr::blocks::SignalType sig_type, Call *call, System *system, Recorder *recorder);
-int plugman_trunk_message(std::vector<TrunkMessage> messages, System *system);
+int plugman_trunk_message(const std::vector<TrunkMessage> &messages, System *system);
+bool plugman_trunk_message_meta();
 int plugman_call_start(Call *call);
 int plugman_call_end(Call_Data_t& call_info);
 int plugman_calls_active(std::vector<Call *> calls);
@@ -50,5 +62,7 @@ void plugman_unit_group_affiliation(System *system, long source_id, long talkgro
 void plugman_unit_data_grant(System *system, long source_id);
 void plugman_unit_answer_request(System *system, long source_id, long talkgroup);
 void plugman_unit_location(System *system, long source_id, long talkgroup_num);
-void plugman_voice_codec_data(Call *call, int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs);
+Voice_Codec_Batch *plugman_voice_codec_batch();
+void plugman_voice_codec_data(Voice_Codec_Batch *batch, Call *call, int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted);
+void plugman_voice_codec_flush(Voice_Codec_Batch *batch);
 #endif // PLUGIN_MANAGER_H
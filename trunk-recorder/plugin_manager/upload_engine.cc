@@ -0,0 +1,257 @@
+#include "upload_engine.h"
+
+#include <boost/log/trivial.hpp>
+
+// How long the loop sleeps when nothing is happening; submit() wakes it sooner
+static const int UPLOAD_POLL_MS = 1000;
+
+Upload_Request::Upload_Request()
+    : mime(NULL),
+      headers(NULL),
+      upload_file(NULL) {
+  result.code = CURLE_OK;
+  result.response_code = 0;
+  handle = curl_easy_init();
+  if (handle) {
+    curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA, &result.response);
+    curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+    // Wait for a connection that can be multiplexed rather than open another one
+    curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+    curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+  }
+}
+
+Upload_Request::~Upload_Request() {
+  if (handle) {
+    curl_easy_cleanup(handle);
+  }
+  if (mime) {
+    curl_mime_free(mime);
+  }
+  if (headers) {
+    curl_slist_free_all(headers);
+  }
+  if (upload_file) {
+    fclose(upload_file);
+  }
+}
+
+size_t Upload_Request::write_callback(void *contents, size_t size, size_t nmemb, void *userp) {
+  ((std::string *)userp)->append((char *)contents, size * nmemb);
+  return size * nmemb;
+}
+
+Upload_Engine::Upload_Engine(long max_host_connections, long max_connections)
+    : d_running(false),
+      d_stopping(false),
+      d_completed(0),
+      d_failed(0),
+      d_connections(0),
+      d_active_count(0) {
+  curl_global_init(CURL_GLOBAL_ALL);
+  d_multi = curl_multi_init();
+  curl_multi_setopt(d_multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+  curl_multi_setopt(d_multi, CURLMOPT_MAX_HOST_CONNECTIONS, max_host_connections);
+  curl_multi_setopt(d_multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, max_connections);
+  // Keep an idle connection to every server the plugins talk to
+  curl_multi_setopt(d_multi, CURLMOPT_MAXCONNECTS, max_connections);
+}
+
+Upload_Engine::~Upload_Engine() {
+  stop();
+  curl_multi_cleanup(d_multi);
+}
+
+void Upload_Engine::start() {
+  std::lock_guard<std::mutex> lock(d_mutex);
+  if (!d_running && !d_stopping) {
+    d_running = true;
+    d_worker = std::thread(&Upload_Engine::run, this);
+  }
+}
+
+void Upload_Engine::stop() {
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_stopping = true;
+  }
+#if LIBCURL_VERSION_NUM >= 0x074400
+  curl_multi_wakeup(d_multi);
+#endif
+  if (d_worker.joinable()) {
+    d_worker.join();
+  }
+
+  // Anything submitted before start() that never ran
+  std::deque<Transfer *> left;
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    left.swap(d_incoming);
+  }
+  for (std::deque<Transfer *>::iterator it = left.begin(); it != left.end(); ++it) {
+    finish(*it, CURLE_ABORTED_BY_CALLBACK);
+  }
+}
+
+void Upload_Engine::submit(Upload_Request *request, callback_t callback) {
+  Transfer *transfer = new Transfer();
+  transfer->request = request;
+  transfer->callback = callback;
+  transfer->owned = true;
+  queue(transfer);
+}
+
+const Upload_Result &Upload_Engine::perform(Upload_Request *request) {
+  std::mutex done_mutex;
+  std::condition_variable done_cond;
+  bool done = false;
+
+  Transfer *transfer = new Transfer();
+  transfer->request = request;
+  transfer->owned = false;
+  transfer->callback = [&done_mutex, &done_cond, &done](Upload_Request *) {
+    std::lock_guard<std::mutex> lock(done_mutex);
+    done = true;
+    // Notified with the lock held, as the waiter's stack goes away as soon as it sees done
+    done_cond.notify_all();
+  };
+  queue(transfer);
+
+  std::unique_lock<std::mutex> lock(done_mutex);
+  done_cond.wait(lock, [&done] { return done; });
+  return request->result;
+}
+
+Upload_Engine_Stats Upload_Engine::get_stats() {
+  std::lock_guard<std::mutex> lock(d_mutex);
+  Upload_Engine_Stats stats;
+  stats.queued = d_incoming.size();
+  stats.active = d_active_count;
+  stats.completed = d_completed;
+  stats.failed = d_failed;
+  stats.connections = d_connections;
+  return stats;
+}
+
+void Upload_Engine::queue(Transfer *transfer) {
+  if (!transfer->request->handle) {
+    finish(transfer, CURLE_FAILED_INIT);
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (!d_stopping) {
+      d_incoming.push_back(transfer);
+      transfer = NULL;
+    }
+  }
+  if (transfer) {
+    finish(transfer, CURLE_ABORTED_BY_CALLBACK);
+    return;
+  }
+#if LIBCURL_VERSION_NUM >= 0x074400
+  curl_multi_wakeup(d_multi);
+#endif
+}
+
+// Fills in the result and hands the request back. Called on the engine's
+// thread, or on the caller's when the request never got to the engine.
+void Upload_Engine::finish(Transfer *transfer, CURLcode code) {
+  Upload_Request *request = transfer->request;
+  request->result.code = code;
+  request->result.response_code = 0;
+  long connects = 0;
+  if (request->handle) {
+    curl_easy_getinfo(request->handle, CURLINFO_RESPONSE_CODE, &request->result.response_code);
+    curl_easy_getinfo(request->handle, CURLINFO_NUM_CONNECTS, &connects);
+  }
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (code == CURLE_OK) {
+      d_completed++;
+    } else {
+      d_failed++;
+    }
+    d_connections += connects;
+  }
+
+  if (transfer->callback) {
+    transfer->callback(request);
+  }
+  if (transfer->owned) {
+    delete request;
+  }
+  delete transfer;
+}
+
+void Upload_Engine::run() {
+  while (true) {
+    std::deque<Transfer *> incoming;
+    bool stopping;
+    {
+      std::lock_guard<std::mutex> lock(d_mutex);
+      incoming.swap(d_incoming);
+      stopping = d_stopping;
+    }
+
+    for (std::deque<Transfer *>::iterator it = incoming.begin(); it != incoming.end(); ++it) {
+      Transfer *transfer = *it;
+      curl_easy_setopt(transfer->request->handle, CURLOPT_PRIVATE, transfer);
+      CURLMcode mcode = curl_multi_add_handle(d_multi, transfer->request->handle);
+      if (mcode != CURLM_OK) {
+        BOOST_LOG_TRIVIAL(error) << "Upload Engine: unable to add transfer: " << curl_multi_strerror(mcode);
+        finish(transfer, CURLE_FAILED_INIT);
+      } else {
+        d_active.insert(transfer);
+      }
+    }
+
+    if (stopping) {
+      // Whoever is waiting on these gets a failure rather than waiting forever
+      for (std::set<Transfer *>::iterator it = d_active.begin(); it != d_active.end(); ++it) {
+        curl_multi_remove_handle(d_multi, (*it)->request->handle);
+        finish(*it, CURLE_ABORTED_BY_CALLBACK);
+      }
+      if (!d_active.empty()) {
+        BOOST_LOG_TRIVIAL(info) << "Upload Engine: aborted " << d_active.size() << " uploads on shutdown";
+      }
+      d_active.clear();
+      std::lock_guard<std::mutex> lock(d_mutex);
+      d_active_count = 0;
+      break;
+    }
+
+    int still_running = 0;
+    curl_multi_perform(d_multi, &still_running);
+
+    CURLMsg *msg;
+    int msgs_left = 0;
+    while ((msg = curl_multi_info_read(d_multi, &msgs_left))) {
+      if (msg->msg != CURLMSG_DONE) {
+        continue;
+      }
+      Transfer *transfer = NULL;
+      CURLcode code = msg->data.result;
+      curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char **)&transfer);
+      curl_multi_remove_handle(d_multi, msg->easy_handle);
+      d_active.erase(transfer);
+      finish(transfer, code);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(d_mutex);
+      d_active_count = d_active.size();
+      if (!d_incoming.empty() || d_stopping) {
+        continue;
+      }
+    }
+
+#if LIBCURL_VERSION_NUM >= 0x074400
+    curl_multi_poll(d_multi, NULL, 0, UPLOAD_POLL_MS, NULL);
+#else
+    // Without curl_multi_wakeup() new requests wait for the next timeout
+    curl_multi_wait(d_multi, NULL, 0, d_active.empty() ? 100 : 10, NULL);
+#endif
+  }
+}
@@ -0,0 +1,100 @@
+#ifndef UPLOAD_ENGINE_H
+#define UPLOAD_ENGINE_H
+
+#include <curl/curl.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <stdio.h>
+#include <string>
+#include <thread>
+
+struct Upload_Result {
+  CURLcode code;        // how the transfer itself went
+  long response_code;   // the HTTP status, 0 if there was no response
+  std::string response; // the body of the response
+};
+
+// One HTTP request for the Upload_Engine. Set it up with curl_easy_setopt() on
+// handle, as for curl_easy_perform(), but leave the write callback alone; the
+// response ends up in result. The mime, headers and upload file a request uses
+// must outlive the transfer, so they are handed to the request to free.
+class Upload_Request {
+public:
+  Upload_Request();
+  ~Upload_Request();
+
+  CURL *handle;
+  curl_mime *mime;
+  struct curl_slist *headers;
+  FILE *upload_file;
+  Upload_Result result;
+
+private:
+  static size_t write_callback(void *contents, size_t size, size_t nmemb, void *userp);
+};
+
+struct Upload_Engine_Stats {
+  size_t queued;
+  size_t active;
+  unsigned long completed;
+  unsigned long failed;      // transfer errors, not HTTP errors
+  unsigned long connections; // new connections made; the rest of the transfers reused one
+};
+
+// Runs the uploads for every plugin on one curl_multi handle and one thread.
+// Connections and DNS lookups are kept between requests, HTTP/2 requests to
+// the same server are multiplexed over one connection, and the connections to
+// each server are capped, with the requests over the cap waiting their turn.
+//
+// Plugins get the engine from Config::upload_engine. Its methods are virtual
+// so plugin libraries call into the one instance rather than a copy of their own.
+class Upload_Engine {
+public:
+  typedef std::function<void(Upload_Request *request)> callback_t;
+
+  Upload_Engine(long max_host_connections, long max_connections);
+  virtual ~Upload_Engine();
+
+  virtual void start();
+  // Aborts whatever has not finished. Requests submitted afterwards fail straight away.
+  virtual void stop();
+
+  // Takes the request and calls back once it is done, then deletes it. The
+  // callback runs on the engine's thread, so it must not block.
+  virtual void submit(Upload_Request *request, callback_t callback);
+  // Runs the request and waits for it to finish. The caller keeps the request.
+  virtual const Upload_Result &perform(Upload_Request *request);
+
+  virtual Upload_Engine_Stats get_stats();
+
+private:
+  struct Transfer {
+    Upload_Request *request;
+    callback_t callback;
+    bool owned;
+  };
+
+  void queue(Transfer *transfer);
+  void finish(Transfer *transfer, CURLcode code);
+  void run();
+
+  CURLM *d_multi;
+  std::thread d_worker;
+
+  std::mutex d_mutex;
+  std::deque<Transfer *> d_incoming;
+  bool d_running;
+  bool d_stopping;
+  unsigned long d_completed;
+  unsigned long d_failed;
+  unsigned long d_connections;
+
+  std::set<Transfer *> d_active; // only touched by the worker
+  size_t d_active_count;
+};
+
+#endif // UPLOAD_ENGINE_H
@@ -0,0 +1,74 @@
+#include "voice_codec_batch.h"
+
+#include <chrono>
+#include <string.h>
+
+Voice_Codec_Batch::Voice_Codec_Batch(deliver_t deliver)
+    : d_deliver(deliver),
+      d_call(NULL),
+      d_count(0) {
+}
+
+void Voice_Codec_Batch::add(Call *call, int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted) {
+  std::int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+  if (param_count > VOICE_CODEC_MAX_PARAMS) {
+    param_count = VOICE_CODEC_MAX_PARAMS;
+  } else if (param_count < 0) {
+    param_count = 0;
+  }
+
+  std::unique_lock<std::mutex> lock(d_mutex);
+  if ((d_count > 0) && (d_call != call)) {
+    deliver(lock);
+    lock.lock();
+  }
+  d_call = call;
+  Voice_Codec_Frame &frame = d_frames[d_count++];
+  frame.time_ms = now_ms;
+  frame.codec_type = codec_type;
+  frame.tgid = tgid;
+  frame.src_id = src_id;
+  frame.errs = errs;
+  frame.e0 = e0;
+  frame.e1 = e1;
+  frame.encrypted = encrypted;
+  frame.param_count = param_count;
+  memcpy(frame.params, params, param_count * sizeof(uint32_t));
+  if (d_count == VOICE_CODEC_BATCH_FRAMES) {
+    deliver(lock);
+  }
+}
+
+void Voice_Codec_Batch::flush() {
+  std::unique_lock<std::mutex> lock(d_mutex);
+  if (d_count > 0) {
+    deliver(lock);
+  }
+}
+
+void Voice_Codec_Batch::flush_call(Call *call) {
+  std::unique_lock<std::mutex> lock(d_mutex);
+  if ((d_count > 0) && (d_call == call)) {
+    deliver(lock);
+  }
+}
+
+void Voice_Codec_Batch::flush_stale(std::int64_t now_ms) {
+  std::unique_lock<std::mutex> lock(d_mutex);
+  if ((d_count > 0) && (now_ms - d_frames[0].time_ms >= VOICE_CODEC_BATCH_MS)) {
+    deliver(lock);
+  }
+}
+
+void Voice_Codec_Batch::deliver(std::unique_lock<std::mutex> &lock) {
+  // Only waits if the batch before this one is still being delivered
+  std::lock_guard<std::mutex> deliver_lock(d_deliver_mutex);
+  Call *call = d_call;
+  int count = d_count;
+  memcpy(d_delivering, d_frames, count * sizeof(Voice_Codec_Frame));
+  d_count = 0;
+  d_call = NULL;
+  lock.unlock();
+
+  d_deliver(call, d_delivering, count);
+}
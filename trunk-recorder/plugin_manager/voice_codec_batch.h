@@ -0,0 +1,50 @@
+#ifndef VOICE_CODEC_BATCH_H
+#define VOICE_CODEC_BATCH_H
+
+#include "plugin_api.h"
+
+#include <cstdint>
+#include <mutex>
+
+static const int VOICE_CODEC_BATCH_FRAMES = 9;  // a P25 superframe, 180 ms of voice
+static const int VOICE_CODEC_BATCH_MS = 180;    // how long a partly full batch is held
+
+// Collects the voice codec frames from one recorder and hands them to the
+// plugins a batch at a time, from a buffer that is reused for every batch. A
+// batch goes out when it is full, when the frames switch to another call, when
+// the recorder stops and when its first frame has waited VOICE_CODEC_BATCH_MS.
+// The recorder's thread adds the frames; the main loop flushes batches that
+// have waited too long, so the buffer is guarded by a mutex. A batch is copied
+// to a second buffer and delivered after the mutex is let go, so a slow plugin
+// does not hold up the recorder adding the next frames. The second buffer has
+// its own mutex, taken before the first is let go, which keeps the batches in
+// order.
+class Voice_Codec_Batch {
+public:
+  typedef void (*deliver_t)(Call *call, const Voice_Codec_Frame *frames, int frame_count);
+
+  explicit Voice_Codec_Batch(deliver_t deliver);
+
+  // Called from the recorder's thread
+  void add(Call *call, int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted);
+
+  void flush();
+  // Flushes the frames if they are from call
+  void flush_call(Call *call);
+  // Flushes the frames if the first of them is older than VOICE_CODEC_BATCH_MS
+  void flush_stale(std::int64_t now_ms);
+
+private:
+  // Called with d_mutex held by lock, which it unlocks
+  void deliver(std::unique_lock<std::mutex> &lock);
+
+  deliver_t d_deliver;
+  std::mutex d_mutex;
+  Call *d_call;
+  int d_count;
+  Voice_Codec_Frame d_frames[VOICE_CODEC_BATCH_FRAMES];
+  std::mutex d_deliver_mutex;
+  Voice_Codec_Frame d_delivering[VOICE_CODEC_BATCH_FRAMES];
+};
+
+#endif // VOICE_CODEC_BATCH_H
@@ -108,6 +108,7 @@ analog_recorder::analog_recorder(Source *src, System *system, Recorder_Type type
   starttime = time(NULL);
 
   bool use_streaming = false;
+  audio_tap = NULL;
 
   if (tone_freq > 0) {
     use_tone_squelch = true;
@@ -172,6 +173,7 @@ analog_recorder::analog_recorder(Source *src, System *system, Recorder_Type type
 
   if (use_streaming) {
     BOOST_LOG_TRIVIAL(info) << "\t Creating plugin sink..." << std::endl;
+    audio_tap = plugman_audio_tap(this);
     plugin_sink = gr::blocks::plugin_wrapper_impl::make(std::bind(&analog_recorder::plugin_callback_handler, this, std::placeholders::_1, std::placeholders::_2));
     BOOST_LOG_TRIVIAL(info) << "\t Plugin sink created!" << std::endl;
   }
@@ -247,6 +249,7 @@ void analog_recorder::stop() {
     state = INACTIVE;
     set_enabled(false);
     wav_sink->stop_recording();
+    source->release_recorder(this);
   } else {
 
     BOOST_LOG_TRIVIAL(error) << "analog_recorder.cc: Stopping an inactive Logger \t[ " << rec_num << " ] - freq[ " << format_freq(chan_freq) << "] \t talkgroup[ " << talkgroup << " ]";
@@ -350,7 +353,7 @@ void analog_recorder::decoder_callback_handler(long unitId, const char *signalin
 }
 
 void analog_recorder::plugin_callback_handler(int16_t *samples, int sampleCount) {
-  plugman_audio_callback(call, this, samples, sampleCount);
+  plugman_audio_callback(audio_tap, call, samples, sampleCount);
 }
 
 void analog_recorder::setup_decoders_for_system(System *system) {
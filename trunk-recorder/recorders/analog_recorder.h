@@ -44,6 +44,7 @@
 
 class Source;
 class analog_recorder;
+class Audio_Tap;
 
 #include "../gr_blocks/channelizer.h"
 #include "../gr_blocks/decoder_wrapper.h"
@@ -161,6 +162,7 @@ private:
   gr::blocks::transmission_sink::sptr wav_sink;
   gr::blocks::decoder_wrapper::sptr decoder_sink;
   gr::blocks::plugin_wrapper::sptr plugin_sink;
+  Audio_Tap *audio_tap;
 
   void setup_decoders_for_system(System *system);
 };
@@ -100,10 +100,20 @@ void dmr_recorder_impl::initialize(Source *src) {
   int verbosity = 0; // 10 = lots of debug messages
 
   framer = gr::op25_repeater::frame_assembler::make("file:///tmp/out1.raw", verbosity, 1, rx_queue, d_soft_vocoder);
+  voice_codec_batch = plugman_voice_codec_batch();
   framer->set_voice_codec_callback(voice_codec_cb_handler, this);
+  if (config) {
+    framer->set_fast_vocoder(config->fast_vocoder);
+  }
+  // Streaming plugins need the audio as it happens, so they keep the vocoder in the flowgraph
+  if (config && config->deferred_vocoder && !use_streaming) {
+    framer->set_deferred_vocoder(true);
+  }
   levels = gr::blocks::multiply_const_ff::make(1);
-  plugin_sink_slot0 = gr::blocks::plugin_wrapper_impl::make(std::bind(&dmr_recorder_impl::plugin_callback_handler, this, std::placeholders::_1, std::placeholders::_2));
-  plugin_sink_slot1 = gr::blocks::plugin_wrapper_impl::make(std::bind(&dmr_recorder_impl::plugin_callback_handler, this, std::placeholders::_1, std::placeholders::_2));
+  audio_tap_slot0 = use_streaming ? plugman_audio_tap(this) : NULL;
+  audio_tap_slot1 = use_streaming ? plugman_audio_tap(this) : NULL;
+  plugin_sink_slot0 = gr::blocks::plugin_wrapper_impl::make(std::bind(&dmr_recorder_impl::plugin_callback_handler, this, audio_tap_slot0, std::placeholders::_1, std::placeholders::_2));
+  plugin_sink_slot1 = gr::blocks::plugin_wrapper_impl::make(std::bind(&dmr_recorder_impl::plugin_callback_handler, this, audio_tap_slot1, std::placeholders::_1, std::placeholders::_2));
 
   connect(self(), 0, prefilter, 0);
   connect(prefilter, 0, pll_freq_lock, 0);
@@ -122,14 +132,14 @@ void dmr_recorder_impl::initialize(Source *src) {
   }
 }
 
-void dmr_recorder_impl::plugin_callback_handler(int16_t *samples, int sampleCount) {
-  plugman_audio_callback(call, this, samples, sampleCount);
+void dmr_recorder_impl::plugin_callback_handler(Audio_Tap *tap, int16_t *samples, int sampleCount) {
+  plugman_audio_callback(tap, call, samples, sampleCount);
 }
 
-void dmr_recorder_impl::voice_codec_cb_handler(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, void *user_data) {
+void dmr_recorder_impl::voice_codec_cb_handler(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted, void *user_data) {
   dmr_recorder_impl *self = static_cast<dmr_recorder_impl *>(user_data);
   if (self->call) {
-    plugman_voice_codec_data(self->call, codec_type, tgid, src_id, params, param_count, errs);
+    plugman_voice_codec_data(self->voice_codec_batch, self->call, codec_type, tgid, src_id, params, param_count, errs, e0, e1, encrypted);
   }
 }
 
@@ -262,6 +272,7 @@ void dmr_recorder_impl::stop() {
     set_enabled(false);
     wav_sink_slot0->stop_recording();
     wav_sink_slot1->stop_recording();
+    plugman_voice_codec_flush(voice_codec_batch);
   } else {
     BOOST_LOG_TRIVIAL(error) << "dmr_recorder.cc: Trying to Stop an Inactive Logger!!!";
   }
@@ -83,6 +83,9 @@
 #include "dmr_recorder.h"
 #include "recorder.h"
 
+class Audio_Tap;
+class Voice_Codec_Batch;
+
 class dmr_recorder_impl : public dmr_recorder {
 
 protected:
@@ -114,8 +117,8 @@ public:
   long elapsed();
   Source *get_source();
 
-  void plugin_callback_handler(int16_t *samples, int sampleCount);
-  static void voice_codec_cb_handler(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, void *user_data);
+  void plugin_callback_handler(Audio_Tap *tap, int16_t *samples, int sampleCount);
+  static void voice_codec_cb_handler(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted, void *user_data);
 
 protected:
   State state;
@@ -174,6 +177,9 @@ private:
   gr::blocks::transmission_sink::sptr wav_sink_slot1;
   gr::blocks::plugin_wrapper::sptr plugin_sink_slot0;
   gr::blocks::plugin_wrapper::sptr plugin_sink_slot1;
+  Audio_Tap *audio_tap_slot0;
+  Audio_Tap *audio_tap_slot1;
+  Voice_Codec_Batch *voice_codec_batch;
 };
 
 #endif // ifndef dmr_recorder_H
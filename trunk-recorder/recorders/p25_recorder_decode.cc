@@ -7,9 +7,9 @@
 #include "../unit_tags_ota.h"
 #include <chrono>
 
-p25_recorder_decode_sptr make_p25_recorder_decode(Recorder *recorder, int silence_frames, bool d_soft_vocoder) {
+p25_recorder_decode_sptr make_p25_recorder_decode(Recorder *recorder, int silence_frames, bool d_soft_vocoder, bool deferred_vocoder, bool fast_vocoder) {
   p25_recorder_decode *decoder = new p25_recorder_decode(recorder);
-  decoder->initialize(silence_frames, d_soft_vocoder);
+  decoder->initialize(silence_frames, d_soft_vocoder, deferred_vocoder, fast_vocoder);
   return gnuradio::get_initial_sptr(decoder);
 }
 
@@ -18,6 +18,9 @@ p25_recorder_decode::p25_recorder_decode(Recorder *recorder)
                       gr::io_signature::make(1, 1, sizeof(float)),
                       gr::io_signature::make(0, 0, sizeof(float))) {
   d_recorder = recorder;
+  d_parked = false;
+  audio_tap = NULL;
+  voice_codec_batch = NULL;
 }
 
 p25_recorder_decode::~p25_recorder_decode() {
@@ -26,9 +29,32 @@ p25_recorder_decode::~p25_recorder_decode() {
 void p25_recorder_decode::stop() {
   wav_sink->stop_recording();
   d_call = NULL;
+  plugman_voice_codec_flush(voice_codec_batch);
+}
+
+void p25_recorder_decode::park() {
+  wav_sink->set_parked(true);
+  d_parked = true;
+}
+
+void p25_recorder_decode::unpark() {
+  wav_sink->set_parked(false);
+  d_parked = false;
+  flush_message_queue();
+}
+
+void p25_recorder_decode::flush_message_queue() {
+  // Anything decoded while parked belongs to whoever was talking before the grant
+  while (rx_queue->delete_head_nowait()) {
+  }
 }
 
 void p25_recorder_decode::start(Call *call) {
+  if (d_parked) {
+    // start_recording() below takes the sink out of the parked state
+    d_parked = false;
+    flush_message_queue();
+  }
   levels->set_k(call->get_system()->get_digital_levels());
 
   if(call->get_phase2_tdma()){
@@ -75,7 +101,7 @@ void p25_recorder_decode::switch_tdma(bool phase2_tdma) {
   op25_frame_assembler->set_phase2_tdma(phase2_tdma);
 }
 
-void p25_recorder_decode::initialize(int silence_frames, bool d_soft_vocoder) {
+void p25_recorder_decode::initialize(int silence_frames, bool d_soft_vocoder, bool deferred_vocoder, bool fast_vocoder) {
   // OP25 Slicer
   const float l[] = {-2.0, 0.0, 2.0, 4.0};
   std::vector<float> slices(l, l + sizeof(l) / sizeof(l[0]));
@@ -102,10 +128,17 @@ void p25_recorder_decode::initialize(int silence_frames, bool d_soft_vocoder) {
   bool do_nocrypt = 1;
 
   op25_frame_assembler = gr::op25_repeater::p25_frame_assembler::make(silence_frames, d_soft_vocoder, udp_host, udp_port, verbosity, do_imbe, do_output, do_msgq, rx_queue, do_audio_output, do_tdma, do_nocrypt);
+  voice_codec_batch = plugman_voice_codec_batch();
   op25_frame_assembler->set_voice_codec_callback(voice_codec_cb_handler, this);
+  op25_frame_assembler->set_fast_vocoder(fast_vocoder);
+  // Streaming plugins need the audio as it happens, so they keep the vocoder in the flowgraph
+  if (deferred_vocoder && !use_streaming) {
+    op25_frame_assembler->set_deferred_vocoder(true);
+  }
   levels = gr::blocks::multiply_const_ss::make(1);
 
   if (use_streaming) {
+    audio_tap = plugman_audio_tap(d_recorder);
     plugin_sink = gr::blocks::plugin_wrapper_impl::make(std::bind(&p25_recorder_decode::plugin_callback_handler, this, std::placeholders::_1, std::placeholders::_2));
   }
 
@@ -121,14 +154,14 @@ void p25_recorder_decode::initialize(int silence_frames, bool d_soft_vocoder) {
 
 void p25_recorder_decode::plugin_callback_handler(int16_t *samples, int sampleCount) {
   if (d_call) {
-    plugman_audio_callback(d_call, d_recorder, samples, sampleCount);
+    plugman_audio_callback(audio_tap, d_call, samples, sampleCount);
   }
 }
 
-void p25_recorder_decode::voice_codec_cb_handler(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, void *user_data) {
+void p25_recorder_decode::voice_codec_cb_handler(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted, void *user_data) {
   p25_recorder_decode *self = static_cast<p25_recorder_decode *>(user_data);
   if (self->d_call) {
-    plugman_voice_codec_data(self->d_call, codec_type, tgid, src_id, params, param_count, errs);
+    plugman_voice_codec_data(self->voice_codec_batch, self->d_call, codec_type, tgid, src_id, params, param_count, errs, e0, e1, encrypted);
   }
 }
 
@@ -28,6 +28,8 @@
 #include "recorder.h"
 
 class p25_recorder_decode;
+class Audio_Tap;
+class Voice_Codec_Batch;
 
 #if GNURADIO_VERSION < 0x030900
 typedef boost::shared_ptr<p25_recorder_decode> p25_recorder_decode_sptr;
@@ -35,13 +37,13 @@ typedef boost::shared_ptr<p25_recorder_decode> p25_recorder_decode_sptr;
 typedef std::shared_ptr<p25_recorder_decode> p25_recorder_decode_sptr;
 #endif
 
-p25_recorder_decode_sptr make_p25_recorder_decode(Recorder *recorder, int silence_frames, bool d_soft_vocoder);
+p25_recorder_decode_sptr make_p25_recorder_decode(Recorder *recorder, int silence_frames, bool d_soft_vocoder, bool deferred_vocoder = false, bool fast_vocoder = false);
 
 class p25_recorder_decode : public gr::hier_block2 {
-  friend p25_recorder_decode_sptr make_p25_recorder_decode(Recorder *recorder, int silence_frames, bool d_soft_vocoder);
+  friend p25_recorder_decode_sptr make_p25_recorder_decode(Recorder *recorder, int silence_frames, bool d_soft_vocoder, bool deferred_vocoder, bool fast_vocoder);
 
 protected:
-  virtual void initialize(int silence_frames, bool d_soft_vocoder);
+  virtual void initialize(int silence_frames, bool d_soft_vocoder, bool deferred_vocoder, bool fast_vocoder);
   Recorder *d_recorder;
   Call *d_call;
   gr::op25_repeater::p25_frame_assembler::sptr op25_frame_assembler;
@@ -52,6 +54,8 @@ protected:
   gr::blocks::multiply_const_ss::sptr levels;
   gr::blocks::transmission_sink::sptr wav_sink;
   gr::blocks::plugin_wrapper::sptr plugin_sink;
+  Audio_Tap *audio_tap;
+  Voice_Codec_Batch *voice_codec_batch;
 
 public:
   p25_recorder_decode(Recorder *recorder);
@@ -63,10 +67,13 @@ public:
   void start(Call *call);
   double since_last_write();
   void stop();
+  void park();
+  void unpark();
   void reset();
   void reset_block(gr::basic_block_sptr block); 
   int tdma_slot;
   bool delay_open;
+  bool d_parked;
   virtual ~p25_recorder_decode();
   double get_current_length();
   void plugin_callback_handler(int16_t *samples, int sampleCount);
@@ -77,6 +84,7 @@ public:
 
 private:
   void handle_alias_message(const nlohmann::json& j);
-  static void voice_codec_cb_handler(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, void *user_data);
+  void flush_message_queue();
+  static void voice_codec_cb_handler(int codec_type, long tgid, uint32_t src_id, const uint32_t *params, int param_count, int errs, int e0, int e1, bool encrypted, void *user_data);
 };
 #endif
\ No newline at end of file
@@ -1,9 +1,9 @@
 #include "p25_recorder_fsk4_demod.h"
 
-p25_recorder_fsk4_demod_sptr make_p25_recorder_fsk4_demod() {
+p25_recorder_fsk4_demod_sptr make_p25_recorder_fsk4_demod(bool fused_demod) {
   p25_recorder_fsk4_demod *recorder = new p25_recorder_fsk4_demod();
 
-  recorder->initialize();
+  recorder->initialize(fused_demod);
   return gnuradio::get_initial_sptr(recorder);
 }
 
@@ -36,18 +36,11 @@ void p25_recorder_fsk4_demod::reset() {
   //  fsk4_demod->reset(); This one may have been working but removing for now to be safe
 }
 
-void p25_recorder_fsk4_demod::initialize() {
+void p25_recorder_fsk4_demod::initialize(bool fused_demod) {
   const double phase1_channel_rate = phase1_symbol_rate * phase1_samples_per_symbol;
   const double pi = M_PI;
-
-  // FSK4: Phase Loop Lock - can only be Phase 1, so locking at that rate.
-  double freq_to_norm_radians = pi / (phase1_channel_rate / 2.0);
   double fc = 0.0;
   double fd = 600.0;
-  double pll_demod_gain = 1.0 / (fd * freq_to_norm_radians);
-  double samples_per_symbol = 5;
-  pll_freq_lock = gr::analog::pll_freqdet_cf::make((phase1_symbol_rate / 2.0 * 1.2) * freq_to_norm_radians, (fc + (3 * fd * 1.9)) * freq_to_norm_radians, (fc + (-3 * fd * 1.9)) * freq_to_norm_radians);
-  pll_amp = gr::blocks::multiply_const_ff::make(pll_demod_gain * 1.0);
 
   // FSK4: noise filter - can only be Phase 1, so locking at that rate.
 #if GNURADIO_VERSION < 0x030900
@@ -56,6 +49,23 @@ void p25_recorder_fsk4_demod::initialize() {
   baseband_noise_filter_taps = gr::filter::firdes::low_pass_2(1.0, phase1_channel_rate, phase1_symbol_rate / 2.0 * 1.175, phase1_symbol_rate / 2.0 * 0.125, 20.0, gr::fft::window::WIN_KAISER, 6.76);
 
 #endif
+
+  if (fused_demod) {
+    // FSK4: PLL, filters and symbol timing in a single block
+    fused_fsk4_demod = gr::op25_repeater::fsk4_demod_cf::make(phase1_channel_rate, phase1_symbol_rate, fd, baseband_noise_filter_taps);
+
+    connect(self(), 0, fused_fsk4_demod, 0);
+    connect(fused_fsk4_demod, 0, self(), 0);
+    return;
+  }
+
+  // FSK4: Phase Loop Lock - can only be Phase 1, so locking at that rate.
+  double freq_to_norm_radians = pi / (phase1_channel_rate / 2.0);
+  double pll_demod_gain = 1.0 / (fd * freq_to_norm_radians);
+  double samples_per_symbol = 5;
+  pll_freq_lock = gr::analog::pll_freqdet_cf::make((phase1_symbol_rate / 2.0 * 1.2) * freq_to_norm_radians, (fc + (3 * fd * 1.9)) * freq_to_norm_radians, (fc + (-3 * fd * 1.9)) * freq_to_norm_radians);
+  pll_amp = gr::blocks::multiply_const_ff::make(pll_demod_gain * 1.0);
+
   noise_filter = gr::filter::fft_filter_fff::make(1.0, baseband_noise_filter_taps);
 
   baseband_amp = gr::op25_repeater::rmsagc_ff::make(0.01, 1.00);
@@ -25,6 +25,7 @@
 #include <op25_repeater/fsk4_slicer_fb.h>
 #include <op25_repeater/rmsagc_ff.h>
 #include <op25_repeater/include/op25_repeater/fsk4_demod_ff.h>
+#include <op25_repeater/include/op25_repeater/fsk4_demod_cf.h>
 #include <gnuradio/digital/clock_recovery_mm_ff.h>
 
 class p25_recorder_fsk4_demod;
@@ -35,13 +36,13 @@ typedef boost::shared_ptr<p25_recorder_fsk4_demod> p25_recorder_fsk4_demod_sptr;
 typedef std::shared_ptr<p25_recorder_fsk4_demod> p25_recorder_fsk4_demod_sptr;
 #endif
 
-p25_recorder_fsk4_demod_sptr make_p25_recorder_fsk4_demod();
+p25_recorder_fsk4_demod_sptr make_p25_recorder_fsk4_demod(bool fused_demod = false);
 
 class p25_recorder_fsk4_demod : public gr::hier_block2 {
-  friend p25_recorder_fsk4_demod_sptr make_p25_recorder_fsk4_demod();
+  friend p25_recorder_fsk4_demod_sptr make_p25_recorder_fsk4_demod(bool fused_demod);
 
 protected:
-  virtual void initialize();
+  virtual void initialize(bool fused_demod);
 
 public:
   p25_recorder_fsk4_demod();
@@ -63,6 +64,7 @@ private:
   gr::analog::quadrature_demod_cf::sptr fm_demod;
   gr::op25_repeater::rmsagc_ff::sptr baseband_amp;
   gr::op25_repeater::fsk4_demod_ff::sptr fsk4_demod;
+  gr::op25_repeater::fsk4_demod_cf::sptr fused_fsk4_demod;
   gr::op25_repeater::fsk4_slicer_fb::sptr slicer;
   gr::digital::clock_recovery_mm_ff::sptr clock_recovery;
     void reset_block(gr::basic_block_sptr block); 
@@ -31,6 +31,7 @@ void p25_recorder_impl::initialize(Source *src) {
   d_soft_vocoder = config->soft_vocoder;
   input_rate = source->get_rate();
   qpsk_mod = true;
+  parked = false;
   silence_frames = source->get_silence_frames();
   squelch_db = 0;
   talkgroup = 0;
@@ -55,10 +56,10 @@ void p25_recorder_impl::initialize(Source *src) {
   //  initialize_p25();
 
   modulation_selector = gr::blocks::selector::make(sizeof(gr_complex), 0, 0);
-  qpsk_demod = make_p25_recorder_qpsk_demod();
-  qpsk_p25_decode = make_p25_recorder_decode(this, silence_frames, d_soft_vocoder);
-  fsk4_demod = make_p25_recorder_fsk4_demod();
-  fsk4_p25_decode = make_p25_recorder_decode(this, silence_frames, d_soft_vocoder);
+  qpsk_demod = make_p25_recorder_qpsk_demod(config->fused_demod);
+  qpsk_p25_decode = make_p25_recorder_decode(this, silence_frames, d_soft_vocoder, config->deferred_vocoder, config->fast_vocoder);
+  fsk4_demod = make_p25_recorder_fsk4_demod(config->fused_demod);
+  fsk4_p25_decode = make_p25_recorder_decode(this, silence_frames, d_soft_vocoder, config->deferred_vocoder, config->fast_vocoder);
 
   connect(self(), 0, prefilter, 0);
   connect(prefilter, 0, modulation_selector, 0);
@@ -279,6 +280,7 @@ void p25_recorder_impl::stop() {
 
     state = INACTIVE;
     set_enabled(false);
+    source->release_recorder(this);
 
     clear();
     if (qpsk_mod) {
@@ -291,6 +293,52 @@ void p25_recorder_impl::stop() {
   }
 }
 
+// Tune an idle recorder to a channel that is likely to get the next grant and keep it
+// demodulating, so the FLL and framing are already locked when the call starts.
+// The audio is discarded until start() is called.
+bool p25_recorder_impl::park(double f, bool qpsk) {
+  if ((state != INACTIVE) || conventional) {
+    return false;
+  }
+
+  qpsk_mod = qpsk;
+  chan_freq = f;
+
+  int park_offset = 0;
+  if (source->get_autotune_source()) {
+    park_offset = source->get_source_error();
+  }
+  prefilter->tune_offset(center_freq - chan_freq + park_offset);
+
+  if (qpsk_mod) {
+    modulation_selector->set_output_index(1);
+    qpsk_p25_decode->park();
+  } else {
+    modulation_selector->set_output_index(0);
+    fsk4_p25_decode->park();
+  }
+  parked = true;
+  set_enabled(true);
+
+  BOOST_LOG_TRIVIAL(debug) << "[ " << rec_num << " ] Parking P25 Recorder on " << format_freq(chan_freq) << "\tQPSK: " << qpsk_mod;
+  return true;
+}
+
+void p25_recorder_impl::unpark() {
+  if (!parked) {
+    return;
+  }
+  parked = false;
+  set_enabled(false);
+  qpsk_p25_decode->unpark();
+  fsk4_p25_decode->unpark();
+  clear();
+}
+
+bool p25_recorder_impl::is_parked() {
+  return parked;
+}
+
 void p25_recorder_impl::set_tdma_slot(int slot) {
   if (qpsk_mod) {
     qpsk_p25_decode->set_tdma_slot(slot);
@@ -327,6 +375,8 @@ bool p25_recorder_impl::start(Call *call) {
 
     talkgroup = call->get_talkgroup();
     short_name = call->get_short_name();
+    bool pretuned = parked && (chan_freq == call->get_freq());
+    parked = false;
     chan_freq = call->get_freq();
     this->call = call;
 
@@ -340,7 +390,7 @@ bool p25_recorder_impl::start(Call *call) {
       autotune_info << " AutoTune: " << std::showpos << autotune_offset << std::noshowpos << " Hz";
     }
 
-    BOOST_LOG_TRIVIAL(info) << loghdr << "\u001b[32mStarting P25 Recorder Num [" << rec_num << "]\u001b[0m\tTDMA: " << call->get_phase2_tdma() << "\tSlot: " << call->get_tdma_slot() << "\tQPSK: " << qpsk_mod << autotune_info.str();
+    BOOST_LOG_TRIVIAL(info) << loghdr << "\u001b[32mStarting P25 Recorder Num [" << rec_num << "]\u001b[0m\tTDMA: " << call->get_phase2_tdma() << "\tSlot: " << call->get_tdma_slot() << "\tQPSK: " << qpsk_mod << autotune_info.str() << (pretuned ? "\tPre-tuned" : "");
 
     int offset_amount = (center_freq - chan_freq + autotune_offset);
 
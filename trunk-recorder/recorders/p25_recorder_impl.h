@@ -88,6 +88,9 @@ public:
   void tune_freq(double f);
   bool start(Call *call);
   void stop();
+  bool park(double f, bool qpsk);
+  void unpark();
+  bool is_parked();
   void clear();
   double get_freq();
   int get_num();
@@ -124,6 +127,7 @@ protected:
   double chan_freq;
   double center_freq;
   bool qpsk_mod;
+  bool parked;
   double squelch_db;
   gr::blocks::selector::sptr modulation_selector;
 
@@ -1,8 +1,8 @@
 #include "p25_recorder_qpsk_demod.h"
 
-p25_recorder_qpsk_demod_sptr make_p25_recorder_qpsk_demod() {
+p25_recorder_qpsk_demod_sptr make_p25_recorder_qpsk_demod(bool fused_demod) {
   p25_recorder_qpsk_demod *recorder = new p25_recorder_qpsk_demod();
-  recorder->initialize();
+  recorder->initialize(fused_demod);
   return gnuradio::get_initial_sptr(recorder);
 }
 
@@ -28,6 +28,10 @@ void p25_recorder_qpsk_demod::reset_block(gr::basic_block_sptr block) {
 }
 
 void p25_recorder_qpsk_demod::reset() {
+    if (fused_qpsk_demod) {
+      fused_qpsk_demod->reset();
+      return;
+    }
     costas->set_phase(0);
     costas->set_frequency(0);
     clock->reset();
@@ -58,17 +62,19 @@ void p25_recorder_qpsk_demod::switch_tdma(bool phase2) {
   omega = double(system_channel_rate) / double(symbol_rate);
   fmax = symbol_rate / 2; // Hz
   fmax = 2 * pi * fmax / double(system_channel_rate);
-  clock->set_omega(omega);
+  if (fused_qpsk_demod) {
+    fused_qpsk_demod->set_omega(omega);
+  } else {
+    clock->set_omega(omega);
+  }
   //costas_clock->update_fmax(fmax);
   this->reset();
   // op25_frame_assembler->set_phase2_tdma(d_phase2_tdma);
 }
 
-void p25_recorder_qpsk_demod::initialize() {
+void p25_recorder_qpsk_demod::initialize(bool fused_demod) {
   const double pi = M_PI;
 
-  agc = gr::analog::feedforward_agc_cc::make(16, 1.0);
-
   // Gardner Costas Clock
   double gain_mu = 0.025; // 0.025
   double costas_alpha = 0.008;
@@ -77,6 +83,17 @@ void p25_recorder_qpsk_demod::initialize() {
   double fmax = 3000; // Hz
   fmax = 2 * pi * fmax / double(system_channel_rate);
 
+  if (fused_demod) {
+    // QPSK: timing, differential decode, carrier recovery and rescale in a single block
+    fused_qpsk_demod = gr::op25_repeater::cqpsk_demod_cf::make(omega, gain_mu, gain_omega, costas_alpha);
+
+    connect(self(), 0, fused_qpsk_demod, 0);
+    connect(fused_qpsk_demod, 0, self(), 0);
+    return;
+  }
+
+  agc = gr::analog::feedforward_agc_cc::make(16, 1.0);
+
   costas = gr::op25_repeater::costas_loop_cc::make(costas_alpha,  4, (2 * pi)/4 );
   clock = gr::op25_repeater::gardner_cc::make(omega, gain_mu, gain_omega);
   // QPSK: Perform Differential decoding on the constellation
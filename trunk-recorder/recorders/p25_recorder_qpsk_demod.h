@@ -18,6 +18,7 @@
 #include <gnuradio/digital/diff_phasor_cc.h>
 #include <op25_repeater/costas_loop_cc.h>
 #include <op25_repeater/gardner_cc.h>
+#include <op25_repeater/cqpsk_demod_cf.h>
 
 #if GNURADIO_VERSION < 0x030800
 #include <gnuradio/blocks/multiply_const_ff.h>
@@ -35,16 +36,17 @@ typedef boost::shared_ptr<p25_recorder_qpsk_demod> p25_recorder_qpsk_demod_sptr;
 typedef std::shared_ptr<p25_recorder_qpsk_demod> p25_recorder_qpsk_demod_sptr;
 #endif
 
-p25_recorder_qpsk_demod_sptr make_p25_recorder_qpsk_demod();
+p25_recorder_qpsk_demod_sptr make_p25_recorder_qpsk_demod(bool fused_demod = false);
 
 class p25_recorder_qpsk_demod : public gr::hier_block2 {
-  friend p25_recorder_qpsk_demod_sptr make_p25_recorder_qpsk_demod();
+  friend p25_recorder_qpsk_demod_sptr make_p25_recorder_qpsk_demod(bool fused_demod);
 
 protected:
-  virtual void initialize();
+  virtual void initialize(bool fused_demod);
 
    gr::op25_repeater::gardner_cc::sptr clock;
   gr::op25_repeater::costas_loop_cc::sptr costas;
+  gr::op25_repeater::cqpsk_demod_cf::sptr fused_qpsk_demod;
 
 public:
   p25_recorder_qpsk_demod();
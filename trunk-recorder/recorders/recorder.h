@@ -86,6 +86,9 @@ public:
   virtual void tune_freq(double f){};
   virtual bool start(Call *call) { return false; };
   virtual void stop(){};
+  virtual bool park(double f, bool qpsk_mod) { return false; };
+  virtual void unpark(){};
+  virtual bool is_parked() { return false; };
   virtual void set_tdma_slot(int slot){};
   virtual double get_freq() { return 0; };
   virtual int get_freq_error() { return 0; };
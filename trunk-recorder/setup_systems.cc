@@ -121,10 +121,72 @@ bool setup_conventional_system(System *system, Config &config, gr::top_block_spt
   return system_added;
 }
 
+void add_control_channel_input(System_impl *system, Source *source, double control_channel_freq, gr::top_block_sptr &tb) {
+  System_impl::Control_Channel_Input input;
+  input.source = source;
+
+  if (system->get_system_type() == "smartnet") {
+    input.smartnet_trunking = smartnet_impl::make(control_channel_freq,
+                                                  source->get_center(),
+                                                  source->get_rate(),
+                                                  system->get_msg_queue(),
+                                                  system->get_sys_num());
+    input.control_ring = &input.smartnet_trunking->control_ring;
+    input.selector_port = source->connect_selector_port(tb, input.smartnet_trunking);
+  }
+
+  if (system->get_system_type() == "p25") {
+    input.p25_trunking = make_p25_trunking(control_channel_freq,
+                                           source->get_center(),
+                                           source->get_rate(),
+                                           system->get_msg_queue(),
+                                           system->get_qpsk_mod(),
+                                           system->get_sys_num(),
+                                           source->get_config()->fused_demod);
+    input.control_ring = &input.p25_trunking->control_ring;
+    input.selector_port = source->connect_selector_port(tb, input.p25_trunking);
+  }
+
+  system->control_channel_inputs.push_back(input);
+  BOOST_LOG_TRIVIAL(info) << "[" << system->get_short_name() << "]	Control Channel input on Source " << source->get_num() << " - Selector Port: " << input.selector_port;
+}
+
+// Switches the System's control channel to the trunking block fed by this Source
+bool select_control_channel_input(System_impl *system, Source *source, double control_channel_freq) {
+  System_impl::Control_Channel_Input *selected = NULL;
+
+  for (vector<System_impl::Control_Channel_Input>::iterator it = system->control_channel_inputs.begin(); it != system->control_channel_inputs.end(); it++) {
+    if (it->source == source) {
+      selected = &(*it);
+    } else {
+      it->source->set_selector_port_enabled(it->selector_port, false);
+    }
+  }
+
+  if (!selected) {
+    return false;
+  }
+
+  system->set_source(source);
+  system->smartnet_trunking = selected->smartnet_trunking;
+  system->p25_trunking = selected->p25_trunking;
+
+  if (system->get_system_type() == "smartnet") {
+    system->smartnet_trunking->tune_freq(control_channel_freq);
+  } else if (system->get_system_type() == "p25") {
+    system->p25_trunking->tune_freq(control_channel_freq);
+  }
+  source->set_selector_port_enabled(selected->selector_port, true);
+  return true;
+}
+
 bool setup_systems(Config &config, gr::top_block_sptr &tb, std::vector<Source *> &sources, std::vector<System *> &systems, std::vector<Call *> &calls) {
 
   Source *source = NULL;
 
+  // The Sources are fixed from here on, index their frequency ranges for grant handling
+  source_index.build(sources);
+
   for (vector<System *>::iterator sys_it = systems.begin(); sys_it != systems.end(); sys_it++) {
     System_impl *system = (System_impl *)*sys_it;
     // bool    source_found = false;
@@ -136,37 +198,30 @@ bool setup_systems(Config &config, gr::top_block_sptr &tb, std::vector<Source *>
       double control_channel_freq = system->get_current_control_channel();
       BOOST_LOG_TRIVIAL(info) << "[" << system->get_short_name() << "]\tStarted with Control Channel: " << format_freq(control_channel_freq);
 
+      // Each SmartNet system keeps its own OSW queue, channel and talkgroup state
+      if (system->get_system_type() == "smartnet") {
+        system->smartnet_parser = new SmartnetParser(system);
+        system->smartnet_parser->set_msgq_id(system->get_sys_num());
+      }
+
+      // Give every Source that covers one of the control channels its own trunking block
+      std::vector<double> control_channels = system->get_control_channels();
       for (vector<Source *>::iterator src_it = sources.begin(); src_it != sources.end(); src_it++) {
         source = *src_it;
 
-        if ((source->get_min_hz() <= control_channel_freq) &&
-            (source->get_max_hz() >= control_channel_freq)) {
-          // The source can cover the System's control channel
-          system_added = true;
-          system->set_source(source);
-
-          if (system->get_system_type() == "smartnet") {
-            system->smartnet_trunking = smartnet_impl::make(control_channel_freq,
-                                                               source->get_center(),
-                                                               source->get_rate(),
-                                                               system->get_msg_queue(),
-                                                               system->get_sys_num());
-            tb->connect(source->get_src_block(), 0, system->smartnet_trunking, 0);
-          }
-
-          if (system->get_system_type() == "p25") {
-            system->p25_trunking = make_p25_trunking(control_channel_freq,
-                                                     source->get_center(),
-                                                     source->get_rate(),
-                                                     system->get_msg_queue(),
-                                                     system->get_qpsk_mod(),
-                                                     system->get_sys_num());
-            tb->connect(source->get_src_block(), 0, system->p25_trunking, 0);
+        for (vector<double>::iterator cc_it = control_channels.begin(); cc_it != control_channels.end(); cc_it++) {
+          if ((source->get_min_hz() <= *cc_it) && (source->get_max_hz() >= *cc_it)) {
+            add_control_channel_input(system, source, *cc_it, tb);
+            break;
           }
-
-          break;
         }
       }
+
+      source = source_index.find(control_channel_freq);
+      if (source) {
+        // The source can cover the System's control channel
+        system_added = select_control_channel_input(system, source, control_channel_freq);
+      }
       if (!system_added) {
         BOOST_LOG_TRIVIAL(error) << "[" << system->get_short_name() << "]\t Unable to find a source for this System! Control Channel Freq: " << format_freq(control_channel_freq);
         return false;
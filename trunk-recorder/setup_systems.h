@@ -10,13 +10,18 @@
 #include "call_conventional.h"
 #include "config.h"
 #include "source.h"
+#include "source_index.h"
 #include "systems/p25_trunking.h"
 //#include "systems/smartnet_trunking.h"
 #include "systems/smartnet_impl.h"
+#include "systems/smartnet_parser.h"
 #include "systems/system.h"
+#include "systems/system_impl.h"
 
 bool setup_conventional_channel(System *system, double frequency, long channel_index, Config &config, gr::top_block_sptr &tb, std::vector<Source *> &sources, std::vector<Call *> &calls);
 bool setup_conventional_system(System *system, Config &config, gr::top_block_sptr &tb, std::vector<Source *> &sources, std::vector<Call *> &calls);
 bool setup_systems(Config &config, gr::top_block_sptr &tb, std::vector<Source *> &sources, std::vector<System *> &systems, std::vector<Call *> &calls);
+void add_control_channel_input(System_impl *system, Source *source, double control_channel_freq, gr::top_block_sptr &tb);
+bool select_control_channel_input(System_impl *system, Source *source, double control_channel_freq);
 
 #endif
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "source.h"
 #include "formatter.h"
 
+#include <algorithm>
+#include <iterator>
+
 using json = nlohmann::json;
 
 static int src_counter = 0;
@@ -231,6 +234,15 @@ void Source::attach_selector(gr::top_block_sptr tb) {
   }
 }
 
+// Feeds a block from its own selector port, which starts out disabled
+unsigned int Source::connect_selector_port(gr::top_block_sptr tb, gr::basic_block_sptr block) {
+  attach_selector(tb);
+  unsigned int port = next_selector_port;
+  tb->connect(recorder_selector, port, block, 0);
+  next_selector_port++;
+  return port;
+}
+
 void Source::attach_detector(gr::top_block_sptr tb) {
   if (!attached_detector) {
     attached_detector = true;
@@ -502,6 +514,8 @@ void Source::create_analog_recorders(gr::top_block_sptr tb, int r) {
   for (int i = 0; i < max_analog_recorders; i++) {
     analog_recorder_sptr log = make_analog_recorder(this, ANALOG);
     analog_recorders.push_back(log);
+    // Kept in reverse so the lowest numbered recorder is handed out first
+    available_analog_recorders.insert(available_analog_recorders.begin(), (Recorder *)log.get());
     log->set_selector_port(next_selector_port);
     tb->connect(recorder_selector, next_selector_port, log, 0);
     next_selector_port++;
@@ -518,12 +532,18 @@ void Source::create_digital_recorders(gr::top_block_sptr tb, int r) {
   for (int i = 0; i < max_digital_recorders; i++) {
     p25_recorder_sptr log = make_p25_recorder(this, P25);
     digital_recorders.push_back(log);
+    add_available_digital_recorder((Recorder *)log.get());
     log->set_selector_port(next_selector_port);
     tb->connect(recorder_selector, next_selector_port, log, 0);
     next_selector_port++;
   }
 }
 
+void Source::add_available_digital_recorder(Recorder *recorder) {
+  // Kept in reverse so the lowest numbered recorder is handed out first
+  available_digital_recorders.insert(available_digital_recorders.begin(), recorder);
+}
+
 void Source::create_sigmf_recorders(gr::top_block_sptr tb, int r) {
   max_sigmf_recorders = r;
 
@@ -616,9 +636,9 @@ void Source::create_debug_recorder(gr::top_block_sptr tb, int source_num) {
   tb->connect(source_block, 0, log, 0);
 }
 
-Recorder *Source::get_analog_recorder(Talkgroup *talkgroup, int priority, Call *call) {
-  int num_available_recorders = get_num_available_analog_recorders();
+Recorder *Source::get_pool_recorder(std::vector<Recorder *> &pool, std::string pool_name, Talkgroup *talkgroup, int priority, Call *call) {
   std::string loghdr = log_header( call->get_short_name(), call->get_call_num(), call->get_talkgroup_display(), call->get_freq());
+
   if (talkgroup && (priority == -1)) {
     call->set_state(MONITORING);
     call->set_monitoring_state(IGNORED_TG);
@@ -626,73 +646,213 @@ Recorder *Source::get_analog_recorder(Talkgroup *talkgroup, int priority, Call *
     return NULL;
   }
 
-  if (talkgroup && priority > num_available_recorders) { // a high priority is bad. You need at least the number of availalbe recorders to your priority
+  if (pool.empty()) {
+    recorder_pool_stats[priority].exhausted++;
+  }
+
+  int num_available_recorders = pool.size();
+  bool preempted = false;
+
+  // The preempted call's recorder goes to this grant, so the priority check is
+  // only for grants that did not preempt anything
+  if (talkgroup && config->recorder_preemption && (pool.empty() || priority > num_available_recorders)) {
+    preempted = preempt_recorder(pool, priority, call);
+    num_available_recorders = pool.size();
+  }
+
+  if (talkgroup && !preempted && priority > num_available_recorders) { // a high priority is bad. You need at least the number of availalbe recorders to your priority
     call->set_state(MONITORING);
     call->set_monitoring_state(NO_RECORDER);
+    recorder_pool_stats[priority].dropped++;
     BOOST_LOG_TRIVIAL(error) << loghdr << "Not recording talkgroup. Priority is " << priority << " but only " << num_available_recorders << " recorders are available.";
     return NULL;
   }
 
-  return get_analog_recorder(call);
-}
+  if (pool.empty()) {
+    recorder_pool_stats[priority].dropped++;
+    BOOST_LOG_TRIVIAL(error) << loghdr << "[ " << device << " ] No " << pool_name << " Recorders Available - " << assigned_recorders.size() << " recorders in use.";
+    return NULL;
+  }
 
-Recorder *Source::get_analog_recorder(Call *call) {
-  for (std::vector<analog_recorder_sptr>::iterator it = analog_recorders.begin();
-       it != analog_recorders.end(); it++) {
-    analog_recorder_sptr rx = *it;
+  Recorder *recorder = take_pool_recorder(pool, call->get_freq());
 
-    if (rx->get_state() == AVAILABLE) {
-      return (Recorder *)rx.get();
+  Recorder_Assignment assignment;
+  assignment.recorder = recorder;
+  assignment.call = call;
+  assignment.priority = priority;
+  assignment.pool = &pool;
+  assigned_recorders.push_back(assignment);
+
+  return recorder;
+}
 
+Recorder *Source::take_pool_recorder(std::vector<Recorder *> &pool, double freq) {
+  std::vector<Recorder *>::iterator pick = pool.end();
+
+  // A recorder parked on the granted channel is already locked to it
+  for (std::vector<Recorder *>::iterator it = parked_recorders.begin(); it != parked_recorders.end(); it++) {
+    if ((*it)->get_freq() == freq) {
+      pick = std::find(pool.begin(), pool.end(), *it);
       break;
     }
   }
-  std::string loghdr = log_header( call->get_short_name(), call->get_call_num(), call->get_talkgroup_display(), call->get_freq());
-  BOOST_LOG_TRIVIAL(error) << loghdr << "[ " << device << " ] No Analog Recorders Available.";
-  return NULL;
-}
-
-Recorder *Source::get_digital_recorder(Talkgroup *talkgroup, int priority, Call *call) {
-  int num_available_recorders = get_num_available_digital_recorders();
-  std::string loghdr = log_header( call->get_short_name(), call->get_call_num(), call->get_talkgroup_display(), call->get_freq());
 
-  if (talkgroup && (priority == -1)) {
-    call->set_state(MONITORING);
-    call->set_monitoring_state(IGNORED_TG);
-    BOOST_LOG_TRIVIAL(info) << loghdr << "Not recording talkgroup - Priority is -1 (Disabled).";
-    return NULL;
+  // Otherwise leave the parked recorders where they are, if possible
+  if (pick == pool.end()) {
+    for (std::vector<Recorder *>::reverse_iterator it = pool.rbegin(); it != pool.rend(); it++) {
+      if (!(*it)->is_parked()) {
+        pick = std::next(it).base();
+        break;
+      }
+    }
   }
 
-  if (talkgroup && priority > num_available_recorders) { // a high priority is bad. You need at least the number of availalbe recorders to your priority
-    call->set_state(MONITORING);
-    call->set_monitoring_state(NO_RECORDER);
-    BOOST_LOG_TRIVIAL(error) << loghdr << "Not recording talkgroup. Priority is " << priority << " but only " << num_available_recorders << " recorders are available.";
-    return NULL;
+  if (pick == pool.end()) {
+    pick = pool.end() - 1;
   }
 
-  return get_digital_recorder(call);
+  Recorder *recorder = *pick;
+  pool.erase(pick);
+
+  std::vector<Recorder *>::iterator parked = std::find(parked_recorders.begin(), parked_recorders.end(), recorder);
+  if (parked != parked_recorders.end()) {
+    parked_recorders.erase(parked);
+    if (recorder->get_freq() != freq) {
+      recorder->unpark();
+    }
+  }
+  return recorder;
 }
 
-Recorder *Source::get_digital_recorder(Call *call) {
-  for (std::vector<p25_recorder_sptr>::iterator it = digital_recorders.begin();
-       it != digital_recorders.end(); it++) {
-    p25_recorder_sptr rx = *it;
+void Source::update_parked_recorders(const std::vector<std::pair<double, bool>> &channels, int max_parked, int spare) {
+  // Release parked recorders whose channel has gone quiet
+  for (std::vector<Recorder *>::iterator it = parked_recorders.begin(); it != parked_recorders.end();) {
+    Recorder *recorder = *it;
+    bool still_active = false;
 
-    if (rx->get_state() == AVAILABLE) {
-      return (Recorder *)rx.get();
+    for (size_t i = 0; i < channels.size(); i++) {
+      if (channels[i].first == recorder->get_freq()) {
+        still_active = true;
+        break;
+      }
+    }
 
+    if (!still_active || ((int)parked_recorders.size() > max_parked)) {
+      recorder->unpark();
+      it = parked_recorders.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  for (std::vector<std::pair<double, bool>>::const_iterator ch = channels.begin(); ch != channels.end(); ch++) {
+    // Only park while there are more idle recorders than the spare capacity to keep free
+    int idle_recorders = available_digital_recorders.size() - parked_recorders.size();
+    if (((int)parked_recorders.size() >= max_parked) || (idle_recorders <= spare)) {
       break;
     }
+
+    double freq = ch->first;
+    if ((freq < min_hz) || (freq > max_hz)) {
+      continue;
+    }
+
+    bool covered = false;
+    for (std::vector<Recorder_Assignment>::iterator it = assigned_recorders.begin(); it != assigned_recorders.end(); it++) {
+      if ((it->pool == &available_digital_recorders) && (it->recorder->get_freq() == freq)) {
+        covered = true;
+        break;
+      }
+    }
+    for (std::vector<Recorder *>::iterator it = parked_recorders.begin(); it != parked_recorders.end() && !covered; it++) {
+      if ((*it)->get_freq() == freq) {
+        covered = true;
+      }
+    }
+    if (covered) {
+      continue;
+    }
+
+    // Prefer a recorder that was last used on this channel
+    Recorder *recorder = NULL;
+    for (std::vector<Recorder *>::reverse_iterator it = available_digital_recorders.rbegin(); it != available_digital_recorders.rend(); it++) {
+      if (!(*it)->is_parked() && (!recorder || ((*it)->get_freq() == freq))) {
+        recorder = *it;
+      }
+    }
+
+    if (recorder && recorder->park(freq, ch->second)) {
+      parked_recorders.push_back(recorder);
+    }
   }
-  std::string loghdr = log_header( call->get_short_name(), call->get_call_num(), call->get_talkgroup_display(), call->get_freq());
-  BOOST_LOG_TRIVIAL(error) << loghdr << "[ " << device << " ] No Digital Recorders Available.";
+}
 
-  for (std::vector<p25_recorder_sptr>::iterator it = digital_recorders.begin();
-       it != digital_recorders.end(); it++) {
-    p25_recorder_sptr rx = *it;
-    BOOST_LOG_TRIVIAL(info) << "[ " << rx->get_num() << " ] State: " << format_state(rx->get_state()) << " Freq: " << rx->get_freq();
+int Source::get_num_parked_recorders() {
+  return parked_recorders.size();
+}
+
+bool Source::preempt_recorder(std::vector<Recorder *> &pool, int priority, Call *call) {
+  std::vector<Recorder_Assignment>::iterator lowest = assigned_recorders.end();
+
+  // Find the call with the lowest priority (the highest number) using this pool
+  for (std::vector<Recorder_Assignment>::iterator it = assigned_recorders.begin(); it != assigned_recorders.end(); it++) {
+    if ((it->pool == &pool) && (it->priority > priority)) {
+      if ((lowest == assigned_recorders.end()) || (it->priority > lowest->priority)) {
+        lowest = it;
+      }
+    }
+  }
+
+  if (lowest == assigned_recorders.end()) {
+    return false;
+  }
+
+  Call *preempted_call = lowest->call;
+  int preempted_priority = lowest->priority;
+  std::string loghdr = log_header( preempted_call->get_short_name(), preempted_call->get_call_num(), preempted_call->get_talkgroup_display(), preempted_call->get_freq());
+  BOOST_LOG_TRIVIAL(info) << loghdr << "\u001b[33mPreempting Call\u001b[0m - Priority: " << (preempted_priority == UNKNOWN_TG_PRIORITY ? std::string("unknown") : std::to_string(preempted_priority)) << " for TG: " << call->get_talkgroup_display() << " Priority: " << priority;
+
+  // Concluding the call stops its recorder, which puts it back on the free list.
+  // The recorder is no longer the call's once the grant has it.
+  preempted_call->conclude_call();
+  preempted_call->set_recorder(NULL);
+  preempted_call->set_state(MONITORING);
+  preempted_call->set_monitoring_state(PREEMPTED);
+  recorder_pool_stats[preempted_priority].preempted++;
+
+  return !pool.empty();
+}
+
+void Source::release_recorder(Recorder *recorder) {
+  for (std::vector<Recorder_Assignment>::iterator it = assigned_recorders.begin(); it != assigned_recorders.end(); it++) {
+    if (it->recorder == recorder) {
+      // A parked recorder that failed to start is still tuned to its old channel
+      recorder->unpark();
+      it->pool->push_back(recorder);
+      assigned_recorders.erase(it);
+      return;
+    }
   }
-  return NULL;
+}
+
+std::map<int, Recorder_Pool_Stats> Source::get_recorder_pool_stats() {
+  return recorder_pool_stats;
+}
+
+Recorder *Source::get_analog_recorder(Talkgroup *talkgroup, int priority, Call *call) {
+  return get_pool_recorder(available_analog_recorders, "Analog", talkgroup, priority, call);
+}
+
+Recorder *Source::get_analog_recorder(Call *call) {
+  return get_pool_recorder(available_analog_recorders, "Analog", NULL, UNKNOWN_TG_PRIORITY, call);
+}
+
+Recorder *Source::get_digital_recorder(Talkgroup *talkgroup, int priority, Call *call) {
+  return get_pool_recorder(available_digital_recorders, "Digital", talkgroup, priority, call);
+}
+
+Recorder *Source::get_digital_recorder(Call *call) {
+  return get_pool_recorder(available_digital_recorders, "Digital", NULL, UNKNOWN_TG_PRIORITY, call);
 }
 
 Recorder *Source::get_debug_recorder() {
@@ -740,7 +900,7 @@ void Source::print_recorders() {
        it != digital_recorders.end(); it++) {
     p25_recorder_sptr rx = *it;
 
-    BOOST_LOG_TRIVIAL(info) << "\t[ " << std::setw(2) << rx->get_num() << " ] " << rx->get_type_string() << "\tState: " << format_state(rx->get_state());
+    BOOST_LOG_TRIVIAL(info) << "\t[ " << std::setw(2) << rx->get_num() << " ] " << rx->get_type_string() << "\tState: " << format_state(rx->get_state()) << (rx->is_parked() ? "\tParked: " + format_freq(rx->get_freq()).str() : "");
   }
 
   for (std::vector<p25_recorder_sptr>::iterator it = digital_conv_recorders.begin();
@@ -770,6 +930,11 @@ void Source::print_recorders() {
 
     BOOST_LOG_TRIVIAL(info) << "\t[ " << std::setw(2) << rx->get_num() << " ] " << rx->get_type_string() << "\tState: " << format_state(rx->get_state());
   }
+
+  for (std::map<int, Recorder_Pool_Stats>::iterator it = recorder_pool_stats.begin(); it != recorder_pool_stats.end(); it++) {
+    std::string priority = (it->first == UNKNOWN_TG_PRIORITY) ? "unknown" : std::to_string(it->first);
+    BOOST_LOG_TRIVIAL(info) << "\tPriority " << priority << "\tExhausted: " << it->second.exhausted << "\tPreempted: " << it->second.preempted << "\tDropped: " << it->second.dropped;
+  }
 }
 
 int Source::digital_recorder_count() {
@@ -789,30 +954,11 @@ int Source::sigmf_recorder_count() {
 }
 
 int Source::get_num_available_digital_recorders() {
-  int num_available_recorders = 0;
-
-  for (std::vector<p25_recorder_sptr>::iterator it = digital_recorders.begin();
-       it != digital_recorders.end(); it++) {
-    p25_recorder_sptr rx = *it;
-
-    if (rx->get_state() == AVAILABLE) {
-      num_available_recorders++;
-    }
-  }
-  return num_available_recorders;
+  return available_digital_recorders.size();
 }
 
 int Source::get_num_available_analog_recorders() {
-  int num_available_recorders = 0;
-
-  for (std::vector<analog_recorder_sptr>::iterator it = analog_recorders.begin(); it != analog_recorders.end(); it++) {
-    analog_recorder_sptr rx = *it;
-
-    if (rx->get_state() == AVAILABLE) {
-      num_available_recorders++;
-    }
-  }
-  return num_available_recorders;
+  return available_analog_recorders.size();
 }
 
 std::vector<Recorder *> Source::get_recorders() {
@@ -14,6 +14,8 @@
 #include <gnuradio/top_block.h>
 #include <gnuradio/uhd/usrp_source.h>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <numeric>
 #include <osmosdr/source.h>
 
@@ -24,6 +26,22 @@ struct Gain_Stage_t {
   double value;
 };
 
+// Calls for talkgroups that are not in the talkgroup file are the first to be preempted
+const int UNKNOWN_TG_PRIORITY = std::numeric_limits<int>::max();
+
+struct Recorder_Pool_Stats {
+  long exhausted = 0; // grants that found no free recorder
+  long preempted = 0; // calls stopped to free a recorder for a higher priority grant
+  long dropped = 0;   // grants that were not recorded for lack of a recorder
+};
+
+struct Recorder_Assignment {
+  Recorder *recorder;
+  Call *call;
+  int priority;
+  std::vector<Recorder *> *pool;
+};
+
 class Source {
 
   int src_num;
@@ -65,6 +83,15 @@ class Source {
   std::vector<analog_recorder_sptr> analog_conv_recorders;
   std::vector<dmr_recorder_sptr> dmr_conv_recorders;
   std::vector<Gain_Stage_t> gain_stages;
+
+  // Free lists for the trunked recorders. A recorder is taken off when it is handed
+  // out for a call and put back when it is stopped.
+  std::vector<Recorder *> available_digital_recorders;
+  std::vector<Recorder *> available_analog_recorders;
+  std::vector<Recorder_Assignment> assigned_recorders;
+  // Free digital recorders that are parked on a recently active channel
+  std::vector<Recorder *> parked_recorders;
+  std::map<int, Recorder_Pool_Stats> recorder_pool_stats;
   std::string driver;
   std::string device;
   std::string antenna;
@@ -73,6 +100,13 @@ class Source {
   signal_detector_cvf::sptr signal_detector;
 
   void add_gain_stage(std::string stage_name, double value);
+  Recorder *get_pool_recorder(std::vector<Recorder *> &pool, std::string pool_name, Talkgroup *talkgroup, int priority, Call *call);
+  bool preempt_recorder(std::vector<Recorder *> &pool, int priority, Call *call);
+  Recorder *take_pool_recorder(std::vector<Recorder *> &pool, double freq);
+
+protected:
+  // Puts a trunked digital recorder on the free list, to be handed out after the ones already there
+  void add_available_digital_recorder(Recorder *recorder);
 
 public:
   int get_num();
@@ -134,6 +168,7 @@ public:
   std::vector<Recorder *> find_conventional_recorders_by_freq(Detected_Signal ds);
   void enable_detected_recorders();
   void set_selector_port_enabled(unsigned int port, bool enabled);
+  unsigned int connect_selector_port(gr::top_block_sptr tb, gr::basic_block_sptr block);
   bool is_selector_port_enabled(unsigned int port);
   void create_debug_recorder(gr::top_block_sptr tb, int source_num);
   void create_sigmf_recorders(gr::top_block_sptr tb, int r);
@@ -153,6 +188,10 @@ public:
   Recorder *get_debug_recorder();
   Recorder *get_sigmf_recorder();
   std::vector<Recorder *> get_recorders();
+  void release_recorder(Recorder *recorder);
+  void update_parked_recorders(const std::vector<std::pair<double, bool>> &channels, int max_parked, int spare);
+  int get_num_parked_recorders();
+  std::map<int, Recorder_Pool_Stats> get_recorder_pool_stats();
 
   AutotuneManager *autotune_manager;
   void set_autotune_source(bool m);
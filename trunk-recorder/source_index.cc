@@ -0,0 +1,55 @@
+#include "source_index.h"
+#include "source.h"
+
+#include <algorithm>
+
+SourceIndex source_index;
+
+static Source *first_covering_source(const std::vector<Source *> &sources, double freq) {
+  for (std::vector<Source *>::const_iterator it = sources.begin(); it != sources.end(); ++it) {
+    Source *source = *it;
+    if ((source->get_min_hz() <= freq) && (source->get_max_hz() >= freq)) {
+      return source;
+    }
+  }
+  return NULL;
+}
+
+void SourceIndex::build(const std::vector<Source *> &sources) {
+  edges.clear();
+  point_sources.clear();
+  span_sources.clear();
+
+  for (std::vector<Source *>::const_iterator it = sources.begin(); it != sources.end(); ++it) {
+    edges.push_back((*it)->get_min_hz());
+    edges.push_back((*it)->get_max_hz());
+  }
+  std::sort(edges.begin(), edges.end());
+  edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+  // Coverage can only change at an edge, so one probe per edge and one per gap
+  // between edges describes every frequency.
+  for (size_t i = 0; i < edges.size(); i++) {
+    point_sources.push_back(first_covering_source(sources, edges[i]));
+    if (i + 1 < edges.size()) {
+      span_sources.push_back(first_covering_source(sources, (edges[i] + edges[i + 1]) / 2));
+    }
+  }
+}
+
+Source *SourceIndex::find(double freq) const {
+  std::vector<double>::const_iterator it = std::lower_bound(edges.begin(), edges.end(), freq);
+
+  if (it == edges.end()) {
+    return NULL;
+  }
+
+  size_t i = it - edges.begin();
+  if (*it == freq) {
+    return point_sources[i];
+  }
+  if (i == 0) {
+    return NULL;
+  }
+  return span_sources[i - 1];
+}
@@ -0,0 +1,26 @@
+#ifndef SOURCE_INDEX_H
+#define SOURCE_INDEX_H
+
+#include <vector>
+
+class Source;
+
+// Maps a frequency to the first Source (in config order) whose min_hz/max_hz
+// range covers it. The Sources are fixed once the config has been loaded, so the
+// index is built once during setup and every lookup is a binary search.
+class SourceIndex {
+  // Sorted, de-duplicated list of every Source's min_hz and max_hz
+  std::vector<double> edges;
+  // point_sources[i] covers exactly edges[i], span_sources[i] covers the open
+  // range (edges[i], edges[i + 1]). NULL where no Source covers the frequency.
+  std::vector<Source *> point_sources;
+  std::vector<Source *> span_sources;
+
+public:
+  void build(const std::vector<Source *> &sources);
+  Source *find(double freq) const;
+};
+
+extern SourceIndex source_index;
+
+#endif // SOURCE_INDEX_H
@@ -0,0 +1,52 @@
+#include "speculative_tuner.h"
+#include "global_structs.h"
+#include "source.h"
+#include "systems/system.h"
+
+#include <algorithm>
+#include <functional>
+
+SpeculativeTuner speculative_tuner;
+
+void SpeculativeTuner::note_activity(double freq, System *sys) {
+  // Only the P25 recorders know how to park
+  if ((freq == 0) || (sys->get_system_type() != "p25")) {
+    return;
+  }
+  Channel_Activity &activity = channel_activity[freq];
+  activity.last_seen = time(NULL);
+  activity.qpsk_mod = sys->get_qpsk_mod();
+}
+
+void SpeculativeTuner::update(Config &config, std::vector<Source *> &sources) {
+  if (config.speculative_recorders <= 0) {
+    return;
+  }
+
+  time_t now = time(NULL);
+  std::vector<std::pair<time_t, double>> recent;
+
+  for (std::map<double, Channel_Activity>::iterator it = channel_activity.begin(); it != channel_activity.end();) {
+    if ((now - it->second.last_seen) > activity_window) {
+      it = channel_activity.erase(it);
+    } else {
+      recent.push_back(std::make_pair(it->second.last_seen, it->first));
+      ++it;
+    }
+  }
+
+  // Most recently active channels first
+  std::sort(recent.begin(), recent.end(), std::greater<std::pair<time_t, double>>());
+
+  std::vector<std::pair<double, bool>> channels;
+  for (std::vector<std::pair<time_t, double>>::iterator it = recent.begin(); it != recent.end(); it++) {
+    channels.push_back(std::make_pair(it->second, channel_activity[it->second].qpsk_mod));
+  }
+
+  for (std::vector<Source *>::iterator it = sources.begin(); it != sources.end(); it++) {
+    Source *source = *it;
+    if (source->digital_recorder_count() > 0) {
+      source->update_parked_recorders(channels, config.speculative_recorders, config.speculative_spare_recorders);
+    }
+  }
+}
@@ -0,0 +1,34 @@
+#ifndef SPECULATIVE_TUNER_H
+#define SPECULATIVE_TUNER_H
+
+#include <ctime>
+#include <map>
+#include <vector>
+
+class Source;
+class System;
+struct Config;
+
+// Remembers which voice channels have recently carried GRANT or UPDATE traffic and
+// asks each Source to park idle digital recorders on the busiest of them. A grant
+// that lands on a parked channel gets a recorder that is already locked, instead
+// of losing the start of the transmission while the demod and framing settle.
+class SpeculativeTuner {
+  struct Channel_Activity {
+    time_t last_seen;
+    bool qpsk_mod;
+  };
+
+  // Channels with no activity for this many seconds are no longer parked on
+  static const int activity_window = 10;
+
+  std::map<double, Channel_Activity> channel_activity;
+
+public:
+  void note_activity(double freq, System *sys);
+  void update(Config &config, std::vector<Source *> &sources);
+};
+
+extern SpeculativeTuner speculative_tuner;
+
+#endif // SPECULATIVE_TUNER_H
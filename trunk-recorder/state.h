@@ -18,6 +18,7 @@ enum MonitoringState {
              NO_RECORDER = 4,
              ENCRYPTED = 5,
              DUPLICATE = 6,
-             SUPERSEDED = 7};
+             SUPERSEDED = 7,
+             PREEMPTED = 8};
 
 #endif
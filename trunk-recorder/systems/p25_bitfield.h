@@ -0,0 +1,50 @@
+#ifndef P25_BITFIELD_H
+#define P25_BITFIELD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// A TSBK or MBT held on the stack as the big-endian integer its bytes form, the
+// same layout the parser used to build with boost::dynamic_bitset. Bit 0 is the
+// least significant bit of the last byte, after the padding for the missing CRC.
+template <int Bits>
+struct P25_Bitfield {
+  static constexpr int Words = (Bits + 63) / 64;
+  uint64_t word[Words]; // word[0] holds bits 0 - 63
+
+  // Loads len bytes shifted left by pad bits. Bytes that would land above Bits are
+  // dropped, just as they fell off the top of the fixed size bitset.
+  void load(const unsigned char *bytes, size_t len, int pad) {
+    for (int i = 0; i < Words; i++) {
+      word[i] = 0;
+    }
+    for (size_t i = 0; i < len; i++) {
+      size_t pos = (len - 1 - i) * 8 + pad;
+      if (pos + 8 <= (size_t)Bits) {
+        word[pos / 64] |= (uint64_t)bytes[i] << (pos % 64);
+      }
+    }
+  }
+
+  // (bits >> shift) & mask
+  constexpr uint64_t field(int shift, uint64_t mask) const {
+    int w = shift / 64;
+    int b = shift % 64;
+    uint64_t value = (w < Words) ? (word[w] >> b) : 0;
+    if (b && (w + 1 < Words)) {
+      value |= word[w + 1] << (64 - b);
+    }
+    return value & mask;
+  }
+
+  // (bits << shift) & mask
+  constexpr uint64_t field_left(int shift, uint64_t mask) const {
+    return field(0, mask >> shift) << shift;
+  }
+};
+
+typedef P25_Bitfield<96> P25_Tsbk;       // 80 bit TSBK + 16 bit CRC
+typedef P25_Bitfield<96> P25_Mbt_Header; // 80 bit header + 16 bit CRC
+typedef P25_Bitfield<256> P25_Mbt_Data;  // Up to 3 data blocks + 32 bit CRC
+
+#endif // P25_BITFIELD_H
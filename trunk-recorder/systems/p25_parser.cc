@@ -1,5 +1,6 @@
 #include "p25_parser.h"
 #include "../formatter.h"
+#include <algorithm>
 
 using namespace csv;
 
@@ -139,28 +140,7 @@ std::string P25Parser::channel_to_string(int chan, int sys_num) {
   return strs.str();
 }
 
-unsigned long P25Parser::bitset_shift_mask(boost::dynamic_bitset<> &tsbk, int shift, unsigned long long mask) {
-  boost::dynamic_bitset<> bitmask(tsbk.size(), mask);
-  unsigned long result = ((tsbk >> shift) & bitmask).to_ulong();
-
-  // std::cout << "    " << std::dec<< shift << " " << tsbk.size() << " [ " <<
-  // mask << " ]  = " << result << " - " << ((tsbk >> shift) & bitmask) <<
-  // std::endl;
-  return result;
-}
-
-unsigned long P25Parser::bitset_shift_left_mask(boost::dynamic_bitset<> &tsbk, int shift, unsigned long long mask) {
-  boost::dynamic_bitset<> bitmask(tsbk.size(), mask);
-  unsigned long result = ((tsbk << shift) & bitmask).to_ulong();
-
-  // std::cout << "    " << std::dec<< shift << " " << tsbk.size() << " [ " <<
-  // mask << " ]  = " << result << " - " << ((tsbk >> shift) & bitmask) <<
-  // std::endl;
-  return result;
-}
-
-std::vector<TrunkMessage> P25Parser::decode_mbt_data(unsigned long opcode, boost::dynamic_bitset<> &header, boost::dynamic_bitset<> &mbt_data, unsigned long sa, unsigned long nac, int sys_num) {
-  std::vector<TrunkMessage> messages;
+void P25Parser::decode_mbt_data(unsigned long opcode, const P25_Mbt_Header &header, const P25_Mbt_Data &mbt_data, unsigned long sa, unsigned long nac, int sys_num, std::vector<TrunkMessage> &messages) {
   TrunkMessage message;
   std::ostringstream os;
 
@@ -187,18 +167,18 @@ std::vector<TrunkMessage> P25Parser::decode_mbt_data(unsigned long opcode, boost
 
   BOOST_LOG_TRIVIAL(debug) << "decode_mbt_data: $" << opcode;
   if (opcode == 0x0) { // grp voice channel grant
-    // unsigned long mfrid = bitset_shift_mask(header, 72, 0xff);
-    unsigned long ch1 = bitset_shift_mask(mbt_data, 64, 0xffff);
-    unsigned long ch2 = bitset_shift_mask(mbt_data, 48, 0xffff);
-    unsigned long ga = bitset_shift_mask(mbt_data, 32, 0xffff);
+    // unsigned long mfrid = header.field(72, 0xff);
+    unsigned long ch1 = mbt_data.field(64, 0xffff);
+    unsigned long ch2 = mbt_data.field(48, 0xffff);
+    unsigned long ga = mbt_data.field(32, 0xffff);
     unsigned long f1 = channel_id_to_frequency(ch1, sys_num);
     unsigned long f2 = channel_id_to_frequency(ch2, sys_num);
-    unsigned long sa = bitset_shift_mask(header, 48, 0xffffff);
-    bool emergency = (bool)bitset_shift_mask(header, 24, 0x80);
-    bool encrypted = (bool)bitset_shift_mask(header, 24, 0x40);
-    bool duplex = (bool)bitset_shift_mask(header, 24, 0x20);
-    bool mode = (bool)bitset_shift_mask(header, 24, 0x10);
-    int priority = bitset_shift_mask(header, 24, 0x07);
+    unsigned long sa = header.field(48, 0xffffff);
+    bool emergency = (bool)header.field(24, 0x80);
+    bool encrypted = (bool)header.field(24, 0x40);
+    bool duplex = (bool)header.field(24, 0x20);
+    bool mode = (bool)header.field(24, 0x10);
+    int priority = header.field(24, 0x07);
 
 
     message.message_type = GRANT;
@@ -219,15 +199,17 @@ std::vector<TrunkMessage> P25Parser::decode_mbt_data(unsigned long opcode, boost
       message.tdma_slot = 0;
     }
 
-    os << "mbt00\tChan Grant\tChannel 1 ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) <<  "\tChannel 2 ID: " << channel_to_string(ch2, sys_num) << "\tFreq: " << format_freq(f2) << "\tga " << std::setw(7) << ga << "\tTDMA " << get_tdma_slot(ch1, sys_num) << "\tsa " << sa << "\tEncrypt " << encrypted << "\tBandwidth: " << get_bandwidth(ch1, sys_num);
-    message.meta = os.str();
-    BOOST_LOG_TRIVIAL(debug) << os.str();
+    if (build_meta) {
+      os << "mbt00\tChan Grant\tChannel 1 ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) <<  "\tChannel 2 ID: " << channel_to_string(ch2, sys_num) << "\tFreq: " << format_freq(f2) << "\tga " << std::setw(7) << ga << "\tTDMA " << get_tdma_slot(ch1, sys_num) << "\tsa " << sa << "\tEncrypt " << encrypted << "\tBandwidth: " << get_bandwidth(ch1, sys_num);
+      message.meta = os.str();
+      BOOST_LOG_TRIVIAL(debug) << message.meta;
+    }
   } else if (opcode == 0x02) { // grp regroup voice channel grant
-    unsigned long mfrid = bitset_shift_mask(mbt_data, 168, 0xff);
+    unsigned long mfrid = mbt_data.field(168, 0xff);
     if (mfrid == 0x90) {  // MOT_GRG_CN_GRANT_EXP
-      unsigned long ch1 = bitset_shift_mask(mbt_data, 80, 0xffff);
-      unsigned long ch2 = bitset_shift_mask(mbt_data, 64, 0xffff);
-      unsigned long sg = bitset_shift_mask(mbt_data, 48, 0xffff);
+      unsigned long ch1 = mbt_data.field(80, 0xffff);
+      unsigned long ch2 = mbt_data.field(64, 0xffff);
+      unsigned long sg = mbt_data.field(48, 0xffff);
       unsigned long f1 = channel_id_to_frequency(ch1, sys_num);
       unsigned long f2 = channel_id_to_frequency(ch2, sys_num);
       message.message_type = GRANT;
@@ -242,43 +224,49 @@ std::vector<TrunkMessage> P25Parser::decode_mbt_data(unsigned long opcode, boost
         message.tdma_slot = 0;
       }
 
-      os << "mbt02\tmfid90_grg_cn_grant_exp\tChannel 1 ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) <<  "\tChannel 2 ID: " << channel_to_string(ch2, sys_num) << "\tFreq: " << format_freq(f2) << "\tsg " << std::setw(7) << sg << "\tTDMA " << get_tdma_slot(ch1, sys_num) << "\tBandwidth: " << get_bandwidth(ch1, sys_num);
-      message.meta = os.str();
-      BOOST_LOG_TRIVIAL(debug) << os.str();
+      if (build_meta) {
+        os << "mbt02\tmfid90_grg_cn_grant_exp\tChannel 1 ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) <<  "\tChannel 2 ID: " << channel_to_string(ch2, sys_num) << "\tFreq: " << format_freq(f2) << "\tsg " << std::setw(7) << sg << "\tTDMA " << get_tdma_slot(ch1, sys_num) << "\tBandwidth: " << get_bandwidth(ch1, sys_num);
+        message.meta = os.str();
+        BOOST_LOG_TRIVIAL(debug) << message.meta;
+      }
     }
   } else if (opcode == 0x028) { // grp_aff_rsp
-    unsigned long mfrid = bitset_shift_mask(mbt_data, 56, 0xff);
-    unsigned long wacn = (bitset_shift_left_mask(header, 4, 0xffff0) + bitset_shift_mask(mbt_data, 188, 0xf));
-    unsigned long syid = bitset_shift_mask(mbt_data, 176, 0xfff);
-    unsigned long gid = bitset_shift_mask(mbt_data, 160, 0xffff);
-    unsigned long ada = bitset_shift_mask(mbt_data, 144, 0xffff);
-    unsigned long ga = bitset_shift_mask(mbt_data, 128, 0xffff);
-    unsigned long lg = bitset_shift_mask(mbt_data, 127, 0x1);
-    unsigned long gav = bitset_shift_mask(mbt_data, 120, 0x3);
-
-      os << "mbt28\tmbt(0x28) grp_aff_rsp:\tMFRID: " << mfrid <<  "\tWACN: " <<  wacn << "\tSYID: " << syid << "\tLG: " << lg << "\tGAV: " << gav << "\tADA: " << ada << "\tGA: " << ga << "\tLG: " << lg << "\tGID: " << gid;
-      message.meta = os.str();
-      BOOST_LOG_TRIVIAL(debug) << os.str();
+    unsigned long mfrid = mbt_data.field(56, 0xff);
+    unsigned long wacn = (header.field_left(4, 0xffff0) + mbt_data.field(188, 0xf));
+    unsigned long syid = mbt_data.field(176, 0xfff);
+    unsigned long gid = mbt_data.field(160, 0xffff);
+    unsigned long ada = mbt_data.field(144, 0xffff);
+    unsigned long ga = mbt_data.field(128, 0xffff);
+    unsigned long lg = mbt_data.field(127, 0x1);
+    unsigned long gav = mbt_data.field(120, 0x3);
+
+      if (build_meta) {
+        os << "mbt28\tmbt(0x28) grp_aff_rsp:\tMFRID: " << mfrid <<  "\tWACN: " <<  wacn << "\tSYID: " << syid << "\tLG: " << lg << "\tGAV: " << gav << "\tADA: " << ada << "\tGA: " << ga << "\tLG: " << lg << "\tGID: " << gid;
+        message.meta = os.str();
+        BOOST_LOG_TRIVIAL(debug) << message.meta;
+      }
   } else if (opcode == 0x3a) { // rfss status
-    unsigned long syid = bitset_shift_mask(header, 48, 0xfff);
-    unsigned long rfid = bitset_shift_mask(mbt_data, 88, 0xff);
-    unsigned long stid = bitset_shift_mask(mbt_data, 80, 0xff);
-    unsigned long ch1 = bitset_shift_mask(mbt_data, 64, 0xffff);
-    // unsigned long ch2 = bitset_shift_mask(mbt_data, 48, 0xffff);
+    unsigned long syid = header.field(48, 0xfff);
+    unsigned long rfid = mbt_data.field(88, 0xff);
+    unsigned long stid = mbt_data.field(80, 0xff);
+    unsigned long ch1 = mbt_data.field(64, 0xffff);
+    // unsigned long ch2 = mbt_data.field(48, 0xffff);
     // unsigned long f1   = channel_id_to_frequency(ch1, sys_num);
     // unsigned long f2   = channel_id_to_frequency(ch2, sys_num);
     message.message_type = SYSID;
     message.sys_id = syid;
     message.sys_rfss = rfid;
     message.sys_site_id = stid;
-    os << "mbt3a rfss status: syid: " << syid << " rfid " << rfid << " stid " << stid << " ch1 " << channel_to_string(ch1, sys_num) << "(" << channel_id_to_freq_string(ch1, sys_num) << ")";
-    message.meta = os.str();
-    BOOST_LOG_TRIVIAL(debug) << os.str();
+    if (build_meta) {
+      os << "mbt3a rfss status: syid: " << syid << " rfid " << rfid << " stid " << stid << " ch1 " << channel_to_string(ch1, sys_num) << "(" << channel_id_to_freq_string(ch1, sys_num) << ")";
+      message.meta = os.str();
+      BOOST_LOG_TRIVIAL(debug) << message.meta;
+    }
   } else if (opcode == 0x3b) { // network status
-    unsigned long wacn = bitset_shift_mask(mbt_data, 76, 0xfffff);
-    unsigned long syid = bitset_shift_mask(header, 48, 0xfff);
-    unsigned long ch1 = bitset_shift_mask(mbt_data, 56, 0xffff);
-    unsigned long ch2 = bitset_shift_mask(mbt_data, 40, 0xffff);
+    unsigned long wacn = mbt_data.field(76, 0xfffff);
+    unsigned long syid = header.field(48, 0xfff);
+    unsigned long ch1 = mbt_data.field(56, 0xffff);
+    unsigned long ch2 = mbt_data.field(40, 0xffff);
     unsigned long f1 = channel_id_to_frequency(ch1, sys_num);
     unsigned long f2 = channel_id_to_frequency(ch2, sys_num);
 
@@ -290,24 +278,24 @@ std::vector<TrunkMessage> P25Parser::decode_mbt_data(unsigned long opcode, boost
     }
     BOOST_LOG_TRIVIAL(debug) << "mbt3b net stat: wacn " << std::dec << wacn << " syid " << syid << " ch1 " << channel_to_string(ch1, sys_num) << "(" << channel_id_to_freq_string(ch1, sys_num) << ") ";
   } else if (opcode == 0x3c) { // adjacent status
-    unsigned long syid = bitset_shift_mask(header, 48, 0xfff);
-    unsigned long rfid = bitset_shift_mask(header, 24, 0xff);
-    unsigned long stid = bitset_shift_mask(header, 16, 0xff);
-    unsigned long ch1 = bitset_shift_mask(mbt_data, 80, 0xffff);
-    unsigned long ch2 = bitset_shift_mask(mbt_data, 64, 0xffff);
+    unsigned long syid = header.field(48, 0xfff);
+    unsigned long rfid = header.field(24, 0xff);
+    unsigned long stid = header.field(16, 0xff);
+    unsigned long ch1 = mbt_data.field(80, 0xffff);
+    unsigned long ch2 = mbt_data.field(64, 0xffff);
     BOOST_LOG_TRIVIAL(debug) << "mbt3c adjacent status "
                              << "syid " << syid << " rfid " << rfid << " stid " << stid << " ch1 " << ch1 << " ch2 " << ch2;
   } else if (opcode == 0x04) { //  Unit to Unit Voice Service Channel Grant -Extended (UU_V_CH_GRANT)
-    // unsigned long mfrid = bitset_shift_mask(header, 80, 0xff);
-    bool emergency = (bool)bitset_shift_mask(header, 24, 0x80);
-    bool encrypted = (bool)bitset_shift_mask(header, 24, 0x40);
-    bool dup = (bool)bitset_shift_mask(header, 24, 0x20);
-    bool mod = (bool)bitset_shift_mask(header, 24, 0x10);
-    int pri = bitset_shift_mask(header, 24, 0x07);
-    unsigned long ch = bitset_shift_mask(header, 16, 0xffff); /// ????
+    // unsigned long mfrid = header.field(80, 0xff);
+    bool emergency = (bool)header.field(24, 0x80);
+    bool encrypted = (bool)header.field(24, 0x40);
+    bool dup = (bool)header.field(24, 0x20);
+    bool mod = (bool)header.field(24, 0x10);
+    int pri = header.field(24, 0x07);
+    unsigned long ch = header.field(16, 0xffff); /// ????
     unsigned long f = channel_id_to_frequency(ch, sys_num);
-    unsigned long sa = bitset_shift_mask(header, 48, 0xffffff);
-    unsigned long ta = bitset_shift_mask(mbt_data, 24, 0xffffff);
+    unsigned long sa = header.field(48, 0xffffff);
+    unsigned long ta = mbt_data.field(24, 0xffffff);
 
     message.message_type = UU_V_GRANT;
     message.freq = f;
@@ -329,20 +317,18 @@ std::vector<TrunkMessage> P25Parser::decode_mbt_data(unsigned long opcode, boost
     BOOST_LOG_TRIVIAL(debug) << "mbt04\tUnit to Unit Chan Grant\tChannel ID: " << channel_to_string(ch, sys_num) << "\tFreq: " << format_freq(f) << "\tTarget ID: " << std::setw(7) << ta << "\tTDMA " << get_tdma_slot(ch, sys_num) << "\tSource ID: " << sa;
   } else {
     BOOST_LOG_TRIVIAL(debug) << "mbt other: " << opcode;
-    return messages;
+    return;
   }
   messages.push_back(message);
-  return messages;
 }
 
-std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk, unsigned long nac, int sys_num) {
+void P25Parser::decode_tsbk(const P25_Tsbk &tsbk, unsigned long nac, int sys_num, std::vector<TrunkMessage> &messages) {
   // self.stats['tsbks'] += 1
-  std::vector<TrunkMessage> messages;
   TrunkMessage message;
   std::ostringstream os;
 
   // TSBK is shifted 16 prior for the missing CRC prior to this function
-  unsigned long opcode = bitset_shift_mask(tsbk, 88, 0x3f); // x3f
+  unsigned long opcode = tsbk.field(88, 0x3f); // x3f
 
   message.message_type = UNKNOWN;
   message.source = -1;
@@ -369,13 +355,13 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
   if (opcode == 0x00) { // group voice chan grant
     // Group Voice Channel Grant (GRP_V_CH_GRANT)
 
-    unsigned long mfrid = bitset_shift_mask(tsbk, 80, 0xff);
+    unsigned long mfrid = tsbk.field(80, 0xff);
 
     if (mfrid == 0x90) { // MOT_GRG_ADD_CMD
-      unsigned long sg = bitset_shift_mask(tsbk, 64, 0xffff);
-      unsigned long ga1 = bitset_shift_mask(tsbk, 48, 0xffff);
-      unsigned long ga2 = bitset_shift_mask(tsbk, 32, 0xffff);
-      unsigned long ga3 = bitset_shift_mask(tsbk, 16, 0xffff);
+      unsigned long sg = tsbk.field(64, 0xffff);
+      unsigned long ga1 = tsbk.field(48, 0xffff);
+      unsigned long ga2 = tsbk.field(32, 0xffff);
+      unsigned long ga3 = tsbk.field(16, 0xffff);
       BOOST_LOG_TRIVIAL(debug) << "tsbk00\tMoto Patch Add \tsg: " << sg << "\tga1: " << ga1 << "\tga2: " << ga2 << "\tga3: " << ga3;
       message.message_type = PATCH_ADD;
       PatchData moto_patch_data;
@@ -385,15 +371,15 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
       moto_patch_data.ga3 = ga3;
       message.patch_data = moto_patch_data;
     } else {
-      // unsigned long opts  = bitset_shift_mask(tsbk, 72, 0xff); // not required for anything 
-      bool emergency = (bool)bitset_shift_mask(tsbk, 72, 0x80);
-      bool encrypted = (bool)bitset_shift_mask(tsbk, 72, 0x40);
-      bool duplex = (bool)bitset_shift_mask(tsbk, 72, 0x20);
-      bool mode = (bool)bitset_shift_mask(tsbk, 72, 0x10);
-      int priority = bitset_shift_mask(tsbk, 72, 0x07);
-      unsigned long ch = bitset_shift_mask(tsbk, 56, 0xffff);
-      unsigned long ga = bitset_shift_mask(tsbk, 40, 0xffff);
-      unsigned long sa = bitset_shift_mask(tsbk, 16, 0xffffff);
+      // unsigned long opts  = tsbk.field(72, 0xff); // not required for anything 
+      bool emergency = (bool)tsbk.field(72, 0x80);
+      bool encrypted = (bool)tsbk.field(72, 0x40);
+      bool duplex = (bool)tsbk.field(72, 0x20);
+      bool mode = (bool)tsbk.field(72, 0x10);
+      int priority = tsbk.field(72, 0x07);
+      unsigned long ch = tsbk.field(56, 0xffff);
+      unsigned long ga = tsbk.field(40, 0xffff);
+      unsigned long sa = tsbk.field(16, 0xffffff);
       unsigned long f1 = channel_id_to_frequency(ch, sys_num);
       message.message_type = GRANT;
       message.freq = f1;
@@ -412,26 +398,28 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
         message.phase2_tdma = false;
         message.tdma_slot = 0;
       }
-      os << "tsbk00\tChan Grant\tChannel ID: " << channel_to_string(ch, sys_num) << "\tFreq: " << format_freq(f1) << "\tga " << std::setw(7) << ga << "\tTDMA " << get_tdma_slot(ch, sys_num) << "\tsa " << sa << "\tEncrypt " << encrypted << "\tBandwidth: " << get_bandwidth(ch, sys_num);
-      message.meta = os.str();
-      BOOST_LOG_TRIVIAL(debug) << os.str();
+      if (build_meta) {
+        os << "tsbk00\tChan Grant\tChannel ID: " << channel_to_string(ch, sys_num) << "\tFreq: " << format_freq(f1) << "\tga " << std::setw(7) << ga << "\tTDMA " << get_tdma_slot(ch, sys_num) << "\tsa " << sa << "\tEncrypt " << encrypted << "\tBandwidth: " << get_bandwidth(ch, sys_num);
+        message.meta = os.str();
+        BOOST_LOG_TRIVIAL(debug) << message.meta;
+      }
     }
   } else if (opcode == 0x02) { // group voice chan grant update
-    unsigned long mfrid = bitset_shift_mask(tsbk, 80, 0xff);
+    unsigned long mfrid = tsbk.field(80, 0xff);
     // Group Voice Channel Grant Update (GRP_V_CH_GRANT_UPDT) : TIA.102-AABC-B-2005 page 34
     // Options are not present in an UPDATE
 
     if (mfrid == 0x90) {
-        // unsigned long opts = bitset_shift_mask(tsbk, 72, 0xff);  // not required for anything
-        bool emergency = (bool)bitset_shift_mask(tsbk, 72, 0x80);
-        bool encrypted = (bool)bitset_shift_mask(tsbk, 72, 0x40);
-        bool duplex = (bool)bitset_shift_mask(tsbk, 72, 0x20);
-        bool mode = (bool)bitset_shift_mask(tsbk, 72, 0x10);
-        int priority = bitset_shift_mask(tsbk, 72, 0x07);
+        // unsigned long opts = tsbk.field(72, 0xff);  // not required for anything
+        bool emergency = (bool)tsbk.field(72, 0x80);
+        bool encrypted = (bool)tsbk.field(72, 0x40);
+        bool duplex = (bool)tsbk.field(72, 0x20);
+        bool mode = (bool)tsbk.field(72, 0x10);
+        int priority = tsbk.field(72, 0x07);
         
-        unsigned long ch = bitset_shift_mask(tsbk, 56, 0xffff);
-        unsigned long sg = bitset_shift_mask(tsbk, 40, 0xffff);
-        unsigned long sa = bitset_shift_mask(tsbk, 16, 0xffffff);
+        unsigned long ch = tsbk.field(56, 0xffff);
+        unsigned long sg = tsbk.field(40, 0xffff);
+        unsigned long sa = tsbk.field(16, 0xffffff);
         unsigned long f = channel_id_to_frequency(ch, sys_num);
 
         message.message_type = GRANT;
@@ -453,14 +441,16 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
         message.tdma_slot = 0;
       }
 
-      os << "tsbk02\tMOTOROLA_OSP_PATCH_GROUP_CHANNEL_GRANT\tChannel ID: " << channel_to_string(ch, sys_num) << "\tFreq: " << format_freq(f) << "\tsg " << std::setw(7) << sg << "\tTDMA " << get_tdma_slot(ch, sys_num) << "\tsa " << sa;
-      message.meta = os.str();
-      BOOST_LOG_TRIVIAL(debug) << os.str();
+      if (build_meta) {
+        os << "tsbk02\tMOTOROLA_OSP_PATCH_GROUP_CHANNEL_GRANT\tChannel ID: " << channel_to_string(ch, sys_num) << "\tFreq: " << format_freq(f) << "\tsg " << std::setw(7) << sg << "\tTDMA " << get_tdma_slot(ch, sys_num) << "\tsa " << sa;
+        message.meta = os.str();
+        BOOST_LOG_TRIVIAL(debug) << message.meta;
+      }
     } else {
-      unsigned long ch1 = bitset_shift_mask(tsbk, 64, 0xffff);
-      unsigned long ga1 = bitset_shift_mask(tsbk, 48, 0xffff);
-      unsigned long ch2 = bitset_shift_mask(tsbk, 32, 0xffff);
-      unsigned long ga2 = bitset_shift_mask(tsbk, 16, 0xffff);
+      unsigned long ch1 = tsbk.field(64, 0xffff);
+      unsigned long ga1 = tsbk.field(48, 0xffff);
+      unsigned long ch2 = tsbk.field(32, 0xffff);
+      unsigned long ga2 = tsbk.field(16, 0xffff);
       unsigned long f1 = channel_id_to_frequency(ch1, sys_num);
       unsigned long f2 = channel_id_to_frequency(ch2, sys_num);
 
@@ -489,25 +479,27 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
           message.tdma_slot = 0;
         }
 
-        os << "tsbk02\tGrant Update 2nd\tChannel ID: " << channel_to_string(ch2, sys_num) << "\tFreq: " << format_freq(f2) << "\tga " << std::setw(7) << ga2 << "\tTDMA " << get_tdma_slot(ch2, sys_num) << " | ";
-
+        if (build_meta) {
+          os << "tsbk02\tGrant Update 2nd\tChannel ID: " << channel_to_string(ch2, sys_num) << "\tFreq: " << format_freq(f2) << "\tga " << std::setw(7) << ga2 << "\tTDMA " << get_tdma_slot(ch2, sys_num) << " | ";
+          message.meta = os.str();
+        }
+      }
+      if (build_meta) {
+        os << "tsbk02\tGrant Update\tChannel ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) << "\tga " << std::setw(7) << ga1 << "\tTDMA " << get_tdma_slot(ch1, sys_num);
         message.meta = os.str();
-        
+        BOOST_LOG_TRIVIAL(debug) << message.meta;
       }
-      os << "tsbk02\tGrant Update\tChannel ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) << "\tga " << std::setw(7) << ga1 << "\tTDMA " << get_tdma_slot(ch1, sys_num);
-      message.meta = os.str();
-      BOOST_LOG_TRIVIAL(debug) << os.str();
     }
   } else if (opcode == 0x03) { //  Group Voice Channel Update-Explicit (GRP_V_CH_GRANT_UPDT_EXP)
     // group voice chan grant update exp : TIA.102-AABC-B-2005 page 56
-    unsigned long mfrid = bitset_shift_mask(tsbk, 80, 0xff);
+    unsigned long mfrid = tsbk.field(80, 0xff);
 
     if (mfrid == 0x90) { // MOT_GRG_CN_GRANT_UPDT  // MOTOROLA_OSP_PATCH_GROUP_CHANNEL_GRANT_UPDATE // Service Options are not in the Moto version of the message
 
-      unsigned long ch1 = bitset_shift_mask(tsbk, 64, 0xffff);
-      unsigned long sg1 = bitset_shift_mask(tsbk, 48, 0xffff);
-      unsigned long ch2 = bitset_shift_mask(tsbk, 32, 0xffff);
-      unsigned long sg2 = bitset_shift_mask(tsbk, 16, 0xffff);
+      unsigned long ch1 = tsbk.field(64, 0xffff);
+      unsigned long sg1 = tsbk.field(48, 0xffff);
+      unsigned long ch2 = tsbk.field(32, 0xffff);
+      unsigned long sg2 = tsbk.field(16, 0xffff);
 
       unsigned long f1 = channel_id_to_frequency(ch1, sys_num);
       unsigned long f2 = channel_id_to_frequency(ch2, sys_num);
@@ -535,23 +527,27 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
           message.phase2_tdma = false;
           message.tdma_slot = 0;
         }
-        os << "MOTOROLA_OSP_PATCH_GROUP_CHANNEL_GRANT_UPDATE(0x03): \tChannel ID: " << channel_to_string(ch2, sys_num) << "\tFreq: " << format_freq(f2) << "\tsg " << std::setw(7) << sg2 << "\tTDMA " << get_tdma_slot(ch2, sys_num);
+        if (build_meta) {
+          os << "MOTOROLA_OSP_PATCH_GROUP_CHANNEL_GRANT_UPDATE(0x03): \tChannel ID: " << channel_to_string(ch2, sys_num) << "\tFreq: " << format_freq(f2) << "\tsg " << std::setw(7) << sg2 << "\tTDMA " << get_tdma_slot(ch2, sys_num);
+          message.meta = os.str();
+          BOOST_LOG_TRIVIAL(debug) << message.meta;
+        }
+      }
+      if (build_meta) {
+        os << "MOTOROLA_OSP_PATCH_GROUP_CHANNEL_GRANT_UPDATE(0x03): \tChannel ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) << "\tsg " << std::setw(7) << sg1 << "\tTDMA " << get_tdma_slot(ch1, sys_num);
         message.meta = os.str();
-        BOOST_LOG_TRIVIAL(debug) << os.str();
+        BOOST_LOG_TRIVIAL(debug) << message.meta;
       }
-      os << "MOTOROLA_OSP_PATCH_GROUP_CHANNEL_GRANT_UPDATE(0x03): \tChannel ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) << "\tsg " << std::setw(7) << sg1 << "\tTDMA " << get_tdma_slot(ch1, sys_num);
-      message.meta = os.str();
-      BOOST_LOG_TRIVIAL(debug) << os.str();
     } else {
-      bool emergency = (bool)bitset_shift_mask(tsbk, 72, 0x80);
-      bool encrypted = (bool)bitset_shift_mask(tsbk, 72, 0x40);
-      // bool duplex = (bool)bitset_shift_mask(tsbk, 72, 0x20);
-      // bool mode = (bool)bitset_shift_mask(tsbk, 72, 0x10);
-      // int priority = bitset_shift_mask(tsbk, 72, 0x07);
-
-      unsigned long ch1 = bitset_shift_mask(tsbk, 48, 0xffff);
-      // unsigned long ch2 = bitset_shift_mask(tsbk, 32, 0xffff);
-      unsigned long ga1 = bitset_shift_mask(tsbk, 16, 0xffff);
+      bool emergency = (bool)tsbk.field(72, 0x80);
+      bool encrypted = (bool)tsbk.field(72, 0x40);
+      // bool duplex = (bool)tsbk.field(72, 0x20);
+      // bool mode = (bool)tsbk.field(72, 0x10);
+      // int priority = tsbk.field(72, 0x07);
+
+      unsigned long ch1 = tsbk.field(48, 0xffff);
+      // unsigned long ch2 = tsbk.field(32, 0xffff);
+      unsigned long ga1 = tsbk.field(16, 0xffff);
       unsigned long f1 = channel_id_to_frequency(ch1, sys_num);
       // unsigned long f2 = channel_id_to_frequency(ch2, sys_num);
 
@@ -568,22 +564,24 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
         message.tdma_slot = 0;
       }
 
-      os << "tsbk03\tExplicit Grant Update\tTX Channel ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) << "\tFNE TX Channel ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) << "\tga " << std::setw(7) << ga1 << "\tTDMA " << get_tdma_slot(ch1, sys_num);
-      message.meta = os.str();
-      BOOST_LOG_TRIVIAL(debug) << os.str();
+      if (build_meta) {
+        os << "tsbk03\tExplicit Grant Update\tTX Channel ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) << "\tFNE TX Channel ID: " << channel_to_string(ch1, sys_num) << "\tFreq: " << format_freq(f1) << "\tga " << std::setw(7) << ga1 << "\tTDMA " << get_tdma_slot(ch1, sys_num);
+        message.meta = os.str();
+        BOOST_LOG_TRIVIAL(debug) << message.meta;
+      }
     }
   } else if (opcode == 0x04) { //  Unit to Unit Voice Service Channel Grant (UU_V_CH_GRANT)
-                               // unsigned long mfrid = bitset_shift_mask(tsbk, 80, 0xff);
-    // unsigned long opts  = bitset_shift_mask(tsbk,72,0xff);
-    bool emergency = (bool)bitset_shift_mask(tsbk, 72, 0x80);
-    bool encrypted = (bool)bitset_shift_mask(tsbk, 72, 0x40);
-    bool duplex = (bool)bitset_shift_mask(tsbk, 72, 0x20);
-    bool mode = (bool)bitset_shift_mask(tsbk, 72, 0x10);
-    int priority = bitset_shift_mask(tsbk, 72, 0x07);
-    unsigned long ch = bitset_shift_mask(tsbk, 64, 0xffff);
+                               // unsigned long mfrid = tsbk.field(80, 0xff);
+    // unsigned long opts  = tsbk.field(72,0xff);
+    bool emergency = (bool)tsbk.field(72, 0x80);
+    bool encrypted = (bool)tsbk.field(72, 0x40);
+    bool duplex = (bool)tsbk.field(72, 0x20);
+    bool mode = (bool)tsbk.field(72, 0x10);
+    int priority = tsbk.field(72, 0x07);
+    unsigned long ch = tsbk.field(64, 0xffff);
     unsigned long f = channel_id_to_frequency(ch, sys_num);
-    unsigned long sa = bitset_shift_mask(tsbk, 16, 0xffffff);
-    unsigned long ta = bitset_shift_mask(tsbk, 40, 0xffffff);
+    unsigned long sa = tsbk.field(16, 0xffffff);
+    unsigned long ta = tsbk.field(40, 0xffffff);
 
     message.message_type = UU_V_GRANT;
     message.freq = f;
@@ -604,19 +602,21 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
 
     BOOST_LOG_TRIVIAL(debug) << "tsbk04\tUnit to Unit Chan Grant\tChannel ID: " << channel_to_string(ch, sys_num) << "\tFreq: " << format_freq(f) << "\tTarget ID: " << std::setw(7) << ta << "\tTDMA " << get_tdma_slot(ch, sys_num) << "\tSource ID: " << sa;
   } else if (opcode == 0x05) { // Unit To Unit Answer Request
-    unsigned long mfrid = bitset_shift_mask(tsbk, 80, 0xff);
+    unsigned long mfrid = tsbk.field(80, 0xff);
     if (mfrid == 0x90) { // MOTOROLA_OSP_TRAFFIC_CHANNEL_ID
-      os << "MOTOROLA_OSP_TRAFFIC_CHANNEL_ID(0x05):";
-      message.meta = os.str();
-      BOOST_LOG_TRIVIAL(debug) << os.str();
+      if (build_meta) {
+        os << "MOTOROLA_OSP_TRAFFIC_CHANNEL_ID(0x05):";
+        message.meta = os.str();
+        BOOST_LOG_TRIVIAL(debug) << message.meta;
+      }
     } else {
-      bool emergency = (bool)bitset_shift_mask(tsbk, 72, 0x80);
-      bool encrypted = (bool)bitset_shift_mask(tsbk, 72, 0x40);
-      bool duplex = (bool)bitset_shift_mask(tsbk, 72, 0x20);
-      bool mode = (bool)bitset_shift_mask(tsbk, 72, 0x10);
-      int priority = bitset_shift_mask(tsbk, 72, 0x07);
-      unsigned long sa = bitset_shift_mask(tsbk, 16, 0xffffff);
-      unsigned long si = bitset_shift_mask(tsbk, 40, 0xffffff);
+      bool emergency = (bool)tsbk.field(72, 0x80);
+      bool encrypted = (bool)tsbk.field(72, 0x40);
+      bool duplex = (bool)tsbk.field(72, 0x20);
+      bool mode = (bool)tsbk.field(72, 0x10);
+      int priority = tsbk.field(72, 0x07);
+      unsigned long sa = tsbk.field(16, 0xffffff);
+      unsigned long si = tsbk.field(40, 0xffffff);
 
       message.message_type = UU_ANS_REQ;
       message.emergency = emergency;
@@ -630,14 +630,14 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
       BOOST_LOG_TRIVIAL(debug) << "tsbk05\tUnit To Unit Answer Request\tsa " << sa << "\tSource ID: " << si;
     }
   } else if (opcode == 0x06) { //  Unit to Unit Voice Channel Grant Update (UU_V_CH_GRANT_UPDT)
-    // unsigned long mfrid = bitset_shift_mask(tsbk, 80, 0xff);
-    //  unsigned long opts  = bitset_shift_mask(tsbk,72,0xff);
+    // unsigned long mfrid = tsbk.field(80, 0xff);
+    //  unsigned long opts  = tsbk.field(72,0xff);
 
 
-    unsigned long ch = bitset_shift_mask(tsbk, 64, 0xffff);
+    unsigned long ch = tsbk.field(64, 0xffff);
     unsigned long f = channel_id_to_frequency(ch, sys_num);
-    unsigned long sa = bitset_shift_mask(tsbk, 16, 0xffffff);
-    unsigned long ta = bitset_shift_mask(tsbk, 40, 0xffffff);
+    unsigned long sa = tsbk.field(16, 0xffffff);
+    unsigned long ta = tsbk.field(40, 0xffffff);
 
     message.message_type = UU_V_UPDATE;
     message.freq = f;
@@ -655,29 +655,31 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
   } else if (opcode == 0x08) {
     BOOST_LOG_TRIVIAL(debug) << "tsbk08: Telephone Interconnect Voice Channel Grant";
   } else if (opcode == 0x09) {
-    unsigned long mfrid = bitset_shift_mask(tsbk, 80, 0xff);
+    unsigned long mfrid = tsbk.field(80, 0xff);
     if (mfrid == 0x90) { // MOTOROLA_OSP_SYSTEM_LOADING
-      unsigned long mk = bitset_shift_mask(tsbk, 76, 0xf);
-      unsigned long ms = bitset_shift_mask(tsbk, 70, 0xff);
-      unsigned long value = bitset_shift_mask(tsbk, 64, 0xffff);
+      unsigned long mk = tsbk.field(76, 0xf);
+      unsigned long ms = tsbk.field(70, 0xff);
+      unsigned long value = tsbk.field(64, 0xffff);
       
-      os << "MOTOROLA_OSP_SYSTEM_LOADING(0x09): \tScan Marker: " <<  std::dec << mk << std::setw(4) << ms << " microslots (" << std::hex << std::setfill('0') << std::setw(4) << value << ")";
-      message.meta = os.str();
-      BOOST_LOG_TRIVIAL(debug) << os.str();
+      if (build_meta) {
+        os << "MOTOROLA_OSP_SYSTEM_LOADING(0x09): \tScan Marker: " <<  std::dec << mk << std::setw(4) << ms << " microslots (" << std::hex << std::setfill('0') << std::setw(4) << value << ")";
+        message.meta = os.str();
+        BOOST_LOG_TRIVIAL(debug) << message.meta;
+      }
     } else {
       BOOST_LOG_TRIVIAL(debug) << "tsbk09: Telephone Interconnect Voice Channel Grant Update";
     }
   } else if (opcode == 0x0a) {
     BOOST_LOG_TRIVIAL(debug) << "tsbk0a: Telephone Interconnect Answer Request";
   } else if (opcode == 0x14) {
-    bool emergency = (bool)bitset_shift_mask(tsbk, 72, 0x80);
-    bool encrypted = (bool)bitset_shift_mask(tsbk, 72, 0x40);
-    bool duplex = (bool)bitset_shift_mask(tsbk, 72, 0x20);
-    bool mode = (bool)bitset_shift_mask(tsbk, 72, 0x10);
-    unsigned long nsapi = bitset_shift_mask(tsbk, 72, 0xf);
-    unsigned long chT = bitset_shift_mask(tsbk, 56, 0xffff);
-    unsigned long chR = bitset_shift_mask(tsbk, 40, 0xffff);
-    unsigned long sa = bitset_shift_mask(tsbk, 16, 0xffffff);
+    bool emergency = (bool)tsbk.field(72, 0x80);
+    bool encrypted = (bool)tsbk.field(72, 0x40);
+    bool duplex = (bool)tsbk.field(72, 0x20);
+    bool mode = (bool)tsbk.field(72, 0x10);
+    unsigned long nsapi = tsbk.field(72, 0xf);
+    unsigned long chT = tsbk.field(56, 0xffff);
+    unsigned long chR = tsbk.field(40, 0xffff);
+    unsigned long sa = tsbk.field(16, 0xffffff);
     unsigned long fT = channel_id_to_frequency(chT, sys_num);
     unsigned long fR = channel_id_to_frequency(chR, sys_num);
 
@@ -705,10 +707,10 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
   } else if (opcode == 0x1f) {
     BOOST_LOG_TRIVIAL(debug) << "tsbk1f: Call Alert";
   } else if (opcode == 0x20) { // Acknowledge response
-    // unsigned long mfrid  = bitset_shift_mask(tsbk,80,0xff);
-    unsigned long ga = bitset_shift_mask(tsbk, 40, 0xffff);
-    unsigned long op = bitset_shift_mask(tsbk, 48, 0xff);
-    unsigned long sa = bitset_shift_mask(tsbk, 16, 0xffffff);
+    // unsigned long mfrid  = tsbk.field(80,0xff);
+    unsigned long ga = tsbk.field(40, 0xffff);
+    unsigned long op = tsbk.field(48, 0xff);
+    unsigned long sa = tsbk.field(16, 0xffffff);
 
     message.message_type = ACKNOWLEDGE;
     message.talkgroup = ga;
@@ -722,11 +724,11 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
   } else if (opcode == 0x27) {
     BOOST_LOG_TRIVIAL(debug) << "tsbk27: Deny Response";
   } else if (opcode == 0x28) { // Unit Group Affiliation Response
-    // unsigned long mfrid  = bitset_shift_mask(tsbk,80,0xff);
-    // unsigned long opts  = bitset_shift_mask(tsbk,72,0xff);
-    unsigned long ta = bitset_shift_mask(tsbk, 16, 0xffffff);
-    unsigned long ga = bitset_shift_mask(tsbk, 40, 0xffff);
-    unsigned long aga = bitset_shift_mask(tsbk, 56, 0xffff);
+    // unsigned long mfrid  = tsbk.field(80,0xff);
+    // unsigned long opts  = tsbk.field(72,0xff);
+    unsigned long ta = tsbk.field(16, 0xffffff);
+    unsigned long ga = tsbk.field(40, 0xffff);
+    unsigned long aga = tsbk.field(56, 0xffff);
 
     message.message_type = AFFILIATION;
     message.source = ta;
@@ -734,10 +736,10 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
 
     BOOST_LOG_TRIVIAL(debug) << "tsbk2f\tUnit Group Affiliation\tSource ID: " << std::setw(7) << ta << "\tGroup Address: " << std::dec << ga << "\tAnouncement Goup: " << aga;
   } else if (opcode == 0x29) { // Secondary Control Channel Broadcast - Explicit
-    unsigned long rfid = bitset_shift_mask(tsbk, 72, 0xff);
-    unsigned long stid = bitset_shift_mask(tsbk, 64, 0xff);
-    unsigned long ch1 = bitset_shift_mask(tsbk, 48, 0xffff);
-    unsigned long ch2 = bitset_shift_mask(tsbk, 24, 0xffff);
+    unsigned long rfid = tsbk.field(72, 0xff);
+    unsigned long stid = tsbk.field(64, 0xff);
+    unsigned long ch1 = tsbk.field(48, 0xffff);
+    unsigned long ch2 = tsbk.field(24, 0xffff);
     unsigned long f1 = channel_id_to_frequency(ch1, sys_num);
     unsigned long f2 = channel_id_to_frequency(ch2, sys_num);
 
@@ -752,18 +754,19 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
 
       // message.sys_id = syid;
     }
-    os << "tsbk29 secondary cc: rfid " << std::dec << rfid << " stid " << stid << " ch1 " << ch1 << "(" << channel_id_to_freq_string(ch1, sys_num) << ") ch2 " << channel_to_string(ch2, sys_num) << "(" << channel_id_to_freq_string(ch2, sys_num) << ") ";
-
-    message.meta = os.str();
-    BOOST_LOG_TRIVIAL(debug) << os.str();
+    if (build_meta) {
+      os << "tsbk29 secondary cc: rfid " << std::dec << rfid << " stid " << stid << " ch1 " << ch1 << "(" << channel_id_to_freq_string(ch1, sys_num) << ") ch2 " << channel_to_string(ch2, sys_num) << "(" << channel_id_to_freq_string(ch2, sys_num) << ") ";
+      message.meta = os.str();
+      BOOST_LOG_TRIVIAL(debug) << message.meta;
+    }
 
   } else if (opcode == 0x2a) { // Group Affiliation Query
     BOOST_LOG_TRIVIAL(debug) << "tsbk2a Group Affiliation Query";
   } else if (opcode == 0x2b) { // Location Registration Response
-    // unsigned long mfrid  = bitset_shift_mask(tsbk,80,0xff);
-    unsigned long ga = bitset_shift_mask(tsbk, 56, 0xffff);
-    unsigned long rv = bitset_shift_mask(tsbk, 72, 0x03);
-    unsigned long sa = bitset_shift_mask(tsbk, 16, 0xffffff);
+    // unsigned long mfrid  = tsbk.field(80,0xff);
+    unsigned long ga = tsbk.field(56, 0xffff);
+    unsigned long rv = tsbk.field(72, 0x03);
+    unsigned long sa = tsbk.field(16, 0xffffff);
 
     message.message_type = LOCATION;
     message.talkgroup = ga;
@@ -771,10 +774,10 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
 
     BOOST_LOG_TRIVIAL(debug) << "tsbk2b\tLocation Registration Response\tga " << std::dec << ga << "\tsa " << sa << "\tValue: " << rv;
   } else if (opcode == 0x2c) { // Unit Registration Response
-    // unsigned long mfrid  = bitset_shift_mask(tsbk,80,0xff);
-    // unsigned long opts  = bitset_shift_mask(tsbk,72,0xff);
-    unsigned long sa = bitset_shift_mask(tsbk, 16, 0xffffff);
-    unsigned long si = bitset_shift_mask(tsbk, 40, 0xffffff);
+    // unsigned long mfrid  = tsbk.field(80,0xff);
+    // unsigned long opts  = tsbk.field(72,0xff);
+    unsigned long sa = tsbk.field(16, 0xffffff);
+    unsigned long si = tsbk.field(40, 0xffffff);
 
     message.message_type = REGISTRATION;
     message.source = si;
@@ -785,24 +788,24 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
   } else if (opcode == 0x2e) { //
     BOOST_LOG_TRIVIAL(debug) << "tsbk2e DE-REGISTRATION ACKNOWLEDGE";
   } else if (opcode == 0x2f) { // Unit DeRegistration Ack
-    // unsigned long mfrid  = bitset_shift_mask(tsbk,80,0xff);
-    // unsigned long opts  = bitset_shift_mask(tsbk,72,0xff);
-    unsigned long si = bitset_shift_mask(tsbk, 16, 0xffffff);
+    // unsigned long mfrid  = tsbk.field(80,0xff);
+    // unsigned long opts  = tsbk.field(72,0xff);
+    unsigned long si = tsbk.field(16, 0xffffff);
 
     message.message_type = DEREGISTRATION;
     message.source = si;
 
     BOOST_LOG_TRIVIAL(debug) << "tsbk2f\tUnit Deregistration ACK\tSource ID: " << std::setw(7) << si;
   } else if (opcode == 0x30) {
-    unsigned long mfrid = bitset_shift_mask(tsbk, 80, 0xff);
+    unsigned long mfrid = tsbk.field(80, 0xff);
     if (mfrid == 0xA4) { // GRG_EXENC_CMD (M/A-COM patch)
-      // unsigned long grg_t = bitset_shift_mask(tsbk, 79, 0x1);
-      unsigned long grg_g = bitset_shift_mask(tsbk, 28, 0x1);
-      unsigned long grg_a = bitset_shift_mask(tsbk, 77, 0x01);
-      // unsigned long grg_ssn = bitset_shift_mask(tsbk, 72, 0x1f);  //TODO: SSN should be stored and checked
-      unsigned long sg = bitset_shift_mask(tsbk, 56, 0xffff);
-      // unsigned long keyid = bitset_shift_mask(tsbk, 40, 0xffff);
-      unsigned long rta = bitset_shift_mask(tsbk, 16, 0xffffff);
+      // unsigned long grg_t = tsbk.field(79, 0x1);
+      unsigned long grg_g = tsbk.field(28, 0x1);
+      unsigned long grg_a = tsbk.field(77, 0x01);
+      // unsigned long grg_ssn = tsbk.field(72, 0x1f);  //TODO: SSN should be stored and checked
+      unsigned long sg = tsbk.field(56, 0xffff);
+      // unsigned long keyid = tsbk.field(40, 0xffff);
+      unsigned long rta = tsbk.field(16, 0xffffff);
       // unsigned long algid = (rta >> 16) & 0xff;
       unsigned long ga = rta & 0xffff;
       if (grg_a == 1) {   // Activate
@@ -854,44 +857,48 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
   } else if (opcode == 0x32) { //
     BOOST_LOG_TRIVIAL(debug) << "tsbk32 AUTHENTICATION RESPONSE";
   } else if (opcode == 0x33) { // iden_up_tdma
-    unsigned long mfrid = bitset_shift_mask(tsbk, 80, 0xff);
+    unsigned long mfrid = tsbk.field(80, 0xff);
 
     if (mfrid == 0) {
-      unsigned long iden = bitset_shift_mask(tsbk, 76, 0xf);
-      unsigned long channel_type = bitset_shift_mask(tsbk, 72, 0xf);
-      unsigned long toff0 = bitset_shift_mask(tsbk, 58, 0x3fff);
-      unsigned long spac = bitset_shift_mask(tsbk, 48, 0x3ff);
+      unsigned long iden = tsbk.field(76, 0xf);
+      unsigned long channel_type = tsbk.field(72, 0xf);
+      unsigned long toff0 = tsbk.field(58, 0x3fff);
+      unsigned long spac = tsbk.field(48, 0x3ff);
       unsigned long toff_sign = (toff0 >> 13) & 1;
       long toff = toff0 & 0x1fff;
 
       if (toff_sign == 0) {
         toff = 0 - toff;
       }
-      unsigned long f1 = bitset_shift_mask(tsbk, 16, 0xffffffff);
+      unsigned long f1 = tsbk.field(16, 0xffffffff);
       int slots_per_carrier[] = {1, 1, 1, 2, 4, 2};
       bool chan_tdma;
-      if (slots_per_carrier[channel_type] > 1) {
-        chan_tdma = true;
+      if (channel_type >= sizeof(slots_per_carrier) / sizeof(slots_per_carrier[0])) {
+        BOOST_LOG_TRIVIAL(debug) << "tsbk33 iden up tdma id " << std::dec << iden << " unknown channel type " << channel_type;
       } else {
-        chan_tdma = false;
+        if (slots_per_carrier[channel_type] > 1) {
+          chan_tdma = true;
+        } else {
+          chan_tdma = false;
+        }
+        Freq_Table temp_table = {
+            iden,              // id;
+            toff * spac * 125, // offset;
+            spac * 125,        // step;
+            f1 * 5,            // frequency;
+            chan_tdma,
+            slots_per_carrier[channel_type], // tdma;
+            6.25};
+        add_freq_table(iden, temp_table, sys_num);
+        BOOST_LOG_TRIVIAL(debug) << "tsbk33 iden up tdma id " << std::dec << iden << " f " << temp_table.frequency << " offset " << temp_table.offset << " spacing " << temp_table.step << " slots/carrier " << temp_table.slots_per_carrier;
       }
-      Freq_Table temp_table = {
-          iden,              // id;
-          toff * spac * 125, // offset;
-          spac * 125,        // step;
-          f1 * 5,            // frequency;
-          chan_tdma,
-          slots_per_carrier[channel_type], // tdma;
-          6.25};
-      add_freq_table(iden, temp_table, sys_num);
-      BOOST_LOG_TRIVIAL(debug) << "tsbk33 iden up tdma id " << std::dec << iden << " f " << temp_table.frequency << " offset " << temp_table.offset << " spacing " << temp_table.step << " slots/carrier " << temp_table.slots_per_carrier;
     }
   } else if (opcode == 0x34) { // iden_up vhf uhf
-    unsigned long iden = bitset_shift_mask(tsbk, 76, 0xf);
-    unsigned long bwvu = bitset_shift_mask(tsbk, 72, 0xf);
-    unsigned long toff0 = bitset_shift_mask(tsbk, 58, 0x3fff);
-    unsigned long spac = bitset_shift_mask(tsbk, 48, 0x3ff);
-    unsigned long freq = bitset_shift_mask(tsbk, 16, 0xffffffff);
+    unsigned long iden = tsbk.field(76, 0xf);
+    unsigned long bwvu = tsbk.field(72, 0xf);
+    unsigned long toff0 = tsbk.field(58, 0x3fff);
+    unsigned long spac = tsbk.field(48, 0x3ff);
+    unsigned long freq = tsbk.field(16, 0xffffffff);
     unsigned long toff_sign = (toff0 >> 13) & 1;
     double bandwidth = 0;
 
@@ -926,10 +933,10 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
   } else if (opcode == 0x38) { //
     BOOST_LOG_TRIVIAL(debug) << "tsbk38 SYSTEM SERVICE BROADCAST";
   } else if (opcode == 0x39) { // secondary cc
-    unsigned long rfid = bitset_shift_mask(tsbk, 72, 0xff);
-    unsigned long stid = bitset_shift_mask(tsbk, 64, 0xff);
-    unsigned long ch1 = bitset_shift_mask(tsbk, 48, 0xffff);
-    unsigned long ch2 = bitset_shift_mask(tsbk, 24, 0xffff);
+    unsigned long rfid = tsbk.field(72, 0xff);
+    unsigned long stid = tsbk.field(64, 0xff);
+    unsigned long ch1 = tsbk.field(48, 0xffff);
+    unsigned long ch2 = tsbk.field(24, 0xffff);
     unsigned long f1 = channel_id_to_frequency(ch1, sys_num);
     unsigned long f2 = channel_id_to_frequency(ch2, sys_num);
 
@@ -944,25 +951,29 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
 
       // message.sys_id = syid;
     }
-    os << "tsbk39 secondary cc: rfid " << std::dec << rfid << " stid " << stid << " ch1 " << channel_to_string(ch1, sys_num) << "(" << channel_id_to_freq_string(ch1, sys_num) << ") ch2 " << channel_to_string(ch2, sys_num) << "(" << channel_id_to_freq_string(ch2, sys_num) << ") ";
-    message.meta = os.str();
-    BOOST_LOG_TRIVIAL(debug) << os.str();
+    if (build_meta) {
+      os << "tsbk39 secondary cc: rfid " << std::dec << rfid << " stid " << stid << " ch1 " << channel_to_string(ch1, sys_num) << "(" << channel_id_to_freq_string(ch1, sys_num) << ") ch2 " << channel_to_string(ch2, sys_num) << "(" << channel_id_to_freq_string(ch2, sys_num) << ") ";
+      message.meta = os.str();
+      BOOST_LOG_TRIVIAL(debug) << message.meta;
+    }
   } else if (opcode == 0x3a) { // rfss status
-    unsigned long syid = bitset_shift_mask(tsbk, 56, 0xfff);
-    unsigned long rfid = bitset_shift_mask(tsbk, 48, 0xff);
-    unsigned long stid = bitset_shift_mask(tsbk, 40, 0xff);
-    unsigned long chan = bitset_shift_mask(tsbk, 24, 0xffff);
+    unsigned long syid = tsbk.field(56, 0xfff);
+    unsigned long rfid = tsbk.field(48, 0xff);
+    unsigned long stid = tsbk.field(40, 0xff);
+    unsigned long chan = tsbk.field(24, 0xffff);
     message.message_type = SYSID;
     message.sys_id = syid;
     message.sys_rfss = rfid;
     message.sys_site_id = stid;
-    os << "tsbk3a rfss status: syid: " << syid << " rfid " << rfid << " stid " << stid << " ch1 " << channel_to_string(chan, sys_num) << "(" << channel_id_to_freq_string(chan, sys_num) << ")";
-    message.meta = os.str();
-    BOOST_LOG_TRIVIAL(debug) << os.str();
+    if (build_meta) {
+      os << "tsbk3a rfss status: syid: " << syid << " rfid " << rfid << " stid " << stid << " ch1 " << channel_to_string(chan, sys_num) << "(" << channel_id_to_freq_string(chan, sys_num) << ")";
+      message.meta = os.str();
+      BOOST_LOG_TRIVIAL(debug) << message.meta;
+    }
   } else if (opcode == 0x3b) { // network status
-    unsigned long wacn = bitset_shift_mask(tsbk, 52, 0xfffff);
-    unsigned long syid = bitset_shift_mask(tsbk, 40, 0xfff);
-    unsigned long ch1 = bitset_shift_mask(tsbk, 24, 0xffff);
+    unsigned long wacn = tsbk.field(52, 0xfffff);
+    unsigned long syid = tsbk.field(40, 0xfff);
+    unsigned long ch1 = tsbk.field(24, 0xffff);
     unsigned long f1 = channel_id_to_frequency(ch1, sys_num);
 
     if (f1) {
@@ -973,9 +984,9 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
     }
     BOOST_LOG_TRIVIAL(debug) << "tsbk3b net stat: wacn " << std::dec << wacn << " syid " << syid << " ch1 " << channel_to_string(ch1, sys_num) << "(" << channel_id_to_freq_string(ch1, sys_num) << ") ";
   } else if (opcode == 0x3c) { // adjacent status
-    unsigned long rfid = bitset_shift_mask(tsbk, 48, 0xff);
-    unsigned long stid = bitset_shift_mask(tsbk, 40, 0xff);
-    unsigned long ch1 = bitset_shift_mask(tsbk, 24, 0xffff);
+    unsigned long rfid = tsbk.field(48, 0xff);
+    unsigned long stid = tsbk.field(40, 0xff);
+    unsigned long ch1 = tsbk.field(24, 0xffff);
     unsigned long f1 = channel_id_to_frequency(ch1, sys_num);
     BOOST_LOG_TRIVIAL(debug) << "tsbk3c\tAdjacent Status\t rfid " << std::dec << rfid << " stid " << stid << " ch1 " << channel_to_string(ch1, sys_num) << "(" << channel_id_to_freq_string(ch1, sys_num) << ") ";
 
@@ -992,11 +1003,11 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
       }
     }
   } else if (opcode == 0x3d) { // iden_up
-    unsigned long iden = bitset_shift_mask(tsbk, 76, 0xf);
-    unsigned long bw = bitset_shift_mask(tsbk, 67, 0x1ff);
-    unsigned long toff0 = bitset_shift_mask(tsbk, 58, 0x1ff);
-    unsigned long spac = bitset_shift_mask(tsbk, 48, 0x3ff);
-    unsigned long freq = bitset_shift_mask(tsbk, 16, 0xffffffff);
+    unsigned long iden = tsbk.field(76, 0xf);
+    unsigned long bw = tsbk.field(67, 0x1ff);
+    unsigned long toff0 = tsbk.field(58, 0x1ff);
+    unsigned long spac = tsbk.field(48, 0x3ff);
+    unsigned long freq = tsbk.field(16, 0xffffffff);
     unsigned long toff_sign = (toff0 >> 8) & 1;
     long toff = toff0 & 0xff;
 
@@ -1016,16 +1027,9 @@ std::vector<TrunkMessage> P25Parser::decode_tsbk(boost::dynamic_bitset<> &tsbk,
     BOOST_LOG_TRIVIAL(debug) << "tsbk3d iden id " << std::dec << iden << " toff " << toff * 0.25 << " spac " << spac * 0.125 << " freq " << freq * 0.000005;
   } else {
     BOOST_LOG_TRIVIAL(debug) << "tsbk other " << std::hex << opcode;
-    return messages;
+    return;
   }
   messages.push_back(message);
-  return messages;
-}
-
-void P25Parser::print_bitset(boost::dynamic_bitset<> &tsbk) {
-  /*boost::dynamic_bitset<> bitmask(tsbk.size(), 0x3f);
-     unsigned long result = (tsbk & bitmask).to_ulong();
-     BOOST_LOG_TRIVIAL(debug) << tsbk << " = " << std::hex << result;*/
 }
 
 void printbincharpad(char c) {
@@ -1036,10 +1040,18 @@ void printbincharpad(char c) {
   // std::cout << " | ";
 }
 
-std::vector<TrunkMessage> P25Parser::parse_message(gr::message::sptr msg, System *system) {
-  std::vector<TrunkMessage> messages;
+void P25Parser::parse_message(gr::message::sptr msg, System *system, std::vector<TrunkMessage> &messages) {
+  parse_data(msg->type(), (const unsigned char *)msg->msg(), msg->length(), system, messages);
+}
+
+void P25Parser::parse_frame(const gr::op25_repeater::control_frame &frame, System *system, std::vector<TrunkMessage> &messages) {
+  parse_data(frame.type, frame.data, frame.len, system, messages);
+}
+
+// data is the raw message body: the NAC in the first two bytes followed by the TSBK or MBT.
+// The decoded messages are appended to messages, so one vector can be reused across calls.
+void P25Parser::parse_data(long type, const unsigned char *data, size_t len, System *system, std::vector<TrunkMessage> &messages) {
 
-  long type = msg->type();
   int sys_num = system->get_sys_num();
 
   if(system->has_custom_freq_table_file() && custom_freq_table_loaded == false){
@@ -1052,40 +1064,38 @@ std::vector<TrunkMessage> P25Parser::parse_message(gr::message::sptr msg, System
   message.source = -1;
   message.sys_num = sys_num;
   if (type == -2) { // # request from gui
-    std::string cmd = msg->to_string();
+    std::string cmd((const char *)data, len);
 
     BOOST_LOG_TRIVIAL(debug) << "process_qmsg: command: " << cmd;
 
     // self.update_state(cmd, curr_time)
     messages.push_back(message);
-    return messages;
+    return;
   } else if (type == -1) { //	# timeout
 
     // self.update_state('timeout', curr_time)
     messages.push_back(message);
-    return messages;
+    return;
   } else if (type < 0) {
     BOOST_LOG_TRIVIAL(debug) << "unknown message type " << type;
     message.message_type = INVALID_CC_MESSAGE;
     messages.push_back(message);
-    return messages;
+    return;
   }
 
-  std::string s = msg->to_string();
-
- if (s.length() < 2) {
-    if (s.length() > 0) {
-      BOOST_LOG_TRIVIAL(debug) << "[" << system->get_short_name() << "]\t P25 Parse error, s: " << s << " Len: " << s.length() << " Freq: " << format_freq(system->get_current_control_channel());
+ if (len < 2) {
+    if (len > 0) {
+      BOOST_LOG_TRIVIAL(debug) << "[" << system->get_short_name() << "]\t P25 Parse error, s: " << std::string((const char *)data, len) << " Len: " << len << " Freq: " << format_freq(system->get_current_control_channel());
     }
     message.message_type = INVALID_CC_MESSAGE;
     messages.push_back(message);
-    return messages;
+    return;
   }
 
   // # nac is always 1st two bytes
   // ac = (ord(s[0]) << 8) + ord(s[1])
-  uint8_t s0 = (int)s[0];
-  uint8_t s1 = (int)s[1];
+  uint8_t s0 = data[0];
+  uint8_t s1 = data[1];
   int shift = s0 << 8;
   long nac = shift + s1;
 
@@ -1095,15 +1105,16 @@ std::vector<TrunkMessage> P25Parser::parse_message(gr::message::sptr msg, System
     // # TDMA
     // self.update_state('tdma_duid%d' % type, curr_time)
     messages.push_back(message);
-    return messages;
+    return;
   }
-  s = s.substr(2);
+  const unsigned char *body = data + 2;
+  size_t body_len = len - 2;
 
-  BOOST_LOG_TRIVIAL(trace) << std::hex << "nac " << nac << std::dec << " type " << type << " size " << msg->to_string().length() << " mesg len: " << msg->length();
+  BOOST_LOG_TRIVIAL(trace) << std::hex << "nac " << nac << std::dec << " type " << type << " size " << len << " mesg len: " << len;
   // //" at %f state %d len %d" %(nac, type, time.time(), self.state, len(s))
   if ((type != 7) && (type != 12)) // and nac not in self.trunked_systems:
   {
-    BOOST_LOG_TRIVIAL(debug) << std::hex << "NON TSBK: nac " << nac << std::dec << " type " << type << " size " << msg->to_string().length() << " mesg len: " << msg->length();
+    BOOST_LOG_TRIVIAL(debug) << std::hex << "NON TSBK: nac " << nac << std::dec << " type " << type << " size " << len << " mesg len: " << len;
   
     /*
        if not self.configs:
@@ -1115,68 +1126,28 @@ std::vector<TrunkMessage> P25Parser::parse_message(gr::message::sptr msg, System
   }
 
   if (type == 7) { // # trunk: TSBK
-    boost::dynamic_bitset<> b((s.length() + 2) * 8);
+    P25_Tsbk tsbk;
+    tsbk.load(body, body_len, 16); // 16 bits for missing crc
 
-    for (unsigned int i = 0; i < s.length(); ++i) {
-      unsigned char c = (unsigned char)s[i];
-      b <<= 8;
-
-      for (int j = 0; j < 8; j++) {
-        if (c & 0x1) {
-          b[j] = 1;
-        } else {
-          b[j] = 0;
-        }
-        c >>= 1;
-      }
-    }
-    b <<= 16; // for missing crc
-
-    return decode_tsbk(b, nac, sys_num);
+    decode_tsbk(tsbk, nac, sys_num, messages);
+    return;
   } else if (type == 12) { // # trunk: MBT
-    std::string s1 = s.substr(0, 10);
-    std::string s2 = s.substr(10);
-    boost::dynamic_bitset<> header((s1.length() + 2) * 8);
-
-    for (unsigned int i = 0; i < s1.length(); ++i) {
-      unsigned char c = (unsigned char)s1[i];
-      header <<= 8;
-
-      for (int j = 0; j < 8; j++) {
-        if (c & 0x1) {
-          header[j] = 1;
-        } else {
-          header[j] = 0;
-        }
-        c >>= 1;
-      }
-    }
-    header <<= 16; // for missing crc
-
-    boost::dynamic_bitset<> mbt_data((s2.length() + 4) * 8);
-    for (unsigned int i = 0; i < s2.length(); ++i) {
-      unsigned char c = (unsigned char)s2[i];
-      mbt_data <<= 8;
-
-      for (int j = 0; j < 8; j++) {
-        if (c & 0x1) {
-          mbt_data[j] = 1;
-        } else {
-          mbt_data[j] = 0;
-        }
-        c >>= 1;
-      }
-    }
-    mbt_data <<= 32; // for missing crc
-    unsigned long opcode = bitset_shift_mask(header, 32, 0x3f);
-    unsigned long link_id = bitset_shift_mask(header, 48, 0xffffff);
+    // The first 10 bytes are the header block, the rest are the data blocks
+    size_t header_len = std::min(body_len, (size_t)10);
+    P25_Mbt_Header header;
+    P25_Mbt_Data mbt_data;
+    header.load(body, header_len, 16); // 16 bits for missing crc
+    mbt_data.load(body + header_len, body_len - header_len, 32); // 32 bits for missing crc
+    unsigned long opcode = header.field(32, 0x3f);
+    unsigned long link_id = header.field(48, 0xffffff);
     /*BOOST_LOG_TRIVIAL(debug) << "RAW  Data    " <<b;
-    BOOST_LOG_TRIVIAL(debug) << "RAW  Data Length " <<s.length();*/
+    BOOST_LOG_TRIVIAL(debug) << "RAW  Data Length " << body_len;*/
     BOOST_LOG_TRIVIAL(debug) << "MBT:  opcode: $" << std::hex << opcode;
-    /* BOOST_LOG_TRIVIAL(debug) << "MBT  type :$" << std::hex << type << " len $" << std::hex << s1.length() << "/" << s2.length();
+    /* BOOST_LOG_TRIVIAL(debug) << "MBT  type :$" << std::hex << type << " len $" << std::hex << header_len << "/" << body_len - header_len;
     BOOST_LOG_TRIVIAL(debug) <<  "MBT Header: " <<  header;
     BOOST_LOG_TRIVIAL(debug) <<  "MBT  Data   " <<  mbt_data; */
-    return decode_mbt_data(opcode, header, mbt_data, link_id, nac, sys_num);
+    decode_mbt_data(opcode, header, mbt_data, link_id, nac, sys_num, messages);
+    return;
     // self.trunked_systems[nac].decode_mbt_data(opcode, header << 16, mbt_data
     // << 32)
   } else if (type == 15)
@@ -1186,5 +1157,4 @@ std::vector<TrunkMessage> P25Parser::parse_message(gr::message::sptr msg, System
     message.message_type = TDULC;
   }
   messages.push_back(message);
-  return messages;
 }
\ No newline at end of file
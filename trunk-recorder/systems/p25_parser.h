@@ -1,12 +1,12 @@
 #ifndef P25_PARSE_H
 #define P25_PARSE_H
 #include "parser.h"
-#include <bitset>
-#include <boost/dynamic_bitset.hpp>
 #include <boost/log/trivial.hpp>
 #include <gnuradio/message.h>
+#include <op25_repeater/include/op25_repeater/control_frame.h>
 #include "system.h"
 #include "system_impl.h"
+#include "p25_bitfield.h"
 #include <iomanip>
 #include <iostream>
 #include <map>
@@ -29,22 +29,25 @@ class P25Parser : public TrunkParser {
   std::map<int, std::map<int, Freq_Table>> freq_tables;
   std::map<int, Freq_Table>::iterator it;
   bool custom_freq_table_loaded = false;
+  bool build_meta = false;
 
 public:
   P25Parser();
   long get_tdma_slot(int chan_id, int sys_num);
   double get_bandwidth(int chan_id, int sys_num);
-  std::vector<TrunkMessage> decode_mbt_data(unsigned long opcode, boost::dynamic_bitset<> &header, boost::dynamic_bitset<> &mbt_data, unsigned long link_id, unsigned long nac, int sys_num);
-  std::vector<TrunkMessage> decode_tsbk(boost::dynamic_bitset<> &tsbk, unsigned long nac, int sys_num);
-  unsigned long bitset_shift_mask(boost::dynamic_bitset<> &tsbk, int shift, unsigned long long mask);
-  unsigned long bitset_shift_left_mask(boost::dynamic_bitset<> &tsbk, int shift, unsigned long long mask);
+  void decode_mbt_data(unsigned long opcode, const P25_Mbt_Header &header, const P25_Mbt_Data &mbt_data, unsigned long link_id, unsigned long nac, int sys_num, std::vector<TrunkMessage> &messages);
+  void decode_tsbk(const P25_Tsbk &tsbk, unsigned long nac, int sys_num, std::vector<TrunkMessage> &messages);
   std::string channel_id_to_freq_string(int chan_id, int sys_num);
-  void print_bitset(boost::dynamic_bitset<> &tsbk);
   void add_freq_table(int freq_table_id, Freq_Table table, int sys_num);
   void load_freq_table(std::string custom_freq_table_file, int sys_num);
   double channel_id_to_frequency(int chan_id, int sys_num);
   std::string channel_to_string(int chan, int sys_num);
-  std::vector<TrunkMessage> parse_message(gr::message::sptr msg, System *system);
+  void parse_message(gr::message::sptr msg, System *system, std::vector<TrunkMessage> &messages);
+  void parse_frame(const gr::op25_repeater::control_frame &frame, System *system, std::vector<TrunkMessage> &messages);
+  void set_build_meta(bool b) { build_meta = b; } // fill TrunkMessage::meta with a readable description
+
+private:
+  void parse_data(long type, const unsigned char *data, size_t len, System *system, std::vector<TrunkMessage> &messages);
 };
 
 #endif
\ No newline at end of file
@@ -2,8 +2,8 @@
 #include "p25_trunking.h"
 #include <boost/log/trivial.hpp>
 
-p25_trunking_sptr make_p25_trunking(double freq, double center, long s, gr::msg_queue::sptr queue, bool qpsk, int sys_num) {
-  return gnuradio::get_initial_sptr(new p25_trunking(freq, center, s, queue, qpsk, sys_num));
+p25_trunking_sptr make_p25_trunking(double freq, double center, long s, gr::msg_queue::sptr queue, bool qpsk, int sys_num, bool fused_demod) {
+  return gnuradio::get_initial_sptr(new p25_trunking(freq, center, s, queue, qpsk, sys_num, fused_demod));
 }
 
 void p25_trunking::initialize_fsk4() {
@@ -14,14 +14,8 @@ void p25_trunking::initialize_fsk4() {
   symbol_rate = phase1_symbol_rate;
   // double phase2_channel_rate = phase2_symbol_rate * phase2_samples_per_symbol;
   const double pi = M_PI;
-
-  // FSK4: Phase Loop Lock - can only be Phase 1, so locking at that rate.
-  double freq_to_norm_radians = pi / (phase1_channel_rate / 2.0);
   double fc = 0.0;
   double fd = 600.0;
-  double pll_demod_gain = 1.0 / (fd * freq_to_norm_radians);
-  pll_freq_lock = gr::analog::pll_freqdet_cf::make((phase1_symbol_rate / 2.0 * 1.2) * freq_to_norm_radians, (fc + (3 * fd * 1.9)) * freq_to_norm_radians, (fc + (-3 * fd * 1.9)) * freq_to_norm_radians);
-  pll_amp = gr::blocks::multiply_const_ff::make(pll_demod_gain * 1.0); // source->get_());
 
   // FSK4: noise filter - can only be Phase 1, so locking at that rate.
 #if GNURADIO_VERSION < 0x030900
@@ -30,6 +24,22 @@ void p25_trunking::initialize_fsk4() {
   baseband_noise_filter_taps = gr::filter::firdes::low_pass_2(1.0, phase1_channel_rate, phase1_symbol_rate / 2.0 * 1.175, phase1_symbol_rate / 2.0 * 0.125, 20.0, gr::fft::window::WIN_KAISER, 6.76);
 
 #endif
+
+  if (fused_demod) {
+    // FSK4: PLL, filters and symbol timing in a single block
+    fused_fsk4_demod = gr::op25_repeater::fsk4_demod_cf::make(phase1_channel_rate, phase1_symbol_rate, fd, baseband_noise_filter_taps);
+
+    connect(prefilter, 0, fused_fsk4_demod, 0);
+    connect(fused_fsk4_demod, 0, slicer, 0);
+    return;
+  }
+
+  // FSK4: Phase Loop Lock - can only be Phase 1, so locking at that rate.
+  double freq_to_norm_radians = pi / (phase1_channel_rate / 2.0);
+  double pll_demod_gain = 1.0 / (fd * freq_to_norm_radians);
+  pll_freq_lock = gr::analog::pll_freqdet_cf::make((phase1_symbol_rate / 2.0 * 1.2) * freq_to_norm_radians, (fc + (3 * fd * 1.9)) * freq_to_norm_radians, (fc + (-3 * fd * 1.9)) * freq_to_norm_radians);
+  pll_amp = gr::blocks::multiply_const_ff::make(pll_demod_gain * 1.0); // source->get_());
+
   noise_filter = gr::filter::fft_filter_fff::make(1.0, baseband_noise_filter_taps);
 
   // FSK4: Symbol Taps
@@ -54,7 +64,6 @@ void p25_trunking::initialize_fsk4() {
 void p25_trunking::initialize_qpsk() {
   const double pi = M_PI;
 
-  agc = gr::analog::feedforward_agc_cc::make(16, 1.0);
   system_channel_rate = phase1_symbol_rate * phase1_samples_per_symbol;
   samples_per_symbol = phase1_samples_per_symbol;
   symbol_rate = phase1_symbol_rate;
@@ -66,6 +75,16 @@ void p25_trunking::initialize_qpsk() {
   double fmax = 3000; // Hz
   fmax = 2 * pi * fmax / double(system_channel_rate);
 
+  if (fused_demod) {
+    // QPSK: timing, differential decode, carrier recovery and rescale in a single block
+    fused_qpsk_demod = gr::op25_repeater::cqpsk_demod_cf::make(omega, gain_mu, gain_omega, costas_alpha);
+
+    connect(prefilter, 0, fused_qpsk_demod, 0);
+    connect(fused_qpsk_demod, 0, slicer, 0);
+    return;
+  }
+
+  agc = gr::analog::feedforward_agc_cc::make(16, 1.0);
   costas = gr::op25_repeater::costas_loop_cc::make(costas_alpha,  4, (2 * pi)/4 ); 
   clock = gr::op25_repeater::gardner_cc::make(omega, gain_mu, gain_omega);
 
@@ -114,12 +133,13 @@ void p25_trunking::initialize_p25() {
   bool do_nocrypt = 1;
   bool soft_vocoder = false;
   op25_frame_assembler = gr::op25_repeater::p25_frame_assembler::make(silence_frames, soft_vocoder, wireshark_host, udp_port, verbosity, do_imbe, do_output, do_msgq, rx_queue, do_audio_output, do_tdma, do_nocrypt);
+  op25_frame_assembler->set_control_ring(&control_ring);
   autotune_offset = 0;
 
   connect(slicer, 0, op25_frame_assembler, 0);
 }
 
-p25_trunking::p25_trunking(double f, double c, long s, gr::msg_queue::sptr queue, bool qpsk, int sys_num)
+p25_trunking::p25_trunking(double f, double c, long s, gr::msg_queue::sptr queue, bool qpsk, int sys_num, bool fused_demod)
     : gr::hier_block2("p25_trunking",
                       gr::io_signature::make(1, 1, sizeof(gr_complex)),
                       gr::io_signature::make(0, 0, sizeof(float))) {
@@ -130,6 +150,7 @@ p25_trunking::p25_trunking(double f, double c, long s, gr::msg_queue::sptr queue
   input_rate = s;
   rx_queue = queue;
   qpsk_mod = qpsk;
+  this->fused_demod = fused_demod;
 
   prefilter = xlat_channelizer::make(input_rate, channelizer::phase1_samples_per_symbol, channelizer::phase1_symbol_rate, xlat_channelizer::channel_bandwidth, center_freq, false);
 
@@ -165,8 +186,12 @@ void p25_trunking::tune_freq(double f) {
   int offset_amount = (center_freq - f);
   prefilter->tune_offset(offset_amount);
   if (qpsk_mod) {
-    costas->set_phase(0);
-    costas->set_frequency(0);
+    if (fused_qpsk_demod) {
+      fused_qpsk_demod->reset();
+    } else {
+      costas->set_phase(0);
+      costas->set_frequency(0);
+    }
   } else {
     //fsk4_demod->reset();
   }
@@ -48,6 +48,8 @@
 #include <gnuradio/digital/diff_phasor_cc.h>
 
 #include <op25_repeater/fsk4_demod_ff.h>
+#include <op25_repeater/fsk4_demod_cf.h>
+#include <op25_repeater/cqpsk_demod_cf.h>
 #include <op25_repeater/fsk4_slicer_fb.h>
 #include <op25_repeater/costas_loop_cc.h>
 #include <op25_repeater/gardner_cc.h>
@@ -75,7 +77,8 @@ p25_trunking_sptr make_p25_trunking(double f,
                                     long s,
                                     gr::msg_queue::sptr queue,
                                     bool qpsk,
-                                    int sys_num);
+                                    int sys_num,
+                                    bool fused_demod = false);
 
 class p25_trunking : public gr::hier_block2 {
   struct DecimSettings {
@@ -87,7 +90,8 @@ class p25_trunking : public gr::hier_block2 {
                                              long s,
                                              gr::msg_queue::sptr queue,
                                              bool qpsk,
-                                             int sys_num);
+                                             int sys_num,
+                                             bool fused_demod);
 
 protected:
   p25_trunking(double f,
@@ -95,7 +99,8 @@ protected:
                long s,
                gr::msg_queue::sptr queue,
                bool qpsk,
-               int sys_num);
+               int sys_num,
+               bool fused_demod);
 
 public:
   ~p25_trunking();
@@ -112,6 +117,7 @@ public:
   gr::msg_queue::sptr tune_queue;
   gr::msg_queue::sptr traffic_queue;
   gr::msg_queue::sptr rx_queue;
+  gr::op25_repeater::control_frame_ring control_ring; // TSBKs, MBTs and timeouts from the frame assembler
 
 private:
   void initialize_qpsk();
@@ -130,6 +136,7 @@ private:
   long if1;
   long if2;
   bool qpsk_mod;
+  bool fused_demod;
   int sys_num;
   const int phase1_samples_per_symbol = 5;
   const int phase2_samples_per_symbol = 4;
@@ -171,6 +178,8 @@ private:
   gr::blocks::complex_to_arg::sptr to_float;
 
   gr::op25_repeater::fsk4_demod_ff::sptr fsk4_demod;
+  gr::op25_repeater::fsk4_demod_cf::sptr fused_fsk4_demod;
+  gr::op25_repeater::cqpsk_demod_cf::sptr fused_qpsk_demod;
   gr::op25_repeater::p25_frame_assembler::sptr op25_frame_assembler;
   gr::op25_repeater::fsk4_slicer_fb::sptr slicer;
   gr::op25_repeater::gardner_cc::sptr clock;
@@ -34,7 +34,7 @@ struct PatchData {
 
 struct TrunkMessage {
   MessageType message_type;
-  std::string meta;
+  std::string meta; // only filled in when debug logging is on or a plugin asks for it
   double freq;
   long talkgroup;
   bool encrypted;
@@ -53,7 +53,7 @@ struct TrunkMessage {
   unsigned long wacn;
   PatchData patch_data;
   unsigned long opcode;
-  
+  double timestamp; // when the control channel frame it came from was decoded, 0 if that is not known
 };
 
 class TrunkParser {
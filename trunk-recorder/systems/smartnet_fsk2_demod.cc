@@ -21,6 +21,10 @@ smartnet_fsk2_demod::~smartnet_fsk2_demod() {
 void smartnet_fsk2_demod::reset() {
 }
 
+void smartnet_fsk2_demod::set_control_ring(gr::op25_repeater::control_frame_ring *ring) {
+  framer->set_control_ring(ring);
+}
+
 void smartnet_fsk2_demod::initialize() {
   const double channel_rate = symbol_rate * samples_per_symbol;
   const double pi = M_PI;
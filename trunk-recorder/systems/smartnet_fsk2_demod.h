@@ -28,6 +28,7 @@ class smartnet_fsk2_demod : public gr::hier_block2 {
   smartnet_fsk2_demod(gr::msg_queue::sptr queue);
   virtual ~smartnet_fsk2_demod();
   void reset();
+  void set_control_ring(gr::op25_repeater::control_frame_ring *ring);
     #if GNURADIO_VERSION < 0x030900
 typedef boost::shared_ptr<smartnet_fsk2_demod> sptr;
 #else
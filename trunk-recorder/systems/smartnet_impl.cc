@@ -38,6 +38,7 @@ void smartnet_impl::initialize(double freq, double center, long s, gr::msg_queue
   //  initialize_p25();
 
   fsk2_demod = smartnet_fsk2_demod::make(rx_queue);
+  fsk2_demod->set_control_ring(&control_ring);
 
   connect(self(), 0, prefilter, 0);
   connect(prefilter, 0, fsk2_demod, 0);
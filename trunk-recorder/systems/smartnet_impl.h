@@ -64,6 +64,7 @@ class smartnet_impl : public gr::hier_block2 {
   int autotune_offset;
 
   gr::msg_queue::sptr rx_queue;
+  gr::op25_repeater::control_frame_ring control_ring; // OSWs and timeouts from the frame assembler
 
 private:
   void initialize(double freq, double center, long s, gr::msg_queue::sptr queue, int sys_num);
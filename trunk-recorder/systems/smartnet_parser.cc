@@ -86,24 +86,29 @@ void SmartnetParser::log_bandplan() {
                              << " Rebanded: " << is_rebanded;
 }
 
-std::vector<TrunkMessage> SmartnetParser::parse_message(gr::message::sptr msg, System *system) {
-    int sysnum = system->get_sys_num();
-    time_t curr_time = time(NULL);
-    std::vector<TrunkMessage> messages;
-
-
-    
+void SmartnetParser::parse_message(gr::message::sptr msg, System *system, std::vector<TrunkMessage> &messages) {
     if (!msg) {
-        return messages;
+        return;
     }
+    parse_data(msg->type(), msg->arg2(), (const unsigned char *)msg->msg(), msg->length(), system, messages);
+}
+
+void SmartnetParser::parse_frame(const gr::op25_repeater::control_frame &frame, System *system, std::vector<TrunkMessage> &messages) {
+    parse_data(frame.type, frame.timestamp, frame.data, frame.len, system, messages);
+}
+
+// Appends the decoded messages to messages, so one vector can be reused across calls
+void SmartnetParser::parse_data(long type, double m_ts, const unsigned char *data, size_t len, System *system, std::vector<TrunkMessage> &messages) {
+    int sysnum = system->get_sys_num();
+    time_t curr_time = time(NULL);
+    size_t first_message = messages.size();
 
-    long m_proto = (msg->type() >> 16);
+    long m_proto = (type >> 16);
     if (m_proto != 2) {
-        return messages;
+        return;
     }
 
-    long m_type = (msg->type() & 0xffff);
-    double m_ts = msg->arg2(); 
+    long m_type = (type & 0xffff);
 
     if (m_type == M_SMARTNET_TIMEOUT) {
         if (this->debug_level > 10) {
@@ -114,19 +119,17 @@ std::vector<TrunkMessage> SmartnetParser::parse_message(gr::message::sptr msg, S
         enqueue(0xffff, 0x1, OSW_QUEUE_RESET_CMD, m_ts);
     } else if (m_type == M_SMARTNET_OSW) {
         if (osw_count == 0) log_bandplan(); // Log bandplan on first OSW
-        std::string s = msg->to_string();
-        if (s.length() >= 5) {
-            int osw_addr = ((unsigned char)s[0] << 8) | (unsigned char)s[1];
-            int osw_grp = (unsigned char)s[2];
-            int osw_cmd = ((unsigned char)s[3] << 8) | (unsigned char)s[4];
+        if (len >= 5) {
+            int osw_addr = (data[0] << 8) | data[1];
+            int osw_grp = data[2];
+            int osw_cmd = (data[3] << 8) | data[4];
             enqueue(osw_addr, osw_grp, osw_cmd, m_ts);
             osw_count++;
             last_osw = m_ts;
         }
     }
 
-    std::vector<TrunkMessage> new_msgs = process_osws(curr_time);
-    messages.insert(messages.end(), new_msgs.begin(), new_msgs.end());
+    process_osws(curr_time, messages);
 
     if (curr_time >= last_expiry_check + EXPIRY_TIMER) {
         expire_talkgroups(curr_time);
@@ -136,18 +139,16 @@ std::vector<TrunkMessage> SmartnetParser::parse_message(gr::message::sptr msg, S
         last_expiry_check = curr_time;
     }
 
-    if (this->debug_level >= 11) BOOST_LOG_TRIVIAL(info) << "[" << msgq_id << "] SMARTNET PARSE MESSAGE messages.size(" << messages.size() << ")";
-    return messages;
+    if (this->debug_level >= 11) BOOST_LOG_TRIVIAL(info) << "[" << msgq_id << "] SMARTNET PARSE MESSAGE messages.size(" << messages.size() - first_message << ")";
 }
 
-std::vector<TrunkMessage> SmartnetParser::process_osws(time_t curr_time) {
-    std::vector<TrunkMessage> messages;
+void SmartnetParser::process_osws(time_t curr_time, std::vector<TrunkMessage> &messages) {
     if (osw_q.empty()) {
-        return messages;
+        return;
     }
     
     if (osw_q.size() < OSW_QUEUE_SIZE) {
-        return messages;
+        return;
     }
     
     OSW osw2 = osw_q.front();
@@ -183,7 +184,7 @@ std::vector<TrunkMessage> SmartnetParser::process_osws(time_t curr_time) {
                 // If we only had more than one queue reset message, we need to put one back and wait for more OSWs
                 osw_q.push_front(queue_reset);
                 if (this->debug_level >= 11) BOOST_LOG_TRIVIAL(info) << "[" << msgq_id << "] SMARTNET PARSE MESSAGE QUEUE RESET PUSHED BACK";
-                return messages;
+                return;
             }
         }
     }
@@ -193,7 +194,7 @@ std::vector<TrunkMessage> SmartnetParser::process_osws(time_t curr_time) {
     // first, but then fall back to non-OBT-specific parsing if that fails.
     if (is_obt_system() && osw2.ch_tx) {
         if (osw_q.empty()) {
-            return messages;
+            return;
         }
         // Get next OSW in the queue
         OSW osw1 = osw_q.front(); 
@@ -207,7 +208,7 @@ std::vector<TrunkMessage> SmartnetParser::process_osws(time_t curr_time) {
             //     osw_q.push_front(osw1); 
             //     osw_q.push_front(osw2); 
             //     if (this->debug_level >= 11) BOOST_LOG_TRIVIAL(info) << "[" << msgq_id << "] SMARTNET PARSE MESSAGE OSW QUEUE PUSHED FRONT";
-            //     return messages; 
+            //     return; 
             //  }
              OSW osw0 = osw_q.front(); osw_q.pop_front(); // Line 861 from Python implementation
              
@@ -302,7 +303,7 @@ std::vector<TrunkMessage> SmartnetParser::process_osws(time_t curr_time) {
     }
     // Two- or three-OSW message
     else if (osw2.cmd == 0x308) {
-        if (osw_q.empty()) { osw_q.push_front(osw2); return messages; }
+        if (osw_q.empty()) { osw_q.push_front(osw2); return; }
         OSW osw1 = osw_q.front(); osw_q.pop_front();
         
         // Two-OSW system ID + control channel broadcast line 987
@@ -800,7 +801,6 @@ std::vector<TrunkMessage> SmartnetParser::process_osws(time_t curr_time) {
         }
     }
     
-    return messages;
 }
 
 std::vector<TrunkMessage> SmartnetParser::update_voice_frequency(double ts, double freq, long tgid, int srcaddr, int mode) {
@@ -4,6 +4,7 @@
 #include "system.h"
 #include "parser.h"
 #include <gnuradio/message.h>
+#include <op25_repeater/include/op25_repeater/control_frame.h>
 #include <deque>
 #include <map>
 #include <mutex>
@@ -69,14 +70,17 @@ public:
     SmartnetParser(System *system);
     ~SmartnetParser();
 
-    std::vector<TrunkMessage> parse_message(gr::message::sptr msg, System *system);
-    std::vector<TrunkMessage> process_osws(time_t curr_time);
+    void parse_message(gr::message::sptr msg, System *system, std::vector<TrunkMessage> &messages);
+    void parse_frame(const gr::op25_repeater::control_frame &frame, System *system, std::vector<TrunkMessage> &messages);
+    void process_osws(time_t curr_time, std::vector<TrunkMessage> &messages);
     
     std::string to_json();
     void set_debug(int level) { debug_level = level; }
     void set_msgq_id(int id) { msgq_id = id; }
 
 private:
+    void parse_data(long type, double ts, const unsigned char *data, size_t len, System *system, std::vector<TrunkMessage> &messages);
+
     System *system;
     int debug_level;
     int sysnum;
@@ -43,6 +43,16 @@ typedef std::shared_ptr<dmr_recorder> dmr_recorder_sptr;
 typedef std::shared_ptr<sigmf_recorder> sigmf_recorder_sptr;
 #endif
 
+// Cached view of the patches a talkgroup belongs to. Maintained as PATCH_ADD,
+// PATCH_DELETE and stale patch expiry change membership, so grant handling can
+// read it without walking talkgroup_patches.
+struct TalkgroupPatch {
+  std::vector<unsigned long> talkgroups; // Every TGID patched with this talkgroup, including itself
+  bool has_known_talkgroup;              // At least one of the patched TGIDs is in the Talkgroup File
+  int priority;                          // Best (lowest) priority of the known patched TGIDs
+  unsigned long priority_talkgroup;      // The TGID that priority came from
+};
+
 class System {
 
 public:
@@ -144,8 +154,8 @@ public:
   virtual int get_sys_site_id() = 0;
   virtual void set_xor_mask(unsigned long sys_id, unsigned long wacn, unsigned long nac) = 0;
   virtual const char *get_xor_mask() = 0;
-  virtual bool update_status(TrunkMessage message) = 0;
-  virtual bool update_sysid(TrunkMessage message) = 0;
+  virtual bool update_status(const TrunkMessage &message) = 0;
+  virtual bool update_sysid(const TrunkMessage &message) = 0;
   virtual int get_sys_num() = 0;
   virtual void set_system_type(std::string) = 0;
   virtual std::string get_talkgroups_file() = 0;
@@ -189,7 +199,7 @@ public:
   virtual std::vector<double> get_control_channels() = 0;
   virtual std::vector<Talkgroup *> get_talkgroups() = 0;
   virtual std::vector<UnitTag *> get_unit_tags() = 0;
-  virtual std::vector<UnitTagOTA *> get_unit_tags_ota() = 0;
+  virtual std::vector<UnitTagOTA> get_unit_tags_ota() = 0;
   virtual void set_bandplan(std::string) = 0;
   virtual std::string get_bandplan() = 0;
   virtual void set_bandfreq(int) = 0;
@@ -222,6 +232,7 @@ public:
   virtual boost::property_tree::ptree get_stats_current(float timeDiff) = 0;
 
   virtual std::vector<unsigned long> get_talkgroup_patch(unsigned long talkgroup) = 0;
+  virtual const TalkgroupPatch *find_talkgroup_patch(unsigned long talkgroup) = 0;
   virtual void update_active_talkgroup_patches(PatchData f_data) = 0;
   virtual void delete_talkgroup_patch(PatchData f_data) = 0;
   virtual void clear_stale_talkgroup_patches() = 0;
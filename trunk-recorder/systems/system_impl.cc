@@ -1,5 +1,6 @@
 #include "system_impl.h"
 #include "system.h"
+#include <algorithm>
 
 System *System::make(int sys_num) {
   return (System *)new System_impl(sys_num);
@@ -187,7 +188,9 @@ System_impl::System_impl(int sys_num) {
   talkgroups = new Talkgroups();
   // Setup the unit tags from the CSV file
   unit_tags = new UnitTags();
+  smartnet_parser = NULL;
   talkgroup_patches = {};
+  talkgroup_patch_index = {};
   d_hideEncrypted = false;
   d_monitorEncrypted = false;
   d_hideUnknown = false;
@@ -197,6 +200,7 @@ System_impl::System_impl(int sys_num) {
   d_tps_enabled = false;
   retune_attempts = 0;
   message_count = 0;
+  control_crc_errors = 0;
   decode_rate = 0;
   msg_queue = gr::msg_queue::make(100);
   audio_postprocess_enabled = false;
@@ -229,7 +233,7 @@ void System_impl::set_xor_mask(unsigned long sys_id, unsigned long wacn, unsigne
     }
   }
 }
-bool System_impl::update_status(TrunkMessage message) {
+bool System_impl::update_status(const TrunkMessage &message) {
   if (!sys_id || !wacn || !nac) {
     sys_id = message.sys_id;
     wacn = message.wacn;
@@ -251,7 +255,7 @@ bool System_impl::update_status(TrunkMessage message) {
   return false;
 }
 
-bool System_impl::update_sysid(TrunkMessage message) {
+bool System_impl::update_sysid(const TrunkMessage &message) {
   if (!sys_rfss || !sys_site_id) {
     sys_rfss = message.sys_rfss;
     sys_site_id = message.sys_site_id;
@@ -518,11 +522,11 @@ std::vector<UnitTag *> System_impl::get_unit_tags() {
   return std::vector<UnitTag *>();
 }
 
-std::vector<UnitTagOTA *> System_impl::get_unit_tags_ota() {
+std::vector<UnitTagOTA> System_impl::get_unit_tags_ota() {
   if (unit_tags) {
     return unit_tags->get_unit_tags_ota();
   }
-  return std::vector<UnitTagOTA *>();
+  return std::vector<UnitTagOTA>();
 }
 
 int System_impl::channel_count() {
@@ -757,36 +761,75 @@ boost::property_tree::ptree System_impl::get_stats_current(float timeDiff) {
 
 std::vector<unsigned long> System_impl::get_talkgroup_patch(unsigned long talkgroup) {
   // Given a single TGID, return a vector of TGIDs that are part of the same patch
+  const TalkgroupPatch *patch = find_talkgroup_patch(talkgroup);
+  if (patch) {
+    return patch->talkgroups;
+  }
+  return std::vector<unsigned long>();
+}
+
+const TalkgroupPatch *System_impl::find_talkgroup_patch(unsigned long talkgroup) {
+  std::unordered_map<unsigned long, TalkgroupPatch>::const_iterator it = talkgroup_patch_index.find(talkgroup);
+  if (it == talkgroup_patch_index.end()) {
+    return NULL;
+  }
+  return &it->second;
+}
+
+void System_impl::refresh_talkgroup_patch(unsigned long talkgroup) {
+  // Rebuild the cached patch membership and effective priority for a single TGID
   std::vector<unsigned long> patched_tgids;
   BOOST_FOREACH (auto &patch, talkgroup_patches) {
     if (patch.second.find(talkgroup) != patch.second.end()) {
-      // talkgroup passed in is part of this patch, so add all talkgroups from this patch to our output vector
       BOOST_FOREACH (auto &patch_element, patch.second) {
         patched_tgids.push_back(patch_element.first);
       }
     }
   }
-  return patched_tgids;
+
+  if (patched_tgids.empty()) {
+    talkgroup_patch_index.erase(talkgroup);
+    return;
+  }
+
+  std::sort(patched_tgids.begin(), patched_tgids.end());
+  patched_tgids.erase(std::unique(patched_tgids.begin(), patched_tgids.end()), patched_tgids.end());
+
+  TalkgroupPatch &entry = talkgroup_patch_index[talkgroup];
+  entry.talkgroups = patched_tgids;
+  entry.has_known_talkgroup = false;
+  entry.priority = 0;
+  entry.priority_talkgroup = 0;
+
+  BOOST_FOREACH (auto &TGID, patched_tgids) {
+    Talkgroup *tg = find_talkgroup(TGID);
+    if (tg == NULL) {
+      continue;
+    }
+    if (!entry.has_known_talkgroup || (tg->get_priority() < entry.priority)) {
+      entry.priority = tg->get_priority();
+      entry.priority_talkgroup = TGID;
+    }
+    entry.has_known_talkgroup = true;
+  }
 }
 
 void System_impl::update_active_talkgroup_patches(PatchData patch_data) {
   std::time_t update_time = std::time(nullptr);
   bool new_flag = true;
+  bool membership_changed = false;
+  unsigned long patch_tgids[] = {patch_data.sg, patch_data.ga1, patch_data.ga2, patch_data.ga3};
 
   BOOST_FOREACH (auto &patch, talkgroup_patches) {
     if (patch.first == patch_data.sg) {
       new_flag = false;
-      if (0 != patch_data.sg) {
-        patch.second[patch_data.sg] = update_time;
-      }
-      if (0 != patch_data.ga1) {
-        patch.second[patch_data.ga1] = update_time;
-      }
-      if (0 != patch_data.ga2) {
-        patch.second[patch_data.ga2] = update_time;
-      }
-      if (0 != patch_data.ga3) {
-        patch.second[patch_data.ga3] = update_time;
+      BOOST_FOREACH (auto &TGID, patch_tgids) {
+        if (0 != TGID) {
+          if (patch.second.find(TGID) == patch.second.end()) {
+            membership_changed = true;
+          }
+          patch.second[TGID] = update_time;
+        }
       }
     }
   }
@@ -794,34 +837,45 @@ void System_impl::update_active_talkgroup_patches(PatchData patch_data) {
     // TGIDs from the Message were not found in an existing patch, so add them to a new one
     BOOST_LOG_TRIVIAL(debug) << "tsbk00\tNew Motorola patch fround, \tsg: " << patch_data.sg << "\tga1: " << patch_data.ga1 << "\tga2: " << patch_data.ga2 << "\tga3: " << patch_data.ga3;
     std::map<unsigned long, std::time_t> new_patch;
-    if (0 != patch_data.sg) {
-      new_patch[patch_data.sg] = update_time;
-    }
-    if (0 != patch_data.ga1) {
-      new_patch[patch_data.ga1] = update_time;
-    }
-    if (0 != patch_data.ga2) {
-      new_patch[patch_data.ga2] = update_time;
-    }
-    if (0 != patch_data.ga3) {
-      new_patch[patch_data.ga3] = update_time;
+    BOOST_FOREACH (auto &TGID, patch_tgids) {
+      if (0 != TGID) {
+        new_patch[TGID] = update_time;
+      }
     }
     talkgroup_patches[patch_data.sg] = new_patch;
+    membership_changed = true;
+  }
+
+  // Most PATCH_ADD messages just refresh the timestamps, only rebuild the cache when a TGID joined
+  if (membership_changed) {
+    BOOST_FOREACH (auto &patch_element, talkgroup_patches[patch_data.sg]) {
+      refresh_talkgroup_patch(patch_element.first);
+    }
   }
 }
 
 void System_impl::delete_talkgroup_patch(PatchData patch_data) {
+  std::vector<unsigned long> affected_tgids;
+
   BOOST_FOREACH (auto &patch, talkgroup_patches) {
     if (patch.first == patch_data.sg) {
+      BOOST_FOREACH (auto &patch_element, patch.second) {
+        affected_tgids.push_back(patch_element.first);
+      }
       patch.second.erase(patch_data.ga1);
       patch.second.erase(patch_data.ga2);
       patch.second.erase(patch_data.ga3);
     }
   }
+
+  BOOST_FOREACH (auto &TGID, affected_tgids) {
+    refresh_talkgroup_patch(TGID);
+  }
 }
 
 void System_impl::clear_stale_talkgroup_patches() {
   std::vector<unsigned long> stale_patches;
+  std::vector<unsigned long> affected_tgids;
 
   BOOST_FOREACH (auto &patch, talkgroup_patches) {
     // patch.first (map key) is supergroup TGID, patch.second (map value) is the map of all TGIDs in this patch and associated timestamps
@@ -832,6 +886,12 @@ void System_impl::clear_stale_talkgroup_patches() {
         stale_talkgroups.push_back(patch_element.first);     // add this tgid to the list that we'll delete from this patch since it's expired
       }
     }
+    if (stale_talkgroups.size() > 0) {
+      // Every member of this patch needs its cached membership rebuilt
+      BOOST_FOREACH (auto &patch_element, patch.second) {
+        affected_tgids.push_back(patch_element.first);
+      }
+    }
     BOOST_FOREACH (auto &stale_talkgroup, stale_talkgroups) {
       BOOST_LOG_TRIVIAL(debug) << "Going to remove stale TGID " << stale_talkgroup << "from patch with sg id " << patch.first;
       patch.second.erase(stale_talkgroup);
@@ -844,6 +904,9 @@ void System_impl::clear_stale_talkgroup_patches() {
     BOOST_LOG_TRIVIAL(debug) << "Going to remove entire patch with sg id " << stale_patch;
     talkgroup_patches.erase(stale_patch);
   }
+  BOOST_FOREACH (auto &TGID, affected_tgids) {
+    refresh_talkgroup_patch(TGID);
+  }
 
   // Print out all active patches to the console
   BOOST_LOG_TRIVIAL(debug) << "Found " << talkgroup_patches.size() << " active talkgroup patches:";
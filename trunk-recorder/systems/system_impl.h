@@ -5,6 +5,7 @@
 #include <boost/foreach.hpp>
 #include <boost/log/trivial.hpp>
 #include <stdio.h>
+#include <unordered_map>
 //#include "../source.h"
 #include "p25_trunking.h"
 #include "parser.h"
@@ -27,6 +28,7 @@
 #include <boost/property_tree/ptree.hpp>
 
 class Source;
+class SmartnetParser;
 class analog_recorder;
 class p25_recorder;
 class dmr_recorder;
@@ -55,6 +57,7 @@ class System_impl : public System {
 public:
   Talkgroups *talkgroups;
   UnitTags *unit_tags;
+  SmartnetParser *smartnet_parser; // only SmartNet systems have one, created in setup_systems
   p25p2_lfsr *lfsr;
   Source *source;
   std::string talkgroups_file;
@@ -72,6 +75,7 @@ public:
   std::string filename_format;
   int bcfy_system_id;
   int message_count;
+  long control_crc_errors; // control channel blocks dropped for a bad CRC
   int decode_rate;
   int retune_attempts;
   time_t last_message_time;
@@ -123,7 +127,20 @@ public:
   smartnet_impl::sptr smartnet_trunking;
   p25_trunking_sptr p25_trunking;
 
+  // Every Source that can cover a control channel feeds its own trunking block from a
+  // selector port. Only the port of the Source in use is enabled, so moving the control
+  // channel to another Source does not have to lock the flow graph.
+  struct Control_Channel_Input {
+    Source *source;
+    unsigned int selector_port;
+    smartnet_impl::sptr smartnet_trunking;
+    p25_trunking_sptr p25_trunking;
+    gr::op25_repeater::control_frame_ring *control_ring;
+  };
+  std::vector<Control_Channel_Input> control_channel_inputs;
+
   std::map<unsigned long, std::map<unsigned long, std::time_t>> talkgroup_patches;
+  std::unordered_map<unsigned long, TalkgroupPatch> talkgroup_patch_index;
 
   std::string get_short_name() override;
   void set_short_name(std::string short_name) override;
@@ -222,8 +239,8 @@ public:
   int get_sys_site_id() override;
   void set_xor_mask(unsigned long sys_id, unsigned long wacn, unsigned long nac) override;
   const char *get_xor_mask() override;
-  bool update_status(TrunkMessage message) override;
-  bool update_sysid(TrunkMessage message) override;
+  bool update_status(const TrunkMessage &message) override;
+  bool update_sysid(const TrunkMessage &message) override;
   int get_sys_num() override;
   void set_system_type(std::string) override;
   std::string get_talkgroups_file() override;
@@ -267,7 +284,7 @@ public:
   std::vector<double> get_control_channels() override;
   std::vector<Talkgroup *> get_talkgroups() override;
   std::vector<UnitTag *> get_unit_tags() override;
-  std::vector<UnitTagOTA *> get_unit_tags_ota() override;
+  std::vector<UnitTagOTA> get_unit_tags_ota() override;
   gr::msg_queue::sptr msg_queue;
   System_impl(int sys_id);
   void set_bandplan(std::string) override;
@@ -302,6 +319,7 @@ public:
   boost::property_tree::ptree get_stats_current(float timeDiff) override;
 
   std::vector<unsigned long> get_talkgroup_patch(unsigned long talkgroup) override;
+  const TalkgroupPatch *find_talkgroup_patch(unsigned long talkgroup) override;
   void update_active_talkgroup_patches(PatchData f_data) override;
   void delete_talkgroup_patch(PatchData f_data) override;
   void clear_stale_talkgroup_patches() override;
@@ -319,6 +337,8 @@ public:
   void set_filename_format(std::string format) override;
 
 private:
+  void refresh_talkgroup_patch(unsigned long talkgroup);
+
   TalkgroupDisplayFormat talkgroup_display_format;
   bool d_hideEncrypted;
   bool d_monitorEncrypted;
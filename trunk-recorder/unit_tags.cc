@@ -16,6 +16,11 @@
 
 using namespace csv;
 
+UnitTags::~UnitTags() {
+  // Write out any rows still waiting, however the program is exiting
+  stop_ota_writer();
+}
+
 void UnitTags::load_unit_tags(std::string filename) {
   if (filename == "") {
     return;
@@ -59,6 +64,10 @@ void UnitTags::load_unit_tags_ota(std::string filename) {
     return;
   }
 
+  if (!ota_writer) {
+    ota_writer.reset(new UnitTagsOTAWriter(filename));
+  }
+
   std::ifstream test(filename);
   if (!test.good()) {
     return;  // File doesn't exist yet, that's ok!
@@ -212,6 +221,7 @@ std::string UnitTags::find_unit_tag(long tg_number) {
   
   // Helper lambda: Search OTA tags
   auto search_ota_tags = [&]() -> std::string {
+    std::lock_guard<std::mutex> lock(ota_mutex);
     for (auto it = unit_tags_ota.rbegin(); it != unit_tags_ota.rend(); ++it) {
       UnitTagOTA *ota_tag = *it;
       if (ota_tag->unit_id == tg_number) {
@@ -244,6 +254,7 @@ std::string UnitTags::find_unit_tag(long tg_number) {
 }
 
 std::string UnitTags::find_unit_tag_ota(long unitID) {
+  std::lock_guard<std::mutex> lock(ota_mutex);
   for (auto it = unit_tags_ota.rbegin(); it != unit_tags_ota.rend(); ++it) {
     if ((*it)->unit_id == unitID) {
       return (*it)->alias;
@@ -275,6 +286,8 @@ bool UnitTags::add_ota(const OTAAlias& ota_alias) {
     return false;
   }
   
+  std::lock_guard<std::mutex> lock(ota_mutex);
+
   // Check if this unit already has an OTA tag (search OTA list only)
   UnitTagOTA *existing_ota = nullptr;
   for (auto it = unit_tags_ota.rbegin(); it != unit_tags_ota.rend(); ++it) {
@@ -301,20 +314,9 @@ bool UnitTags::add_ota(const OTAAlias& ota_alias) {
         if (ota_alias.talkgroup_id != -1) existing_ota->talkgroup_id = ota_alias.talkgroup_id;
         existing_ota->timestamp = std::time(nullptr);
         
-        // Append enriched entry to CSV
-        if (!ota_filename.empty()) {
-          try {
-            std::ofstream out(ota_filename, std::ios::app);
-            if (out.is_open()) {
-              CSVWriter<std::ofstream> writer(out);
-              writer << std::vector<std::string>{std::to_string(ota_alias.radio_id), ota_alias.alias, ota_alias.source, std::to_string(existing_ota->timestamp), ota_alias.wacn, ota_alias.sys, (ota_alias.talkgroup_id == -1) ? "" : std::to_string(ota_alias.talkgroup_id)};
-              out.close();
-            } else {
-              BOOST_LOG_TRIVIAL(error) << "Failed to open " << ota_filename << " for appending enriched entry";
-            }
-          } catch (std::exception &e) {
-            BOOST_LOG_TRIVIAL(error) << "Error appending enriched OTA entry: " << e.what();
-          }
+        // Queue enriched entry for the CSV
+        if (ota_writer) {
+          ota_writer->enqueue(std::vector<std::string>{std::to_string(ota_alias.radio_id), ota_alias.alias, ota_alias.source, std::to_string(existing_ota->timestamp), ota_alias.wacn, ota_alias.sys, (ota_alias.talkgroup_id == -1) ? "" : std::to_string(ota_alias.talkgroup_id)});
         }
         return false;
       }
@@ -327,25 +329,20 @@ bool UnitTags::add_ota(const OTAAlias& ota_alias) {
   UnitTagOTA *ota_tag = new UnitTagOTA(ota_alias.radio_id, ota_alias.alias, ota_alias.source, ota_alias.wacn, ota_alias.sys, ota_alias.talkgroup_id, std::time(nullptr));
   unit_tags_ota.push_back(ota_tag);
 
-  // Write to OTA file if configured
-  if (!ota_filename.empty()) {
-    try {
-      std::ofstream out(ota_filename, std::ios::app);
-      if (out.is_open()) {
-        CSVWriter<std::ofstream> writer(out);
-        writer << std::vector<std::string>{std::to_string(ota_alias.radio_id), ota_alias.alias, ota_alias.source, std::to_string(ota_tag->timestamp), ota_alias.wacn, ota_alias.sys, (ota_alias.talkgroup_id == -1) ? "" : std::to_string(ota_alias.talkgroup_id)};
-        out.close();
-      } else {
-        BOOST_LOG_TRIVIAL(error) << "Failed to open " << ota_filename << " for writing OTA alias.";
-      }
-    } catch (std::exception &e) {
-      BOOST_LOG_TRIVIAL(error) << "Error writing to OTA file " << ota_filename << ": " << e.what();
-    }
+  // Queue for the OTA file if configured
+  if (ota_writer) {
+    ota_writer->enqueue(std::vector<std::string>{std::to_string(ota_alias.radio_id), ota_alias.alias, ota_alias.source, std::to_string(ota_tag->timestamp), ota_alias.wacn, ota_alias.sys, (ota_alias.talkgroup_id == -1) ? "" : std::to_string(ota_alias.talkgroup_id)});
   }
   
   return true;
 }
 
+void UnitTags::stop_ota_writer() {
+  if (ota_writer) {
+    ota_writer->stop();
+  }
+}
+
 void UnitTags::set_mode(UnitTagMode mode) {
   this->mode = mode;
 }
@@ -358,6 +355,12 @@ std::vector<UnitTag *> UnitTags::get_unit_tags() {
   return unit_tags;
 }
 
-std::vector<UnitTagOTA *> UnitTags::get_unit_tags_ota() {
-  return unit_tags_ota;
+std::vector<UnitTagOTA> UnitTags::get_unit_tags_ota() {
+  std::lock_guard<std::mutex> lock(ota_mutex);
+  std::vector<UnitTagOTA> tags;
+  tags.reserve(unit_tags_ota.size());
+  for (std::vector<UnitTagOTA *>::iterator it = unit_tags_ota.begin(); it != unit_tags_ota.end(); ++it) {
+    tags.push_back(**it);
+  }
+  return tags;
 }
@@ -3,7 +3,10 @@
 
 #include "unit_tag.h"
 #include "unit_tags_ota.h"
+#include "unit_tags_ota_writer.h"
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -18,18 +21,22 @@ class UnitTags {
   std::vector<UnitTag *> unit_tags;                  // Manual tags from unitTagsFile (regex patterns)
   std::vector<UnitTagOTA *> unit_tags_ota;           // OTA tags: simple (unitID, alias) pairs
   std::string ota_filename;
+  std::unique_ptr<UnitTagsOTAWriter> ota_writer;    // Batches OTA rows to ota_filename off the decoder threads
+  std::mutex ota_mutex;                              // Guards unit_tags_ota, which is the source of truth for lookups
   UnitTagMode mode = TAG_USER_FIRST;                 // Default to user tags first
 
 public:
+  ~UnitTags();
   void load_unit_tags(std::string filename);
   void load_unit_tags_ota(std::string filename);
   std::string find_unit_tag(long unitID);
   std::string find_unit_tag_ota(long unitID);
   void add(std::string pattern, std::string tag);
   bool add_ota(const OTAAlias& ota_alias);
+  void stop_ota_writer();
   void set_mode(UnitTagMode mode);
   UnitTagMode get_mode();
   std::vector<UnitTag *> get_unit_tags();
-  std::vector<UnitTagOTA *> get_unit_tags_ota();
+  std::vector<UnitTagOTA> get_unit_tags_ota(); // Copies, since add_ota can change the tags at any time
 };
 #endif // UNIT_TAGS_H
@@ -0,0 +1,83 @@
+#include "unit_tags_ota_writer.h"
+
+#include <boost/log/trivial.hpp>
+
+#include <csv-parser/csv.hpp>
+#include <fstream>
+
+using namespace csv;
+
+UnitTagsOTAWriter::UnitTagsOTAWriter(std::string filename, std::chrono::milliseconds flush_interval)
+    : filename(filename), flush_interval(flush_interval), stopping(false) {
+  writer_thread = std::thread(&UnitTagsOTAWriter::run, this);
+}
+
+UnitTagsOTAWriter::~UnitTagsOTAWriter() {
+  stop();
+}
+
+void UnitTagsOTAWriter::enqueue(std::vector<std::string> row) {
+  std::lock_guard<std::mutex> lock(queue_mutex);
+  if (stopping) {
+    // The writer thread is gone, fall back to a direct write so nothing is lost
+    write_rows({row});
+    return;
+  }
+  pending_rows.push_back(std::move(row));
+}
+
+void UnitTagsOTAWriter::stop() {
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex);
+    if (stopping) {
+      return;
+    }
+    stopping = true;
+  }
+  queue_cv.notify_all();
+  if (writer_thread.joinable()) {
+    writer_thread.join();
+  }
+}
+
+void UnitTagsOTAWriter::run() {
+  std::vector<std::vector<std::string>> batch;
+  std::unique_lock<std::mutex> lock(queue_mutex);
+
+  while (true) {
+    queue_cv.wait_for(lock, flush_interval, [this] { return stopping; });
+
+    batch.swap(pending_rows);
+    bool done = stopping;
+
+    if (!batch.empty()) {
+      // Write without holding the lock so the decoders never wait on disk
+      lock.unlock();
+      write_rows(batch);
+      batch.clear();
+      lock.lock();
+    }
+
+    if (done && pending_rows.empty()) {
+      break;
+    }
+  }
+}
+
+void UnitTagsOTAWriter::write_rows(const std::vector<std::vector<std::string>> &rows) {
+  try {
+    std::ofstream out(filename, std::ios::app);
+    if (!out.is_open()) {
+      BOOST_LOG_TRIVIAL(error) << "Failed to open " << filename << " for writing " << rows.size() << " OTA aliases.";
+      return;
+    }
+    CSVWriter<std::ofstream> writer(out);
+    for (const std::vector<std::string> &row : rows) {
+      writer << row;
+    }
+    out.close();
+    BOOST_LOG_TRIVIAL(trace) << "Wrote " << rows.size() << " OTA aliases to " << filename;
+  } catch (std::exception &e) {
+    BOOST_LOG_TRIVIAL(error) << "Error writing to OTA file " << filename << ": " << e.what();
+  }
+}
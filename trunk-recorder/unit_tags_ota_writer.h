@@ -0,0 +1,35 @@
+#ifndef UNIT_TAGS_OTA_WRITER_H
+#define UNIT_TAGS_OTA_WRITER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Appends OTA alias rows to the OTA CSV file from a background thread.
+// Rows are queued by the decoder threads and written out in batches, so the
+// file is opened once per flush interval instead of once per alias.
+class UnitTagsOTAWriter {
+public:
+  UnitTagsOTAWriter(std::string filename, std::chrono::milliseconds flush_interval = std::chrono::milliseconds(1000));
+  ~UnitTagsOTAWriter();
+
+  void enqueue(std::vector<std::string> row);
+  void stop(); // Drains any queued rows and joins the writer thread
+
+private:
+  void run();
+  void write_rows(const std::vector<std::vector<std::string>> &rows);
+
+  std::string filename;
+  std::chrono::milliseconds flush_interval;
+  std::vector<std::vector<std::string>> pending_rows;
+  std::mutex queue_mutex;
+  std::condition_variable queue_cv;
+  bool stopping;
+  std::thread writer_thread;
+};
+
+#endif // UNIT_TAGS_OTA_WRITER_H